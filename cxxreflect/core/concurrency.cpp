@@ -8,6 +8,7 @@
 
 #if CXXREFLECT_THREADING == CXXREFLECT_THREADING_STDCPPSYNCHRONIZED
 #    include <mutex>
+#    include <thread>
 #endif
 
 namespace cxxreflect { namespace core {
@@ -98,4 +99,140 @@ namespace cxxreflect { namespace core {
         release();
     }
 
+
+
+
+
+    auto for_each_partition(size_type const count, partition_callable const& callable, bool const parallel) -> void
+    {
+        if (count == 0)
+            return;
+
+        #if CXXREFLECT_THREADING == CXXREFLECT_THREADING_STDCPPSYNCHRONIZED
+
+        size_type const hardware_threads(std::max(std::thread::hardware_concurrency(), 1u));
+        size_type const partition_count(parallel ? std::min(hardware_threads, count) : 1);
+        if (partition_count == 1)
+            return callable(0, count);
+
+        size_type const partition_size((count + partition_count - 1) / partition_count);
+
+        std::mutex         error_sync;
+        std::exception_ptr error;
+
+        std::vector<std::thread> workers;
+        workers.reserve(partition_count);
+        for (size_type first(0); first < count; first += partition_size)
+        {
+            size_type const last(std::min(first + partition_size, count));
+            workers.push_back(std::thread([&, first, last]
+            {
+                try
+                {
+                    callable(first, last);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> const lock(error_sync);
+                    if (error == nullptr)
+                        error = std::current_exception();
+                }
+            }));
+        }
+
+        std::for_each(workers.begin(), workers.end(), [](std::thread& worker) { worker.join(); });
+
+        if (error != nullptr)
+            std::rethrow_exception(error);
+
+        #elif CXXREFLECT_THREADING == CXXREFLECT_THREADING_SINGLETHREADED
+
+        callable(0, count);
+
+        #else
+        #    error Unknown threading model
+        #endif
+    }
+
+    auto for_each_dynamic_partition(size_type          const  count,
+                                    size_type          const  grain_size,
+                                    partition_callable const& callable,
+                                    bool               const  parallel) -> void
+    {
+        assert_true([&]{ return grain_size != 0; });
+
+        if (count == 0)
+            return;
+
+        #if CXXREFLECT_THREADING == CXXREFLECT_THREADING_STDCPPSYNCHRONIZED
+
+        size_type const chunk_count((count + grain_size - 1) / grain_size);
+        size_type const hardware_threads(std::max(std::thread::hardware_concurrency(), 1u));
+        size_type const worker_count(parallel ? std::min(hardware_threads, chunk_count) : 1);
+        if (worker_count == 1)
+        {
+            for (size_type first(0); first < count; first += grain_size)
+                callable(first, std::min(first + grain_size, count));
+
+            return;
+        }
+
+        // The cursor is the first index that has not yet been claimed; it is also used to stop the
+        // other workers once one of them has thrown:
+        std::mutex         cursor_sync;
+        size_type          cursor(0);
+        std::exception_ptr error;
+
+        std::vector<std::thread> workers;
+        workers.reserve(worker_count);
+        for (size_type i(0); i != worker_count; ++i)
+        {
+            workers.push_back(std::thread([&]
+            {
+                for (;;)
+                {
+                    size_type first(0);
+                    size_type last(0);
+                    {
+                        std::lock_guard<std::mutex> const lock(cursor_sync);
+                        if (cursor == count)
+                            return;
+
+                        first  = cursor;
+                        last   = std::min(first + grain_size, count);
+                        cursor = last;
+                    }
+
+                    try
+                    {
+                        callable(first, last);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> const lock(cursor_sync);
+                        if (error == nullptr)
+                            error = std::current_exception();
+
+                        cursor = count;
+                        return;
+                    }
+                }
+            }));
+        }
+
+        std::for_each(workers.begin(), workers.end(), [](std::thread& worker) { worker.join(); });
+
+        if (error != nullptr)
+            std::rethrow_exception(error);
+
+        #elif CXXREFLECT_THREADING == CXXREFLECT_THREADING_SINGLETHREADED
+
+        for (size_type first(0); first < count; first += grain_size)
+            callable(first, std::min(first + grain_size, count));
+
+        #else
+        #    error Unknown threading model
+        #endif
+    }
+
 } }
@@ -171,6 +171,38 @@ namespace cxxreflect { namespace core {
         std::unique_ptr<recursive_mutex_context> _mutex;
     };
 
+
+
+
+
+    /// A callable that processes the half-open range of indices `[first, last)`
+    typedef std::function<void(size_type first, size_type last)> partition_callable;
+
+    /// Partitions the index range `[0, count)` into contiguous subranges and calls `callable` once
+    /// for each subrange
+    ///
+    /// If `parallel` is `true` and the threading model supports it, the subranges are processed
+    /// concurrently on worker threads (one per hardware thread, at most) and this function blocks
+    /// until all of them have completed.  Otherwise, `callable(0, count)` is called on the calling
+    /// thread.  If any invocation throws, the first exception thrown is rethrown on the calling
+    /// thread after all of the workers have completed.
+    auto for_each_partition(size_type count, partition_callable const& callable, bool parallel) -> void;
+
+    /// Partitions the index range `[0, count)` into contiguous chunks of `grain_size` indices (the
+    /// last chunk may be smaller) and calls `callable` once for each chunk
+    ///
+    /// Unlike `for_each_partition`, which gives each worker one fixed subrange, the workers here
+    /// claim chunks one at a time from a shared cursor, so a worker that finishes its chunks early
+    /// takes over chunks that would otherwise have waited for a busier worker.  This balances the
+    /// load when the cost of processing an index varies widely.  If `parallel` is `false` or the
+    /// threading model does not support threads, the chunks are processed in order on the calling
+    /// thread.  Exceptions are handled as by `for_each_partition`; once an invocation has thrown,
+    /// no further chunks are claimed.  The `grain_size` must be nonzero.
+    auto for_each_dynamic_partition(size_type          count,
+                                    size_type          grain_size,
+                                    partition_callable const& callable,
+                                    bool               parallel) -> void;
+
 } }
 
 #endif
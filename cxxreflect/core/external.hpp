@@ -34,6 +34,9 @@ namespace cxxreflect { namespace core { namespace detail {
         /// Tests whether a file exists
         virtual auto file_exists(wchar_t const* file_path) const -> bool = 0;
 
+        /// Enumerates the names of the files in a directory; subdirectories are not included
+        virtual auto enumerate_files(wchar_t const* directory_path) const -> std::vector<string> = 0;
+
         /// Virtual destructor for interface class
         virtual ~base_externals() { }
     };
@@ -84,6 +87,11 @@ namespace cxxreflect { namespace core { namespace detail {
             return _instance.file_exists(file_path);
         }
 
+        virtual auto enumerate_files(wchar_t const* directory_path) const -> std::vector<string>
+        {
+            return _instance.enumerate_files(directory_path);
+        }
+
     private:
 
         externals_type _instance;
@@ -169,6 +177,11 @@ namespace cxxreflect { namespace core { namespace externals {
         return detail::global_externals::get().file_exists(file_path);
     }
 
+    inline auto enumerate_files(wchar_t const* const directory_path) -> std::vector<string>
+    {
+        return detail::global_externals::get().enumerate_files(directory_path);
+    }
+
 } } }
 
 #endif
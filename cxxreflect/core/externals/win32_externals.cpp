@@ -129,6 +129,32 @@ namespace cxxreflect { namespace externals {
         return map_file_range(file, 0, compute_file_size(file));
     }
 
+    auto base_win32_externals::enumerate_files(wchar_t const* const directory_path) const -> std::vector<core::string>
+    {
+        core::assert_not_null(directory_path);
+
+        std::vector<core::string> result;
+
+        core::string const pattern(core::string(directory_path) + L"\\*");
+
+        // FindFirstFileEx is available to Windows Runtime apps, so this is shared by both sets of
+        // externals.  A directory that does not exist has no files:
+        WIN32_FIND_DATA data = { 0 };
+        HANDLE const find_handle(::FindFirstFileEx(pattern.c_str(), FindExInfoBasic, &data, FindExSearchNameMatch, nullptr, 0));
+        if (find_handle == INVALID_HANDLE_VALUE)
+            return result;
+
+        core::scope_guard cleanup_find_handle([&](){ ::FindClose(find_handle); });
+        do
+        {
+            if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+                result.push_back(data.cFileName);
+        }
+        while (::FindNextFile(find_handle, &data));
+
+        return result;
+    }
+
     base_win32_externals::~base_win32_externals()
     {
     }
@@ -26,6 +26,8 @@ namespace cxxreflect { namespace externals {
 
         auto map_file(FILE* const file) const -> core::unique_byte_array;
 
+        auto enumerate_files(wchar_t const* const directory_path) const -> std::vector<core::string>;
+
     protected:
 
         ~base_win32_externals();
@@ -98,6 +98,8 @@ namespace cxxreflect { namespace core {
         auto front() const -> const_reference { return *_first;               }
         auto back()  const -> const_reference { return *(compute_last() - 1); }
 
+        // Note:  c_str() is only usable if the string is null-terminated.  A string constructed
+        // from a range need not be (e.g. a view of a string in the user string heap).
         auto c_str() const -> const_pointer   { return _first == nullptr ? L"" : _first; }
         auto data()  const -> const_pointer   { return _first;                           }
 
@@ -127,8 +129,10 @@ namespace cxxreflect { namespace core {
             else if (lhs_it != nullptr && rhs_it == nullptr)
                 return Comparer<value_type>()(1, 0);
 
-            // Next, if both strings are valid, compare them until we find nonequal characters:
-            while (*lhs_it != 0 && *rhs_it != 0 && *lhs_it == *rhs_it)
+            // Next, if both strings are valid, compare them until we find nonequal characters.  A
+            // string whose end is known need not be null-terminated and may contain embedded null
+            // characters, so we stop only at its end; otherwise, we stop at the null terminator:
+            while (!is_end(lhs, lhs_it) && !is_end(rhs, rhs_it) && *lhs_it == *rhs_it)
             {
                 ++lhs_it;
                 ++rhs_it;
@@ -141,13 +145,26 @@ namespace cxxreflect { namespace core {
             if (rhs._last == nullptr && *rhs_it == 0)
                 rhs._last = rhs_it;
 
-            return Comparer<value_type>()(*lhs_it, *rhs_it);
+            // An end ranks below every character (including an embedded null character), so when
+            // both ends are known, the shorter string orders first:
+            return Comparer<std::uint32_t>()(rank(lhs, lhs_it), rank(rhs, rhs_it));
         }
 
         CXXREFLECT_GENERATE_COMPARISON_OPERATORS(enhanced_cstring)
 
     private:
 
+        static auto is_end(enhanced_cstring const& s, const_pointer const it) -> bool
+        {
+            return s._last != nullptr ? it == s._last : *it == 0;
+        }
+
+        static auto rank(enhanced_cstring const& s, const_pointer const it) -> std::uint32_t
+        {
+            typedef typename std::make_unsigned<value_type>::type unsigned_value_type;
+            return is_end(s, it) ? 0 : static_cast<std::uint32_t>(static_cast<unsigned_value_type>(*it)) + 1;
+        }
+
         auto compute_last() const -> pointer
         {
             if (_last != nullptr)
@@ -219,7 +236,8 @@ namespace cxxreflect { namespace core {
     template <typename T>
     auto operator<<(std::basic_ostream<T>& os, enhanced_cstring<T> const& s) -> std::basic_ostream<T>&
     {
-        os << s.c_str();
+        // The string need not be null-terminated, so we write its range rather than its c_str():
+        std::copy(begin(s), end(s), std::ostreambuf_iterator<T>(os));
         return os;
     }
 
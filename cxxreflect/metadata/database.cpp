@@ -649,6 +649,213 @@ namespace cxxreflect { namespace metadata {
 
 
 
+    database_user_string_iterator::database_user_string_iterator()
+    {
+    }
+
+    database_user_string_iterator::database_user_string_iterator(database_user_string_collection const* const collection,
+                                                                 core::const_byte_iterator              const first,
+                                                                 core::const_byte_iterator              const current,
+                                                                 core::const_byte_iterator              const last)
+        : _collection(collection), _first(first), _current(current), _next(current), _last(last)
+    {
+        core::assert_not_null(collection);
+
+        skip_empty_entries();
+    }
+
+    auto database_user_string_iterator::index() const -> core::size_type
+    {
+        return core::distance(_first.get(), _current.get());
+    }
+
+    auto database_user_string_iterator::operator*() const -> reference
+    {
+        core::assert_true([&]{ return _current.get() != _last.get(); });
+        return _value;
+    }
+
+    auto database_user_string_iterator::operator->() const -> pointer
+    {
+        core::assert_true([&]{ return _current.get() != _last.get(); });
+        return &_value;
+    }
+
+    auto database_user_string_iterator::operator++() -> database_user_string_iterator&
+    {
+        core::assert_true([&]{ return _current.get() != _last.get(); });
+
+        _current.get() = _next.get();
+        skip_empty_entries();
+        return *this;
+    }
+
+    auto database_user_string_iterator::operator++(int) -> database_user_string_iterator
+    {
+        database_user_string_iterator const it(*this);
+        ++*this;
+        return it;
+    }
+
+    auto database_user_string_iterator::skip_empty_entries() -> void
+    {
+        // Each entry is a compressed length followed by that many bytes.  The only empty entries
+        // are the entry at index zero and the padding at the end of the heap; every string,
+        // including the empty string, has at least its trailing flag byte.
+        while (_current.get() != _last.get())
+        {
+            core::const_byte_iterator it(_current.get());
+            core::size_type const length(detail::read_sig_compressed_uint32(it, _last.get()));
+            if (core::distance(it, _last.get()) < length)
+                throw core::metadata_error(L"invalid user string:  string extends beyond end of heap");
+
+            _next.get() = it + length;
+            if (length != 0)
+            {
+                _value = (*_collection)[index()];
+                return;
+            }
+
+            _current.get() = _next.get();
+        }
+
+        _value = core::string_reference();
+    }
+
+
+
+
+
+    database_user_string_collection::database_user_string_collection()
+    {
+    }
+
+    database_user_string_collection::database_user_string_collection(database_stream&& stream)
+        : _stream(std::move(stream))
+    {
+    }
+
+    database_user_string_collection::database_user_string_collection(database_user_string_collection&& other)
+        : _stream(std::move(other._stream)),
+          _copies(std::move(other._copies))
+    {
+    }
+
+    auto database_user_string_collection::operator=(database_user_string_collection&& other) -> database_user_string_collection&
+    {
+        _stream = std::move(other._stream);
+        _copies = std::move(other._copies);
+        return *this;
+    }
+
+    auto database_user_string_collection::operator[](core::size_type const index) const -> core::string_reference
+    {
+        if (!_stream.is_initialized() || index >= _stream.size())
+            throw core::metadata_error(L"invalid user string index:  index out of range");
+
+        core::const_byte_iterator it(_stream.begin() + index);
+        core::size_type const length(detail::read_sig_compressed_uint32(it, _stream.end()));
+        if (core::distance(it, _stream.end()) < length)
+            throw core::metadata_error(L"invalid user string:  string extends beyond end of heap");
+
+        // The length includes a trailing byte that is set if the string contains any characters
+        // that require special handling; we have no use for it, so we discard it:
+        core::size_type const count(length / 2);
+
+        // If the characters are aligned, we can return a view of the heap:
+        if (reinterpret_cast<std::uintptr_t>(it) % sizeof(core::character) == 0)
+        {
+            core::const_character_iterator const characters(reinterpret_cast<core::const_character_iterator>(it));
+            return core::string_reference(characters, characters + count);
+        }
+
+        // Otherwise, we assemble each character from its bytes and cache the copy.  The map never
+        // moves its elements, so the returned reference remains valid:
+        auto const lock(_sync.lock());
+
+        auto const existing_it(_copies.find(index));
+        if (existing_it != _copies.end())
+            return core::string_reference(existing_it->second.c_str(), existing_it->second.c_str() + count);
+
+        core::string copy(count, L'\0');
+        for (core::size_type i(0); i != count; ++i)
+            copy[i] = static_cast<core::character>(it[2 * i] | (it[2 * i + 1] << 8));
+
+        core::string const& result(_copies.insert(std::make_pair(index, std::move(copy))).first->second);
+        return core::string_reference(result.c_str(), result.c_str() + count);
+    }
+
+    auto database_user_string_collection::begin() const -> iterator
+    {
+        return iterator(this, _stream.begin(), _stream.begin(), _stream.end());
+    }
+
+    auto database_user_string_collection::end() const -> iterator
+    {
+        return iterator(this, _stream.begin(), _stream.end(), _stream.end());
+    }
+
+    auto database_user_string_collection::is_initialized() const -> bool
+    {
+        return _stream.is_initialized();
+    }
+
+
+
+
+
+    database_section::database_section()
+    {
+    }
+
+    database_section::database_section(core::const_byte_cursor       file,
+                                       std::uint32_t           const virtual_address,
+                                       std::uint32_t           const virtual_size,
+                                       std::uint32_t           const raw_data_offset,
+                                       std::uint32_t           const raw_data_size)
+        : _virtual_address(virtual_address), _virtual_size(virtual_size)
+    {
+        // The raw data is padded to the file alignment, so it may be larger than the section:
+        std::uint32_t const n(virtual_size != 0 && virtual_size < raw_data_size ? virtual_size : raw_data_size);
+
+        if (!file.can_seek(raw_data_offset, core::const_byte_cursor::begin))
+            throw core::metadata_error(L"unable to read PE section:  start index out of range");
+
+        file.seek(raw_data_offset, core::const_byte_cursor::begin);
+
+        if (!file.can_read(n))
+            throw core::metadata_error(L"unable to read PE section:  end index out of range");
+
+        core::const_byte_iterator const it(file.get_current());
+        _data = core::const_byte_range(it, it + n);
+    }
+
+    auto database_section::contains(std::uint32_t const rva) const -> bool
+    {
+        return rva >= _virtual_address.get() && rva - _virtual_address.get() < _virtual_size.get();
+    }
+
+    auto database_section::range_from(std::uint32_t const rva) const -> core::const_byte_range
+    {
+        core::assert_initialized(*this);
+        core::assert_true([&]{ return contains(rva); });
+
+        core::size_type const offset(rva - _virtual_address.get());
+        if (offset > _data.size())
+            throw core::metadata_error(L"RVA refers to uninitialized data in its PE section");
+
+        return core::const_byte_range(_data.begin() + offset, _data.end());
+    }
+
+    auto database_section::is_initialized() const -> bool
+    {
+        return _data.is_initialized();
+    }
+
+
+
+
+
     database_owner::~database_owner()
     {
         // Virtual destructor required for polymorphic base
@@ -665,11 +872,23 @@ namespace cxxreflect { namespace metadata {
     }
 
     database::database(file_range&& file, database_owner const* const owner)
-        : _file(std::move(file)), _owner(owner)
+        : _resources_rva(), _resources_size(), _file(std::move(file)), _owner(owner)
     {
         core::const_byte_cursor const cursor(_file.begin(), _file.end());
 
         auto const cli_header(detail::read_pe_sections_and_cli_header(cursor));
+
+        _sections.reserve(cli_header.sections.size());
+        core::for_all(cli_header.sections, [&](detail::pe_section_header const& section)
+        {
+            _sections.push_back(database_section(
+                cursor,
+                section.virtual_address,
+                section.virtual_size,
+                section.raw_data_offset,
+                section.raw_data_size));
+        });
+
         auto const stream_headers(detail::read_pe_cli_stream_headers(cursor, cli_header));
         for (std::size_t i(0); i < stream_headers.size(); ++i)
         {
@@ -688,7 +907,7 @@ namespace cxxreflect { namespace metadata {
                 break;
 
             case detail::pe_cli_stream_kind::user_string:
-                // We do not use the userstrings stream for metadata
+                _user_strings = database_user_string_collection(std::move(new_stream));
                 break;
 
             case detail::pe_cli_stream_kind::blob:
@@ -707,14 +926,24 @@ namespace cxxreflect { namespace metadata {
                 throw core::metadata_error(L"unexpected stream kind value");
             }
         }
+
+        // The embedded manifest resources are not in a metadata stream; they are located by the CLI
+        // header.  We only record their location here:  they are mapped and validated when a
+        // resource is accessed, so a module with malformed resources is otherwise usable.
+        _resources_rva  = cli_header.cli_header.resources.rva;
+        _resources_size = cli_header.cli_header.resources.size;
     }
 
     database::database(database&& other)
-        : _blobs  (std::move(other._blobs  )),
-          _guids  (std::move(other._guids  )),
-          _strings(std::move(other._strings)),
-          _tables (std::move(other._tables )),
-          _file   (std::move(other._file   ))
+        : _blobs         (std::move(other._blobs       )),
+          _guids         (std::move(other._guids       )),
+          _strings       (std::move(other._strings     )),
+          _user_strings  (std::move(other._user_strings)),
+          _tables        (std::move(other._tables      )),
+          _sections      (std::move(other._sections    )),
+          _resources_rva (other._resources_rva           ),
+          _resources_size(other._resources_size          ),
+          _file          (std::move(other._file        ))
     {
     }
 
@@ -726,11 +955,15 @@ namespace cxxreflect { namespace metadata {
 
     auto database::swap(database& other) -> void
     {
-        std::swap(_blobs,   other._blobs  );
-        std::swap(_guids,   other._guids  );
-        std::swap(_strings, other._strings);
-        std::swap(_tables,  other._tables );
-        std::swap(_file,    other._file   );
+        std::swap(_blobs,          other._blobs         );
+        std::swap(_guids,          other._guids         );
+        std::swap(_strings,        other._strings       );
+        std::swap(_user_strings,   other._user_strings  );
+        std::swap(_tables,         other._tables        );
+        std::swap(_sections,       other._sections      );
+        std::swap(_resources_rva,  other._resources_rva );
+        std::swap(_resources_size, other._resources_size);
+        std::swap(_file,           other._file          );
     }
 
     auto database::stride_begin(table_id const table) const -> core::stride_iterator
@@ -769,6 +1002,56 @@ namespace cxxreflect { namespace metadata {
         return _guids;
     }
 
+    auto database::user_strings() const -> database_user_string_collection const&
+    {
+        core::assert_initialized(*this);
+        return _user_strings;
+    }
+
+    auto database::map_rva(std::uint32_t const rva) const -> core::const_byte_range
+    {
+        core::assert_initialized(*this);
+
+        auto const it(core::find_if(_sections, [&](database_section const& section)
+        {
+            return section.contains(rva);
+        }));
+
+        if (it == _sections.end())
+            throw core::metadata_error(L"failed to locate PE file section containing RVA");
+
+        return it->range_from(rva);
+    }
+
+    auto database::embedded_resource(core::size_type const offset) const -> core::const_byte_range
+    {
+        core::assert_initialized(*this);
+
+        core::const_byte_range const resources(map_resources());
+        if (resources.empty() || offset > resources.size())
+            throw core::metadata_error(L"invalid manifest resource offset:  offset out of range");
+
+        // Each resource is prefixed by its four-byte length:
+        core::const_byte_iterator it(resources.begin() + offset);
+        std::uint32_t const length(detail::read_sig_element<std::uint32_t>(it, resources.end()));
+        if (core::distance(it, resources.end()) < length)
+            throw core::metadata_error(L"invalid manifest resource:  resource extends beyond end of resources");
+
+        return core::const_byte_range(it, it + length);
+    }
+
+    auto database::map_resources() const -> core::const_byte_range
+    {
+        if (_resources_rva == 0 || _resources_size == 0)
+            return core::const_byte_range();
+
+        core::const_byte_range const range(map_rva(_resources_rva));
+        if (range.size() < _resources_size)
+            throw core::metadata_error(L"CLI resources extend beyond the end of their PE section");
+
+        return core::const_byte_range(range.begin(), range.begin() + _resources_size);
+    }
+
     auto database::owner() const -> database_owner const&
     {
         core::assert_initialized(*this);
@@ -313,6 +313,157 @@ namespace cxxreflect { namespace metadata {
 
 
 
+    class database_user_string_collection;
+
+    /// A forward iterator over the strings in the user string heap of a metadata database
+    ///
+    /// The iterator skips the empty entry at the start of the heap and any padding at its end, so
+    /// it visits each string that may be loaded by an `ldstr` instruction.  `index()` is the index
+    /// of the current string in the heap (i.e., the index encoded in the `ldstr` token).  Strings
+    /// are obtained from the collection, so they are views or copies as described there.
+    class database_user_string_iterator
+    {
+    public:
+
+        typedef core::string_reference        value_type;
+        typedef core::string_reference const& reference;
+        typedef core::string_reference const* pointer;
+        typedef std::ptrdiff_t                difference_type;
+        typedef std::forward_iterator_tag     iterator_category;
+
+        database_user_string_iterator();
+        database_user_string_iterator(database_user_string_collection const* collection,
+                                      core::const_byte_iterator              first,
+                                      core::const_byte_iterator              current,
+                                      core::const_byte_iterator              last);
+
+        auto index() const -> core::size_type;
+
+        auto operator*()  const -> reference;
+        auto operator->() const -> pointer;
+
+        auto operator++()    -> database_user_string_iterator&;
+        auto operator++(int) -> database_user_string_iterator;
+
+        friend auto operator==(database_user_string_iterator const& lhs, database_user_string_iterator const& rhs) -> bool
+        {
+            return lhs._current.get() == rhs._current.get();
+        }
+
+        CXXREFLECT_GENERATE_EQUALITY_OPERATORS(database_user_string_iterator)
+
+    private:
+
+        /// Advances `_current` to the next nonempty string, or to the end, and decodes it
+        auto skip_empty_entries() -> void;
+
+        core::checked_pointer<database_user_string_collection const> _collection;
+        core::value_initialized<core::const_byte_iterator> _first;
+        core::value_initialized<core::const_byte_iterator> _current;
+        core::value_initialized<core::const_byte_iterator> _next;
+        core::value_initialized<core::const_byte_iterator> _last;
+        core::string_reference                             _value;
+    };
+
+    /// The collection of user strings in a metadata database
+    ///
+    /// This encapsulates the user string heap (#US), which contains the string literals loaded by
+    /// `ldstr` instructions.  Unlike the strings heap, the user string heap is stored in UTF-16LE,
+    /// so a string whose characters are suitably aligned is returned as a view of the heap itself
+    /// and nothing is converted, copied, or cached, and no lock is required.
+    ///
+    /// Entries are not padded, though, so the characters of an entry may begin at an odd offset.
+    /// Such a string cannot be viewed in place (a misaligned `character` pointer is not portable),
+    /// so its characters are read from the little-endian bytes into a cached copy, under a lock.
+    ///
+    /// Note that user strings are not null-terminated and may contain null characters, so the
+    /// `c_str()` of a user string must not be used; use its `begin()` and `end()` instead.  A
+    /// module that has no string literals may have no user string heap, in which case the
+    /// collection is uninitialized and empty.
+    class database_user_string_collection
+    {
+    public:
+
+        typedef database_user_string_iterator iterator;
+
+        database_user_string_collection();
+        explicit database_user_string_collection(database_stream&& stream);
+
+        database_user_string_collection(database_user_string_collection&&);
+        auto operator=(database_user_string_collection&&) -> database_user_string_collection&;
+
+        /// Gets the string at index `index` in the user string heap
+        ///
+        /// If `index` is past the end of the heap or if the string at `index` extends beyond the
+        /// end of the heap, this will throw a `metadata_error`.
+        auto operator[](core::size_type index) const -> core::string_reference;
+
+        auto begin() const -> iterator;
+        auto end()   const -> iterator;
+
+        auto is_initialized() const -> bool;
+
+    private:
+
+        database_user_string_collection(database_user_string_collection const&);
+        auto operator=(database_user_string_collection const&) -> void;
+
+        typedef std::map<core::size_type, core::string> string_map;
+
+        database_stream               _stream;
+        string_map            mutable _copies;  // Maps heap indices of misaligned strings to copies
+        core::recursive_mutex mutable _sync;
+    };
+
+
+
+
+
+    /// A section of the PE file that contains a metadata database
+    ///
+    /// Method bodies, the initial values of fields with RVAs, and manifest resources are not stored
+    /// in the metadata streams; they are located by relative virtual address (RVA).  An RVA is
+    /// mapped to file data via the section that contains it.  Like a `database_stream`, a section
+    /// only wraps access to the file and does not own it.
+    class database_section
+    {
+    public:
+
+        database_section();
+
+        /// Constructs a new `database_section` from a PE section header
+        ///
+        /// `file` must be a cursor into a PE file.  If the raw data of the section extends beyond
+        /// the end of the file, a `metadata_error` is thrown.
+        database_section(core::const_byte_cursor file,
+                         std::uint32_t           virtual_address,
+                         std::uint32_t           virtual_size,
+                         std::uint32_t           raw_data_offset,
+                         std::uint32_t           raw_data_size);
+
+        /// Tests whether `rva` is in this section
+        auto contains(std::uint32_t rva) const -> bool;
+
+        /// Gets the bytes of this section from the RVA `rva` to the end of the section's data
+        ///
+        /// `rva` must be in this section.  The section may be larger in memory than it is in the
+        /// file (the remainder is zero-filled when the image is mapped), so the returned range may
+        /// be shorter than the virtual size of the section would suggest.
+        auto range_from(std::uint32_t rva) const -> core::const_byte_range;
+
+        auto is_initialized() const -> bool;
+
+    private:
+
+        core::value_initialized<std::uint32_t> _virtual_address;
+        core::value_initialized<std::uint32_t> _virtual_size;
+        core::const_byte_range                 _data;
+    };
+
+
+
+
+
     /// A polymorphic base for tagging a type that owns a `database` instance
     ///
     /// In most use cases, a database will be owned by some other object.  For example, if we're 
@@ -380,7 +531,8 @@ namespace cxxreflect { namespace metadata {
     {
     public:
 
-        typedef core::unique_byte_array file_range;
+        typedef core::unique_byte_array       file_range;
+        typedef std::vector<database_section> section_sequence;
 
         /// Constructs a new `database` from the CLI module located at `path`
         ///
@@ -450,6 +602,23 @@ namespace cxxreflect { namespace metadata {
         auto blobs()   const -> database_stream const&;
         auto guids()   const -> database_stream const&;
 
+        /// Gets the user string heap; see `database_user_string_collection` for details
+        auto user_strings() const -> database_user_string_collection const&;
+
+        /// Gets the bytes of the PE file from the RVA `rva` to the end of the section containing it
+        ///
+        /// If no section contains `rva`, a `metadata_error` is thrown.  See `database_section` for
+        /// details about the returned range.
+        auto map_rva(std::uint32_t rva) const -> core::const_byte_range;
+
+        /// Gets the data of the embedded manifest resource at `offset` in the CLI resources
+        ///
+        /// `offset` is the offset of a ManifestResource row whose implementation is null.  The data
+        /// is returned as a view of the PE file.  If the module has no resources, if the resources
+        /// extend beyond the end of their PE section, or if the resource extends beyond the end of
+        /// the resources, a `metadata_error` is thrown.
+        auto embedded_resource(core::size_type offset) const -> core::const_byte_range;
+
         auto owner()   const -> database_owner const&;
 
         auto is_initialized() const -> bool;
@@ -464,11 +633,19 @@ namespace cxxreflect { namespace metadata {
         database(database const&);
         auto operator=(database const&) -> void;
 
+        /// Maps the CLI resources; returns an empty range if the module has none
+        auto map_resources() const -> core::const_byte_range;
+
         database_stream _blobs;
         database_stream _guids;
 
-        database_string_collection _strings;
-        database_table_collection  _tables;
+        database_string_collection      _strings;
+        database_user_string_collection _user_strings;
+        database_table_collection       _tables;
+
+        section_sequence       _sections;
+        std::uint32_t          _resources_rva;
+        std::uint32_t          _resources_size;
 
         file_range _file;
 
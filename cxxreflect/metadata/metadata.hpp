@@ -8,6 +8,7 @@
 
 #include "cxxreflect/metadata/constants.hpp"
 #include "cxxreflect/metadata/database.hpp"
+#include "cxxreflect/metadata/method_body.hpp"
 #include "cxxreflect/metadata/relationships.hpp"
 #include "cxxreflect/metadata/rows.hpp"
 #include "cxxreflect/metadata/signatures.hpp"
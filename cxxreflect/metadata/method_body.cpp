@@ -0,0 +1,899 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "cxxreflect/metadata/precompiled_headers.hpp"
+#include "cxxreflect/metadata/database.hpp"
+#include "cxxreflect/metadata/method_body.hpp"
+#include "cxxreflect/metadata/rows.hpp"
+#include "cxxreflect/metadata/utility.hpp"
+
+namespace cxxreflect { namespace metadata { namespace {
+
+    /// The name and operand encoding of an opcode; unused opcodes have a null name
+    struct opcode_descriptor
+    {
+        wchar_t const*  name;
+        il_operand_kind operand_kind;
+    };
+
+    /// The one-byte opcodes, indexed by opcode (ECMA 335-2010 III.1.2.1).  Opcodes after `0xe0` are
+    /// unused; `0xfe` is the prefix of the two-byte opcodes and is not itself an opcode.
+    opcode_descriptor const one_byte_opcodes[0x100] =
+    {
+        { L"nop",             il_operand_kind::none           }, // 0x00
+        { L"break",           il_operand_kind::none           }, // 0x01
+        { L"ldarg.0",         il_operand_kind::none           }, // 0x02
+        { L"ldarg.1",         il_operand_kind::none           }, // 0x03
+        { L"ldarg.2",         il_operand_kind::none           }, // 0x04
+        { L"ldarg.3",         il_operand_kind::none           }, // 0x05
+        { L"ldloc.0",         il_operand_kind::none           }, // 0x06
+        { L"ldloc.1",         il_operand_kind::none           }, // 0x07
+        { L"ldloc.2",         il_operand_kind::none           }, // 0x08
+        { L"ldloc.3",         il_operand_kind::none           }, // 0x09
+        { L"stloc.0",         il_operand_kind::none           }, // 0x0a
+        { L"stloc.1",         il_operand_kind::none           }, // 0x0b
+        { L"stloc.2",         il_operand_kind::none           }, // 0x0c
+        { L"stloc.3",         il_operand_kind::none           }, // 0x0d
+        { L"ldarg.s",         il_operand_kind::short_variable }, // 0x0e
+        { L"ldarga.s",        il_operand_kind::short_variable }, // 0x0f
+        { L"starg.s",         il_operand_kind::short_variable }, // 0x10
+        { L"ldloc.s",         il_operand_kind::short_variable }, // 0x11
+        { L"ldloca.s",        il_operand_kind::short_variable }, // 0x12
+        { L"stloc.s",         il_operand_kind::short_variable }, // 0x13
+        { L"ldnull",          il_operand_kind::none           }, // 0x14
+        { L"ldc.i4.m1",       il_operand_kind::none           }, // 0x15
+        { L"ldc.i4.0",        il_operand_kind::none           }, // 0x16
+        { L"ldc.i4.1",        il_operand_kind::none           }, // 0x17
+        { L"ldc.i4.2",        il_operand_kind::none           }, // 0x18
+        { L"ldc.i4.3",        il_operand_kind::none           }, // 0x19
+        { L"ldc.i4.4",        il_operand_kind::none           }, // 0x1a
+        { L"ldc.i4.5",        il_operand_kind::none           }, // 0x1b
+        { L"ldc.i4.6",        il_operand_kind::none           }, // 0x1c
+        { L"ldc.i4.7",        il_operand_kind::none           }, // 0x1d
+        { L"ldc.i4.8",        il_operand_kind::none           }, // 0x1e
+        { L"ldc.i4.s",        il_operand_kind::int8           }, // 0x1f
+        { L"ldc.i4",          il_operand_kind::int32          }, // 0x20
+        { L"ldc.i8",          il_operand_kind::int64          }, // 0x21
+        { L"ldc.r4",          il_operand_kind::float32        }, // 0x22
+        { L"ldc.r8",          il_operand_kind::float64        }, // 0x23
+        { nullptr,            il_operand_kind::none           }, // 0x24
+        { L"dup",             il_operand_kind::none           }, // 0x25
+        { L"pop",             il_operand_kind::none           }, // 0x26
+        { L"jmp",             il_operand_kind::method         }, // 0x27
+        { L"call",            il_operand_kind::method         }, // 0x28
+        { L"calli",           il_operand_kind::signature      }, // 0x29
+        { L"ret",             il_operand_kind::none           }, // 0x2a
+        { L"br.s",            il_operand_kind::short_branch   }, // 0x2b
+        { L"brfalse.s",       il_operand_kind::short_branch   }, // 0x2c
+        { L"brtrue.s",        il_operand_kind::short_branch   }, // 0x2d
+        { L"beq.s",           il_operand_kind::short_branch   }, // 0x2e
+        { L"bge.s",           il_operand_kind::short_branch   }, // 0x2f
+        { L"bgt.s",           il_operand_kind::short_branch   }, // 0x30
+        { L"ble.s",           il_operand_kind::short_branch   }, // 0x31
+        { L"blt.s",           il_operand_kind::short_branch   }, // 0x32
+        { L"bne.un.s",        il_operand_kind::short_branch   }, // 0x33
+        { L"bge.un.s",        il_operand_kind::short_branch   }, // 0x34
+        { L"bgt.un.s",        il_operand_kind::short_branch   }, // 0x35
+        { L"ble.un.s",        il_operand_kind::short_branch   }, // 0x36
+        { L"blt.un.s",        il_operand_kind::short_branch   }, // 0x37
+        { L"br",              il_operand_kind::branch         }, // 0x38
+        { L"brfalse",         il_operand_kind::branch         }, // 0x39
+        { L"brtrue",          il_operand_kind::branch         }, // 0x3a
+        { L"beq",             il_operand_kind::branch         }, // 0x3b
+        { L"bge",             il_operand_kind::branch         }, // 0x3c
+        { L"bgt",             il_operand_kind::branch         }, // 0x3d
+        { L"ble",             il_operand_kind::branch         }, // 0x3e
+        { L"blt",             il_operand_kind::branch         }, // 0x3f
+        { L"bne.un",          il_operand_kind::branch         }, // 0x40
+        { L"bge.un",          il_operand_kind::branch         }, // 0x41
+        { L"bgt.un",          il_operand_kind::branch         }, // 0x42
+        { L"ble.un",          il_operand_kind::branch         }, // 0x43
+        { L"blt.un",          il_operand_kind::branch         }, // 0x44
+        { L"switch",          il_operand_kind::switch_table   }, // 0x45
+        { L"ldind.i1",        il_operand_kind::none           }, // 0x46
+        { L"ldind.u1",        il_operand_kind::none           }, // 0x47
+        { L"ldind.i2",        il_operand_kind::none           }, // 0x48
+        { L"ldind.u2",        il_operand_kind::none           }, // 0x49
+        { L"ldind.i4",        il_operand_kind::none           }, // 0x4a
+        { L"ldind.u4",        il_operand_kind::none           }, // 0x4b
+        { L"ldind.i8",        il_operand_kind::none           }, // 0x4c
+        { L"ldind.i",         il_operand_kind::none           }, // 0x4d
+        { L"ldind.r4",        il_operand_kind::none           }, // 0x4e
+        { L"ldind.r8",        il_operand_kind::none           }, // 0x4f
+        { L"ldind.ref",       il_operand_kind::none           }, // 0x50
+        { L"stind.ref",       il_operand_kind::none           }, // 0x51
+        { L"stind.i1",        il_operand_kind::none           }, // 0x52
+        { L"stind.i2",        il_operand_kind::none           }, // 0x53
+        { L"stind.i4",        il_operand_kind::none           }, // 0x54
+        { L"stind.i8",        il_operand_kind::none           }, // 0x55
+        { L"stind.r4",        il_operand_kind::none           }, // 0x56
+        { L"stind.r8",        il_operand_kind::none           }, // 0x57
+        { L"add",             il_operand_kind::none           }, // 0x58
+        { L"sub",             il_operand_kind::none           }, // 0x59
+        { L"mul",             il_operand_kind::none           }, // 0x5a
+        { L"div",             il_operand_kind::none           }, // 0x5b
+        { L"div.un",          il_operand_kind::none           }, // 0x5c
+        { L"rem",             il_operand_kind::none           }, // 0x5d
+        { L"rem.un",          il_operand_kind::none           }, // 0x5e
+        { L"and",             il_operand_kind::none           }, // 0x5f
+        { L"or",              il_operand_kind::none           }, // 0x60
+        { L"xor",             il_operand_kind::none           }, // 0x61
+        { L"shl",             il_operand_kind::none           }, // 0x62
+        { L"shr",             il_operand_kind::none           }, // 0x63
+        { L"shr.un",          il_operand_kind::none           }, // 0x64
+        { L"neg",             il_operand_kind::none           }, // 0x65
+        { L"not",             il_operand_kind::none           }, // 0x66
+        { L"conv.i1",         il_operand_kind::none           }, // 0x67
+        { L"conv.i2",         il_operand_kind::none           }, // 0x68
+        { L"conv.i4",         il_operand_kind::none           }, // 0x69
+        { L"conv.i8",         il_operand_kind::none           }, // 0x6a
+        { L"conv.r4",         il_operand_kind::none           }, // 0x6b
+        { L"conv.r8",         il_operand_kind::none           }, // 0x6c
+        { L"conv.u4",         il_operand_kind::none           }, // 0x6d
+        { L"conv.u8",         il_operand_kind::none           }, // 0x6e
+        { L"callvirt",        il_operand_kind::method         }, // 0x6f
+        { L"cpobj",           il_operand_kind::type           }, // 0x70
+        { L"ldobj",           il_operand_kind::type           }, // 0x71
+        { L"ldstr",           il_operand_kind::string         }, // 0x72
+        { L"newobj",          il_operand_kind::method         }, // 0x73
+        { L"castclass",       il_operand_kind::type           }, // 0x74
+        { L"isinst",          il_operand_kind::type           }, // 0x75
+        { L"conv.r.un",       il_operand_kind::none           }, // 0x76
+        { nullptr,            il_operand_kind::none           }, // 0x77
+        { nullptr,            il_operand_kind::none           }, // 0x78
+        { L"unbox",           il_operand_kind::type           }, // 0x79
+        { L"throw",           il_operand_kind::none           }, // 0x7a
+        { L"ldfld",           il_operand_kind::field          }, // 0x7b
+        { L"ldflda",          il_operand_kind::field          }, // 0x7c
+        { L"stfld",           il_operand_kind::field          }, // 0x7d
+        { L"ldsfld",          il_operand_kind::field          }, // 0x7e
+        { L"ldsflda",         il_operand_kind::field          }, // 0x7f
+        { L"stsfld",          il_operand_kind::field          }, // 0x80
+        { L"stobj",           il_operand_kind::type           }, // 0x81
+        { L"conv.ovf.i1.un",  il_operand_kind::none           }, // 0x82
+        { L"conv.ovf.i2.un",  il_operand_kind::none           }, // 0x83
+        { L"conv.ovf.i4.un",  il_operand_kind::none           }, // 0x84
+        { L"conv.ovf.i8.un",  il_operand_kind::none           }, // 0x85
+        { L"conv.ovf.u1.un",  il_operand_kind::none           }, // 0x86
+        { L"conv.ovf.u2.un",  il_operand_kind::none           }, // 0x87
+        { L"conv.ovf.u4.un",  il_operand_kind::none           }, // 0x88
+        { L"conv.ovf.u8.un",  il_operand_kind::none           }, // 0x89
+        { L"conv.ovf.i.un",   il_operand_kind::none           }, // 0x8a
+        { L"conv.ovf.u.un",   il_operand_kind::none           }, // 0x8b
+        { L"box",             il_operand_kind::type           }, // 0x8c
+        { L"newarr",          il_operand_kind::type           }, // 0x8d
+        { L"ldlen",           il_operand_kind::none           }, // 0x8e
+        { L"ldelema",         il_operand_kind::type           }, // 0x8f
+        { L"ldelem.i1",       il_operand_kind::none           }, // 0x90
+        { L"ldelem.u1",       il_operand_kind::none           }, // 0x91
+        { L"ldelem.i2",       il_operand_kind::none           }, // 0x92
+        { L"ldelem.u2",       il_operand_kind::none           }, // 0x93
+        { L"ldelem.i4",       il_operand_kind::none           }, // 0x94
+        { L"ldelem.u4",       il_operand_kind::none           }, // 0x95
+        { L"ldelem.i8",       il_operand_kind::none           }, // 0x96
+        { L"ldelem.i",        il_operand_kind::none           }, // 0x97
+        { L"ldelem.r4",       il_operand_kind::none           }, // 0x98
+        { L"ldelem.r8",       il_operand_kind::none           }, // 0x99
+        { L"ldelem.ref",      il_operand_kind::none           }, // 0x9a
+        { L"stelem.i",        il_operand_kind::none           }, // 0x9b
+        { L"stelem.i1",       il_operand_kind::none           }, // 0x9c
+        { L"stelem.i2",       il_operand_kind::none           }, // 0x9d
+        { L"stelem.i4",       il_operand_kind::none           }, // 0x9e
+        { L"stelem.i8",       il_operand_kind::none           }, // 0x9f
+        { L"stelem.r4",       il_operand_kind::none           }, // 0xa0
+        { L"stelem.r8",       il_operand_kind::none           }, // 0xa1
+        { L"stelem.ref",      il_operand_kind::none           }, // 0xa2
+        { L"ldelem",          il_operand_kind::type           }, // 0xa3
+        { L"stelem",          il_operand_kind::type           }, // 0xa4
+        { L"unbox.any",       il_operand_kind::type           }, // 0xa5
+        { nullptr,            il_operand_kind::none           }, // 0xa6
+        { nullptr,            il_operand_kind::none           }, // 0xa7
+        { nullptr,            il_operand_kind::none           }, // 0xa8
+        { nullptr,            il_operand_kind::none           }, // 0xa9
+        { nullptr,            il_operand_kind::none           }, // 0xaa
+        { nullptr,            il_operand_kind::none           }, // 0xab
+        { nullptr,            il_operand_kind::none           }, // 0xac
+        { nullptr,            il_operand_kind::none           }, // 0xad
+        { nullptr,            il_operand_kind::none           }, // 0xae
+        { nullptr,            il_operand_kind::none           }, // 0xaf
+        { nullptr,            il_operand_kind::none           }, // 0xb0
+        { nullptr,            il_operand_kind::none           }, // 0xb1
+        { nullptr,            il_operand_kind::none           }, // 0xb2
+        { L"conv.ovf.i1",     il_operand_kind::none           }, // 0xb3
+        { L"conv.ovf.u1",     il_operand_kind::none           }, // 0xb4
+        { L"conv.ovf.i2",     il_operand_kind::none           }, // 0xb5
+        { L"conv.ovf.u2",     il_operand_kind::none           }, // 0xb6
+        { L"conv.ovf.i4",     il_operand_kind::none           }, // 0xb7
+        { L"conv.ovf.u4",     il_operand_kind::none           }, // 0xb8
+        { L"conv.ovf.i8",     il_operand_kind::none           }, // 0xb9
+        { L"conv.ovf.u8",     il_operand_kind::none           }, // 0xba
+        { nullptr,            il_operand_kind::none           }, // 0xbb
+        { nullptr,            il_operand_kind::none           }, // 0xbc
+        { nullptr,            il_operand_kind::none           }, // 0xbd
+        { nullptr,            il_operand_kind::none           }, // 0xbe
+        { nullptr,            il_operand_kind::none           }, // 0xbf
+        { nullptr,            il_operand_kind::none           }, // 0xc0
+        { nullptr,            il_operand_kind::none           }, // 0xc1
+        { L"refanyval",       il_operand_kind::type           }, // 0xc2
+        { L"ckfinite",        il_operand_kind::none           }, // 0xc3
+        { nullptr,            il_operand_kind::none           }, // 0xc4
+        { nullptr,            il_operand_kind::none           }, // 0xc5
+        { L"mkrefany",        il_operand_kind::type           }, // 0xc6
+        { nullptr,            il_operand_kind::none           }, // 0xc7
+        { nullptr,            il_operand_kind::none           }, // 0xc8
+        { nullptr,            il_operand_kind::none           }, // 0xc9
+        { nullptr,            il_operand_kind::none           }, // 0xca
+        { nullptr,            il_operand_kind::none           }, // 0xcb
+        { nullptr,            il_operand_kind::none           }, // 0xcc
+        { nullptr,            il_operand_kind::none           }, // 0xcd
+        { nullptr,            il_operand_kind::none           }, // 0xce
+        { nullptr,            il_operand_kind::none           }, // 0xcf
+        { L"ldtoken",         il_operand_kind::token          }, // 0xd0
+        { L"conv.u2",         il_operand_kind::none           }, // 0xd1
+        { L"conv.u1",         il_operand_kind::none           }, // 0xd2
+        { L"conv.i",          il_operand_kind::none           }, // 0xd3
+        { L"conv.ovf.i",      il_operand_kind::none           }, // 0xd4
+        { L"conv.ovf.u",      il_operand_kind::none           }, // 0xd5
+        { L"add.ovf",         il_operand_kind::none           }, // 0xd6
+        { L"add.ovf.un",      il_operand_kind::none           }, // 0xd7
+        { L"mul.ovf",         il_operand_kind::none           }, // 0xd8
+        { L"mul.ovf.un",      il_operand_kind::none           }, // 0xd9
+        { L"sub.ovf",         il_operand_kind::none           }, // 0xda
+        { L"sub.ovf.un",      il_operand_kind::none           }, // 0xdb
+        { L"endfinally",      il_operand_kind::none           }, // 0xdc
+        { L"leave",           il_operand_kind::branch         }, // 0xdd
+        { L"leave.s",         il_operand_kind::short_branch   }, // 0xde
+        { L"stind.i",         il_operand_kind::none           }, // 0xdf
+        { L"conv.u",          il_operand_kind::none           }, // 0xe0
+    };
+
+    /// The two-byte opcodes, indexed by the byte that follows the `0xfe` prefix
+    opcode_descriptor const two_byte_opcodes[0x1f] =
+    {
+        { L"arglist",       il_operand_kind::none           }, // 0x00
+        { L"ceq",           il_operand_kind::none           }, // 0x01
+        { L"cgt",           il_operand_kind::none           }, // 0x02
+        { L"cgt.un",        il_operand_kind::none           }, // 0x03
+        { L"clt",           il_operand_kind::none           }, // 0x04
+        { L"clt.un",        il_operand_kind::none           }, // 0x05
+        { L"ldftn",         il_operand_kind::method         }, // 0x06
+        { L"ldvirtftn",     il_operand_kind::method         }, // 0x07
+        { nullptr,          il_operand_kind::none           }, // 0x08
+        { L"ldarg",         il_operand_kind::variable       }, // 0x09
+        { L"ldarga",        il_operand_kind::variable       }, // 0x0a
+        { L"starg",         il_operand_kind::variable       }, // 0x0b
+        { L"ldloc",         il_operand_kind::variable       }, // 0x0c
+        { L"ldloca",        il_operand_kind::variable       }, // 0x0d
+        { L"stloc",         il_operand_kind::variable       }, // 0x0e
+        { L"localloc",      il_operand_kind::none           }, // 0x0f
+        { nullptr,          il_operand_kind::none           }, // 0x10
+        { L"endfilter",     il_operand_kind::none           }, // 0x11
+        { L"unaligned.",    il_operand_kind::int8           }, // 0x12
+        { L"volatile.",     il_operand_kind::none           }, // 0x13
+        { L"tail.",         il_operand_kind::none           }, // 0x14
+        { L"initobj",       il_operand_kind::type           }, // 0x15
+        { L"constrained.",  il_operand_kind::type           }, // 0x16
+        { L"cpblk",         il_operand_kind::none           }, // 0x17
+        { L"initblk",       il_operand_kind::none           }, // 0x18
+        { L"no.",           il_operand_kind::int8           }, // 0x19
+        { L"rethrow",       il_operand_kind::none           }, // 0x1a
+        { nullptr,          il_operand_kind::none           }, // 0x1b
+        { L"sizeof",        il_operand_kind::type           }, // 0x1c
+        { L"refanytype",    il_operand_kind::none           }, // 0x1d
+        { L"readonly.",     il_operand_kind::none           }, // 0x1e
+    };
+
+    /// The prefix byte of the two-byte opcodes
+    std::uint8_t const two_byte_opcode_prefix(0xfe);
+
+    /// Finds the descriptor for `opcode`; returns `nullptr` if `opcode` is not a valid opcode
+    auto find_opcode(std::uint16_t const opcode) -> opcode_descriptor const*
+    {
+        opcode_descriptor const* descriptor(nullptr);
+        if ((opcode >> 8) == two_byte_opcode_prefix)
+        {
+            if ((opcode & 0xff) < sizeof two_byte_opcodes / sizeof two_byte_opcodes[0])
+                descriptor = &two_byte_opcodes[opcode & 0xff];
+        }
+        else if (opcode <= 0xff)
+        {
+            descriptor = &one_byte_opcodes[opcode];
+        }
+
+        return descriptor != nullptr && descriptor->name != nullptr ? descriptor : nullptr;
+    }
+
+    /// Reads a `T` at `offset` bytes past `first`, throwing if it would extend beyond `last`
+    template <typename T>
+    auto read_at(core::const_byte_iterator const first,
+                 core::const_byte_iterator const last,
+                 core::size_type           const offset) -> T
+    {
+        if (core::distance(first, last) < offset + sizeof(T))
+            throw core::metadata_error(L"invalid read:  method body is truncated");
+
+        return detail::peek_sig_element<T>(first + offset, last);
+    }
+
+    // Method header flags (ECMA 335-2010 II.25.4.4)
+    std::uint8_t  const tiny_format_header(0x02);
+    std::uint8_t  const fat_format_header (0x03);
+    std::uint8_t  const header_format_mask(0x03);
+    std::uint16_t const more_sections     (0x08);
+    std::uint16_t const init_locals_flag  (0x10);
+
+    // Method data section flags (ECMA 335-2010 II.25.4.5)
+    std::uint8_t const section_eh_table    (0x01);
+    std::uint8_t const section_fat_format  (0x40);
+    std::uint8_t const section_more_sections(0x80);
+
+    core::size_type const small_clause_size(12);
+    core::size_type const fat_clause_size  (24);
+
+    /// Computes the offset of the next four-byte-aligned RVA at or after `offset` bytes into the
+    /// method body at `rva`.  Data sections are aligned by RVA, not by offset within the body.
+    auto align_section_offset(core::size_type const rva, core::size_type const offset) -> core::size_type
+    {
+        return ((rva + offset + 3) & ~static_cast<core::size_type>(3)) - rva;
+    }
+
+} } }
+
+namespace cxxreflect { namespace metadata {
+
+    il_instruction::il_instruction()
+    {
+    }
+
+    il_instruction::il_instruction(database                  const* const scope,
+                                   core::const_byte_iterator        const code,
+                                   core::const_byte_iterator        const first,
+                                   core::const_byte_iterator        const last,
+                                   core::internal_key)
+        : _scope(scope), _code(code), _first(first)
+    {
+        core::assert_not_null(scope);
+        core::assert_not_null(code);
+        core::assert_not_null(first);
+        core::assert_not_null(last);
+
+        if (first == last)
+            throw core::metadata_error(L"invalid read:  method body is truncated");
+
+        core::const_byte_iterator operand(first + 1);
+        std::uint16_t opcode(*first);
+        if (opcode == two_byte_opcode_prefix)
+        {
+            if (operand == last)
+                throw core::metadata_error(L"invalid read:  method body is truncated");
+
+            opcode = static_cast<std::uint16_t>((opcode << 8) | *operand++);
+        }
+
+        opcode_descriptor const* const descriptor(find_opcode(opcode));
+        if (descriptor == nullptr)
+            throw core::metadata_error(L"invalid CIL opcode");
+
+        core::size_type const remaining(core::distance(operand, last));
+
+        core::size_type operand_size(0);
+        switch (descriptor->operand_kind)
+        {
+        case il_operand_kind::none:
+            break;
+
+        case il_operand_kind::int8:
+        case il_operand_kind::short_variable:
+        case il_operand_kind::short_branch:
+            operand_size = 1;
+            break;
+
+        case il_operand_kind::variable:
+            operand_size = 2;
+            break;
+
+        case il_operand_kind::int64:
+        case il_operand_kind::float64:
+            operand_size = 8;
+            break;
+
+        case il_operand_kind::switch_table:
+        {
+            // The number of targets is followed by a four-byte offset for each target; we check
+            // the count against the remaining bytes before multiplying so that it cannot overflow:
+            std::uint32_t const count(read_at<std::uint32_t>(operand, last, 0));
+            if (count > (remaining - sizeof(std::uint32_t)) / sizeof(std::int32_t))
+                throw core::metadata_error(L"invalid read:  method body is truncated");
+
+            operand_size = sizeof(std::uint32_t) + count * sizeof(std::int32_t);
+            break;
+        }
+
+        default:
+            operand_size = 4;
+            break;
+        }
+
+        if (remaining < operand_size)
+            throw core::metadata_error(L"invalid read:  method body is truncated");
+
+        _operand.get()      = operand;
+        _next.get()         = operand + operand_size;
+        _opcode.get()       = opcode;
+        _operand_kind.get() = descriptor->operand_kind;
+    }
+
+    auto il_instruction::offset() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return core::distance(_code.get(), _first.get());
+    }
+
+    auto il_instruction::size() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return core::distance(_first.get(), _next.get());
+    }
+
+    auto il_instruction::opcode() const -> std::uint16_t
+    {
+        core::assert_initialized(*this);
+        return _opcode.get();
+    }
+
+    auto il_instruction::name() const -> core::string_reference
+    {
+        core::assert_initialized(*this);
+        return find_opcode(_opcode.get())->name;
+    }
+
+    auto il_instruction::operand_kind() const -> il_operand_kind
+    {
+        core::assert_initialized(*this);
+        return _operand_kind.get();
+    }
+
+    auto il_instruction::integer_operand() const -> std::int64_t
+    {
+        switch (operand_kind())
+        {
+        case il_operand_kind::int8:  return read_operand<std::int8_t>();
+        case il_operand_kind::int32: return read_operand<std::int32_t>();
+        case il_operand_kind::int64: return read_operand<std::int64_t>();
+        default: throw core::runtime_error(L"attempted an invalid reinterpretation");
+        }
+    }
+
+    auto il_instruction::float_operand() const -> double
+    {
+        switch (operand_kind())
+        {
+        case il_operand_kind::float32: return read_operand<float>();
+        case il_operand_kind::float64: return read_operand<double>();
+        default: throw core::runtime_error(L"attempted an invalid reinterpretation");
+        }
+    }
+
+    auto il_instruction::variable_operand() const -> core::size_type
+    {
+        switch (operand_kind())
+        {
+        case il_operand_kind::short_variable: return read_operand<std::uint8_t>();
+        case il_operand_kind::variable:       return read_operand<std::uint16_t>();
+        default: throw core::runtime_error(L"attempted an invalid reinterpretation");
+        }
+    }
+
+    auto il_instruction::branch_target() const -> core::size_type
+    {
+        core::difference_type delta(0);
+        switch (operand_kind())
+        {
+        case il_operand_kind::short_branch: delta = read_operand<std::int8_t>();  break;
+        case il_operand_kind::branch:       delta = read_operand<std::int32_t>(); break;
+        default: throw core::runtime_error(L"attempted an invalid reinterpretation");
+        }
+
+        // Branch targets are relative to the start of the next instruction:
+        core::difference_type const target(static_cast<core::difference_type>(core::distance(_code.get(), _next.get())) + delta);
+        if (target < 0)
+            throw core::metadata_error(L"branch target is before the start of the method body");
+
+        return core::convert_integer(target);
+    }
+
+    auto il_instruction::switch_target_count() const -> core::size_type
+    {
+        if (operand_kind() != il_operand_kind::switch_table)
+            throw core::runtime_error(L"attempted an invalid reinterpretation");
+
+        return read_operand<std::uint32_t>();
+    }
+
+    auto il_instruction::switch_target(core::size_type const index) const -> core::size_type
+    {
+        if (index >= switch_target_count())
+            throw core::logic_error(L"attempted to get switch target for out-of-range index");
+
+        std::int32_t const delta(read_operand<std::int32_t>(sizeof(std::uint32_t) + index * sizeof(std::int32_t)));
+
+        // Switch targets are relative to the start of the next instruction:
+        core::difference_type const target(static_cast<core::difference_type>(core::distance(_code.get(), _next.get())) + delta);
+        if (target < 0)
+            throw core::metadata_error(L"switch target is before the start of the method body");
+
+        return core::convert_integer(target);
+    }
+
+    auto il_instruction::token_operand() const -> unrestricted_token
+    {
+        switch (operand_kind())
+        {
+        case il_operand_kind::method:
+        case il_operand_kind::field:
+        case il_operand_kind::type:
+        case il_operand_kind::token:
+        case il_operand_kind::signature:
+            break;
+
+        default:
+            throw core::runtime_error(L"attempted an invalid reinterpretation");
+        }
+
+        std::uint32_t const value(read_operand<std::uint32_t>());
+        if (!is_valid_table_id(value >> 24) || (value & 0x00ffffff) == 0)
+            throw core::metadata_error(L"invalid token operand");
+
+        return unrestricted_token(_scope.get(), value);
+    }
+
+    auto il_instruction::string_operand() const -> core::string_reference
+    {
+        return _scope->user_strings()[string_operand_index()];
+    }
+
+    auto il_instruction::string_operand_index() const -> core::size_type
+    {
+        if (operand_kind() != il_operand_kind::string)
+            throw core::runtime_error(L"attempted an invalid reinterpretation");
+
+        // A string token has a "table" of 0x70 and an offset into the user string heap:
+        std::uint32_t const value(read_operand<std::uint32_t>());
+        if ((value >> 24) != 0x70)
+            throw core::metadata_error(L"invalid string token operand");
+
+        return value & 0x00ffffff;
+    }
+
+    auto il_instruction::is_initialized() const -> bool
+    {
+        return _scope.is_initialized();
+    }
+
+    auto il_instruction::operator!() const -> bool
+    {
+        return !is_initialized();
+    }
+
+    template <typename T>
+    auto il_instruction::read_operand(core::size_type const offset) const -> T
+    {
+        return read_at<T>(_operand.get(), _next.get(), offset);
+    }
+
+
+
+
+
+    il_instruction_iterator::il_instruction_iterator()
+    {
+    }
+
+    il_instruction_iterator::il_instruction_iterator(database                  const* const scope,
+                                                     core::const_byte_iterator        const code,
+                                                     core::const_byte_iterator        const current,
+                                                     core::const_byte_iterator        const last,
+                                                     core::internal_key)
+        : _scope(scope), _code(code), _current(current), _last(last)
+    {
+        core::assert_not_null(scope);
+
+        if (current != last)
+            _value = il_instruction(scope, code, current, last, core::internal_key());
+    }
+
+    auto il_instruction_iterator::operator*() const -> reference
+    {
+        core::assert_true([&]{ return _current.get() != _last.get(); });
+        return _value;
+    }
+
+    auto il_instruction_iterator::operator->() const -> pointer
+    {
+        core::assert_true([&]{ return _current.get() != _last.get(); });
+        return &_value;
+    }
+
+    auto il_instruction_iterator::operator++() -> il_instruction_iterator&
+    {
+        core::assert_true([&]{ return _current.get() != _last.get(); });
+
+        _current.get() += _value.size();
+        _value = _current.get() != _last.get()
+            ? il_instruction(_scope.get(), _code.get(), _current.get(), _last.get(), core::internal_key())
+            : il_instruction();
+
+        return *this;
+    }
+
+    auto il_instruction_iterator::operator++(int) -> il_instruction_iterator
+    {
+        il_instruction_iterator const it(*this);
+        ++*this;
+        return it;
+    }
+
+
+
+
+
+    exception_clause::exception_clause()
+    {
+    }
+
+    exception_clause::exception_clause(database                  const* const scope,
+                                       core::const_byte_iterator        const data,
+                                       bool                             const is_fat,
+                                       core::internal_key)
+        : _scope(scope)
+    {
+        core::assert_not_null(scope);
+        core::assert_not_null(data);
+
+        if (is_fat)
+        {
+            core::const_byte_iterator const last(data + fat_clause_size);
+            _kind.get()                         = static_cast<exception_clause_kind>(read_at<std::uint32_t>(data, last, 0));
+            _try_offset.get()                   = read_at<std::uint32_t>(data, last, 4);
+            _try_length.get()                   = read_at<std::uint32_t>(data, last, 8);
+            _handler_offset.get()               = read_at<std::uint32_t>(data, last, 12);
+            _handler_length.get()               = read_at<std::uint32_t>(data, last, 16);
+            _class_token_or_filter_offset.get() = read_at<std::uint32_t>(data, last, 20);
+        }
+        else
+        {
+            core::const_byte_iterator const last(data + small_clause_size);
+            _kind.get()                         = static_cast<exception_clause_kind>(read_at<std::uint16_t>(data, last, 0));
+            _try_offset.get()                   = read_at<std::uint16_t>(data, last, 2);
+            _try_length.get()                   = read_at<std::uint8_t >(data, last, 4);
+            _handler_offset.get()               = read_at<std::uint16_t>(data, last, 5);
+            _handler_length.get()               = read_at<std::uint8_t >(data, last, 7);
+            _class_token_or_filter_offset.get() = read_at<std::uint32_t>(data, last, 8);
+        }
+    }
+
+    auto exception_clause::kind() const -> exception_clause_kind
+    {
+        core::assert_initialized(*this);
+        return _kind.get();
+    }
+
+    auto exception_clause::try_offset() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return _try_offset.get();
+    }
+
+    auto exception_clause::try_length() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return _try_length.get();
+    }
+
+    auto exception_clause::handler_offset() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return _handler_offset.get();
+    }
+
+    auto exception_clause::handler_length() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return _handler_length.get();
+    }
+
+    auto exception_clause::catch_type() const -> type_def_ref_spec_token
+    {
+        if (kind() != exception_clause_kind::exception)
+            throw core::runtime_error(L"attempted an invalid reinterpretation");
+
+        std::uint32_t const value(_class_token_or_filter_offset.get());
+        table_id      const table(static_cast<table_id>(value >> 24));
+        if ((table != table_id::type_def && table != table_id::type_ref && table != table_id::type_spec)
+            || (value & 0x00ffffff) == 0)
+            throw core::metadata_error(L"invalid exception clause class token");
+
+        return type_def_ref_spec_token(_scope.get(), value);
+    }
+
+    auto exception_clause::filter_offset() const -> core::size_type
+    {
+        if (kind() != exception_clause_kind::filter)
+            throw core::runtime_error(L"attempted an invalid reinterpretation");
+
+        return _class_token_or_filter_offset.get();
+    }
+
+    auto exception_clause::is_initialized() const -> bool
+    {
+        return _scope.is_initialized();
+    }
+
+
+
+
+
+    method_body::method_body()
+    {
+    }
+
+    method_body::method_body(method_def_token const& method)
+    {
+        core::assert_initialized(method);
+
+        core::size_type const rva(row_from(method).rva());
+        if (rva == 0)
+            return;
+
+        core::const_byte_range    const body(method.scope().map_rva(core::convert_integer(rva)));
+        core::const_byte_iterator const first(body.begin());
+        core::const_byte_iterator const last(body.end());
+
+        std::uint8_t const header_byte(read_at<std::uint8_t>(first, last, 0));
+
+        core::size_type header_size(0);
+        core::size_type code_size(0);
+        std::uint16_t   flags(0);
+        std::uint32_t   local_signature(0);
+        switch (header_byte & header_format_mask)
+        {
+        case tiny_format_header:
+        {
+            // The tiny header is a single byte; the upper six bits are the code size:
+            header_size = 1;
+            code_size = header_byte >> 2;
+            _max_stack.get() = 8;
+            break;
+        }
+
+        case fat_format_header:
+        {
+            // The upper four bits of the first two bytes are the size of the header in dwords:
+            std::uint16_t const flags_and_size(read_at<std::uint16_t>(first, last, 0));
+            flags = flags_and_size & 0x0fff;
+            header_size = (flags_and_size >> 12) * 4;
+            if (header_size < 12)
+                throw core::metadata_error(L"invalid fat method header size");
+
+            _max_stack.get() = read_at<std::uint16_t>(first, last, 2);
+            code_size        = read_at<std::uint32_t>(first, last, 4);
+            local_signature  = read_at<std::uint32_t>(first, last, 8);
+            break;
+        }
+
+        default:
+            throw core::metadata_error(L"invalid method header format");
+        }
+
+        if (core::distance(first, last) < header_size + code_size)
+            throw core::metadata_error(L"invalid read:  method body is truncated");
+
+        if (local_signature != 0)
+        {
+            if (static_cast<table_id>(local_signature >> 24) != table_id::standalone_sig)
+                throw core::metadata_error(L"invalid local variable signature token");
+
+            _local_signature = standalone_sig_token(&method.scope(), local_signature);
+        }
+
+        _scope.get()       = &method.scope();
+        _code              = core::const_byte_range(first + header_size, first + header_size + code_size);
+        _init_locals.get() = (flags & init_locals_flag) != 0;
+
+        // The data sections follow the code.  Only exception handling sections are defined; like
+        // the runtime, we use the first one and ignore any others:
+        bool has_more_sections((flags & more_sections) != 0);
+        core::size_type section_offset(header_size + code_size);
+        while (has_more_sections)
+        {
+            section_offset = align_section_offset(rva, section_offset);
+
+            std::uint8_t const section_kind(read_at<std::uint8_t>(first, last, section_offset));
+            bool const is_fat((section_kind & section_fat_format) != 0);
+
+            // A fat section has a three-byte size; a small section has a one-byte size:
+            core::size_type const section_size(is_fat
+                ? read_at<std::uint32_t>(first, last, section_offset) >> 8
+                : read_at<std::uint8_t >(first, last, section_offset + 1));
+
+            if (section_size < 4 || core::distance(first, last) < section_offset + section_size)
+                throw core::metadata_error(L"invalid method data section size");
+
+            if ((section_kind & section_eh_table) != 0 && !_clauses.get())
+            {
+                _clauses.get()         = first + section_offset + 4;
+                _clause_count.get()    = (section_size - 4) / (is_fat ? fat_clause_size : small_clause_size);
+                _clauses_are_fat.get() = is_fat;
+            }
+
+            has_more_sections = (section_kind & section_more_sections) != 0;
+            section_offset += section_size;
+        }
+    }
+
+    auto method_body::scope() const -> database const&
+    {
+        core::assert_initialized(*this);
+        return *_scope;
+    }
+
+    auto method_body::max_stack() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return _max_stack.get();
+    }
+
+    auto method_body::init_locals() const -> bool
+    {
+        core::assert_initialized(*this);
+        return _init_locals.get();
+    }
+
+    auto method_body::local_signature() const -> standalone_sig_token
+    {
+        core::assert_initialized(*this);
+        return _local_signature;
+    }
+
+    auto method_body::code() const -> core::const_byte_range
+    {
+        core::assert_initialized(*this);
+        return _code;
+    }
+
+    auto method_body::instructions() const -> instruction_range
+    {
+        core::assert_initialized(*this);
+        return instruction_range(
+            instruction_iterator(_scope.get(), _code.begin(), _code.begin(), _code.end(), core::internal_key()),
+            instruction_iterator(_scope.get(), _code.begin(), _code.end(),   _code.end(), core::internal_key()));
+    }
+
+    auto method_body::exception_clause_count() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return _clause_count.get();
+    }
+
+    auto method_body::get_exception_clause(core::size_type const index) const -> exception_clause
+    {
+        if (index >= exception_clause_count())
+            throw core::logic_error(L"attempted to get exception clause for out-of-range index");
+
+        core::size_type const clause_size(_clauses_are_fat.get() ? fat_clause_size : small_clause_size);
+        return exception_clause(_scope.get(), _clauses.get() + index * clause_size, _clauses_are_fat.get(), core::internal_key());
+    }
+
+    auto method_body::is_initialized() const -> bool
+    {
+        return _scope.is_initialized();
+    }
+
+    auto method_body::operator!() const -> bool
+    {
+        return !is_initialized();
+    }
+
+} }
@@ -0,0 +1,299 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#ifndef CXXREFLECT_METADATA_METHOD_BODY_HPP_
+#define CXXREFLECT_METADATA_METHOD_BODY_HPP_
+
+#include "cxxreflect/metadata/tokens.hpp"
+
+namespace cxxreflect { namespace metadata {
+
+    /// \defgroup cxxreflect_metadata_method_body Metadata -> Method Bodies
+    ///
+    /// Types for reading CIL method bodies (ECMA 335-2010 II.25.4) and the instructions they
+    /// contain (ECMA 335-2010 Partition III)
+    ///
+    /// A method body is read in place from the PE file that contains its metadata database; none of
+    /// these types copy the image or allocate.  Instructions are decoded one at a time as they are
+    /// iterated, and token operands are not resolved until they are requested.
+    ///
+    /// @{
+
+
+
+
+
+    /// The encoding of the operand of a CIL instruction
+    ///
+    /// The comment on each enumerator names the operand type used in the CLI specification.
+    enum class il_operand_kind : std::uint8_t
+    {
+        none,           ///< InlineNone
+        int8,           ///< ShortInlineI
+        int32,          ///< InlineI
+        int64,          ///< InlineI8
+        float32,        ///< ShortInlineR
+        float64,        ///< InlineR
+        short_variable, ///< ShortInlineVar (an 8-bit argument or local variable index)
+        variable,       ///< InlineVar (a 16-bit argument or local variable index)
+        short_branch,   ///< ShortInlineBrTarget
+        branch,         ///< InlineBrTarget
+        switch_table,   ///< InlineSwitch
+        method,         ///< InlineMethod
+        field,          ///< InlineField
+        type,           ///< InlineType
+        token,          ///< InlineTok
+        string,         ///< InlineString
+        signature       ///< InlineSig
+    };
+
+
+
+
+
+    /// A single CIL instruction in a method body
+    ///
+    /// An instruction is a view of its bytes in the method body.  The opcode is decoded when the
+    /// instruction is constructed; the operand is not decoded until one of the operand accessors
+    /// is called.  Each operand accessor throws a `runtime_error` if the operand of the instruction
+    /// does not have a corresponding kind.
+    class il_instruction
+    {
+    public:
+
+        il_instruction();
+
+        /// Decodes the instruction at `first`; `code` is the first byte of the method's code
+        ///
+        /// Throws a `metadata_error` if the opcode is invalid or if the instruction extends beyond
+        /// `last`.
+        il_instruction(database                  const* scope,
+                       core::const_byte_iterator        code,
+                       core::const_byte_iterator        first,
+                       core::const_byte_iterator        last,
+                       core::internal_key);
+
+        /// Gets the offset of the instruction from the start of the method's code
+        auto offset() const -> core::size_type;
+
+        /// Gets the size of the instruction, including its opcode and operand, in bytes
+        auto size() const -> core::size_type;
+
+        /// Gets the opcode of the instruction; two-byte opcodes include their `0xfe` prefix byte
+        auto opcode()       const -> std::uint16_t;
+        auto name()         const -> core::string_reference;
+        auto operand_kind() const -> il_operand_kind;
+
+        /// Gets the operand of an `int8`, `int32`, or `int64` instruction, sign-extended
+        auto integer_operand() const -> std::int64_t;
+
+        /// Gets the operand of a `float32` or `float64` instruction
+        auto float_operand() const -> double;
+
+        /// Gets the argument or local variable index of a `short_variable` or `variable` instruction
+        auto variable_operand() const -> core::size_type;
+
+        /// Gets the target of a `short_branch` or `branch` instruction, as an offset from the start
+        /// of the method's code
+        auto branch_target() const -> core::size_type;
+
+        /// Gets the targets of a `switch_table` instruction, as offsets from the start of the
+        /// method's code
+        auto switch_target_count()                const -> core::size_type;
+        auto switch_target(core::size_type index) const -> core::size_type;
+
+        /// Gets the token operand of a `method`, `field`, `type`, `token`, or `signature`
+        /// instruction, in the scope of the method body.  Throws a `metadata_error` if the token
+        /// does not refer to a metadata table.
+        auto token_operand() const -> unrestricted_token;
+
+        /// Gets the string loaded by a `string` instruction, which is a view of the user string
+        /// heap and is not null-terminated (see `database_user_string_collection`)
+        auto string_operand() const -> core::string_reference;
+
+        /// Gets the index in the user string heap of the string loaded by a `string` instruction
+        auto string_operand_index() const -> core::size_type;
+
+        auto is_initialized() const -> bool;
+        auto operator!()      const -> bool;
+
+        CXXREFLECT_GENERATE_SAFE_BOOL_CONVERSION(il_instruction)
+
+    private:
+
+        template <typename T>
+        auto read_operand(core::size_type offset = 0) const -> T;
+
+        core::checked_pointer<database const>              _scope;
+        core::value_initialized<core::const_byte_iterator> _code;
+        core::value_initialized<core::const_byte_iterator> _first;
+        core::value_initialized<core::const_byte_iterator> _operand;
+        core::value_initialized<core::const_byte_iterator> _next;
+        core::value_initialized<std::uint16_t>             _opcode;
+        core::value_initialized<il_operand_kind>           _operand_kind;
+    };
+
+
+
+
+
+    /// A forward iterator over the instructions of a method body
+    ///
+    /// Instructions are of variable length, so the iterator decodes each instruction as it advances
+    /// to it.  Dereferencing the iterator yields a reference to an instruction owned by the
+    /// iterator, which is valid until the iterator is advanced.
+    class il_instruction_iterator
+    {
+    public:
+
+        typedef il_instruction            value_type;
+        typedef il_instruction const&     reference;
+        typedef il_instruction const*     pointer;
+        typedef std::ptrdiff_t            difference_type;
+        typedef std::forward_iterator_tag iterator_category;
+
+        il_instruction_iterator();
+        il_instruction_iterator(database                  const* scope,
+                                core::const_byte_iterator        code,
+                                core::const_byte_iterator        current,
+                                core::const_byte_iterator        last,
+                                core::internal_key);
+
+        auto operator*()  const -> reference;
+        auto operator->() const -> pointer;
+
+        auto operator++()    -> il_instruction_iterator&;
+        auto operator++(int) -> il_instruction_iterator;
+
+        friend auto operator==(il_instruction_iterator const& lhs, il_instruction_iterator const& rhs) -> bool
+        {
+            return lhs._current.get() == rhs._current.get();
+        }
+
+        CXXREFLECT_GENERATE_EQUALITY_OPERATORS(il_instruction_iterator)
+
+    private:
+
+        core::checked_pointer<database const>              _scope;
+        core::value_initialized<core::const_byte_iterator> _code;
+        core::value_initialized<core::const_byte_iterator> _current;
+        core::value_initialized<core::const_byte_iterator> _last;
+        il_instruction                                     _value;
+    };
+
+
+
+
+
+    /// The kind of an exception handling clause (ECMA 335-2010 II.25.4.6)
+    enum class exception_clause_kind : std::uint32_t
+    {
+        exception = 0x0000,
+        filter    = 0x0001,
+        finally   = 0x0002,
+        fault     = 0x0004
+    };
+
+
+
+
+
+    /// An exception handling clause of a method body
+    ///
+    /// Clauses are stored in either a small or a fat format; both are decoded into this type.  All
+    /// offsets are from the start of the method's code.
+    class exception_clause
+    {
+    public:
+
+        exception_clause();
+        exception_clause(database const* scope, core::const_byte_iterator data, bool is_fat, core::internal_key);
+
+        auto kind()           const -> exception_clause_kind;
+        auto try_offset()     const -> core::size_type;
+        auto try_length()     const -> core::size_type;
+        auto handler_offset() const -> core::size_type;
+        auto handler_length() const -> core::size_type;
+
+        /// Gets the type of exception caught by an `exception` clause
+        auto catch_type() const -> type_def_ref_spec_token;
+
+        /// Gets the offset of the filter block of a `filter` clause
+        auto filter_offset() const -> core::size_type;
+
+        auto is_initialized() const -> bool;
+
+    private:
+
+        core::checked_pointer<database const>          _scope;
+        core::value_initialized<exception_clause_kind> _kind;
+        core::value_initialized<core::size_type>       _try_offset;
+        core::value_initialized<core::size_type>       _try_length;
+        core::value_initialized<core::size_type>       _handler_offset;
+        core::value_initialized<core::size_type>       _handler_length;
+        core::value_initialized<std::uint32_t>         _class_token_or_filter_offset;
+    };
+
+
+
+
+
+    /// The body of a method, read from the PE file that contains the method's metadata
+    ///
+    /// The header is decoded when the body is constructed; the code and exception handling clauses
+    /// are left in place in the image and decoded on request.  Only the first exception handling
+    /// data section is used, as the runtime does.
+    class method_body
+    {
+    public:
+
+        typedef il_instruction_iterator                    instruction_iterator;
+        typedef core::iterator_range<instruction_iterator> instruction_range;
+
+        method_body();
+
+        /// Reads the body of `method`
+        ///
+        /// A method that has no body (e.g. an abstract method, or a method implemented by the
+        /// runtime) has an RVA of zero; its body is uninitialized.  Throws a `metadata_error` if
+        /// the body is malformed.
+        explicit method_body(method_def_token const& method);
+
+        auto scope() const -> database const&;
+
+        auto max_stack()   const -> core::size_type;
+        auto init_locals() const -> bool;
+
+        /// Gets the signature of the local variables; uninitialized if there are no locals
+        auto local_signature() const -> standalone_sig_token;
+
+        auto code()         const -> core::const_byte_range;
+        auto instructions() const -> instruction_range;
+
+        auto exception_clause_count()                    const -> core::size_type;
+        auto get_exception_clause(core::size_type index) const -> exception_clause;
+
+        auto is_initialized() const -> bool;
+        auto operator!()      const -> bool;
+
+        CXXREFLECT_GENERATE_SAFE_BOOL_CONVERSION(method_body)
+
+    private:
+
+        core::checked_pointer<database const>              _scope;
+        core::const_byte_range                             _code;
+        core::value_initialized<core::size_type>           _max_stack;
+        core::value_initialized<bool>                      _init_locals;
+        standalone_sig_token                               _local_signature;
+        core::value_initialized<core::const_byte_iterator> _clauses;
+        core::value_initialized<core::size_type>           _clause_count;
+        core::value_initialized<bool>                      _clauses_are_fat;
+    };
+
+    /// @}
+
+} }
+
+#endif
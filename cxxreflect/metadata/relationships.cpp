@@ -63,6 +63,28 @@ namespace cxxreflect { namespace metadata {
 
 
 
+    auto find_class_layout(type_def_token const& parent) -> class_layout_row
+    {
+        core::assert_initialized(parent);
+
+        auto const range(detail::table_id_primary_key_equal_range(
+            parent,
+            table_id::type_def,
+            table_id::class_layout,
+            column_id::class_layout_parent));
+
+        // Not every row has a class layout value:
+        if (range.empty())
+            return class_layout_row();
+
+        // If a row has a class layout, it must have exactly one:
+        database_table const& class_layout_table(parent.scope().tables()[table_id::class_layout]);
+        if (range.size() != class_layout_table.row_size())
+            throw core::metadata_error(L"class layout table has non-unique parent index");
+
+        return create_row<class_layout_row>(&parent.scope(), begin(range));
+    }
+
     auto find_constant(has_constant_token const& parent) -> constant_row
     {
         core::assert_initialized(parent);
@@ -107,6 +129,28 @@ namespace cxxreflect { namespace metadata {
         return create_row<field_layout_row>(&parent.scope(), begin(range));
     }
 
+    auto find_field_rva(field_token const& parent) -> field_rva_row
+    {
+        core::assert_initialized(parent);
+
+        auto const range(detail::table_id_primary_key_equal_range(
+            parent,
+            table_id::field,
+            table_id::field_rva,
+            column_id::field_rva_parent));
+
+        // Only fields with initial data have a field RVA value:
+        if (range.empty())
+            return field_rva_row();
+
+        // If a row has a field RVA, it must have exactly one:
+        database_table const& field_rva_table(parent.scope().tables()[table_id::field_rva]);
+        if (range.size() != field_rva_table.row_size())
+            throw core::metadata_error(L"field RVA table has non-unique parent index");
+
+        return create_row<field_rva_row>(&parent.scope(), begin(range));
+    }
+
 
 
 
@@ -57,8 +57,10 @@ namespace cxxreflect { namespace metadata {
 
 
 
+    auto find_class_layout             (type_def_token             const& parent) -> class_layout_row;
     auto find_constant                 (has_constant_token         const& parent) -> constant_row;
     auto find_field_layout             (field_token                const& parent) -> field_layout_row;
+    auto find_field_rva                (field_token                const& parent) -> field_rva_row;
     auto find_custom_attributes        (has_custom_attribute_token const& parent) -> custom_attribute_row_range;
     auto find_events                   (type_def_token             const& parent) -> event_row_range;
     auto find_fields                   (type_def_token             const& parent) -> field_row_range;
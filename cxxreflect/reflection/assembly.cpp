@@ -9,7 +9,9 @@
 #include "cxxreflect/reflection/assembly.hpp"
 #include "cxxreflect/reflection/file.hpp"
 #include "cxxreflect/reflection/loader.hpp"
+#include "cxxreflect/reflection/manifest_resource.hpp"
 #include "cxxreflect/reflection/module.hpp"
+#include "cxxreflect/reflection/module_visitor.hpp"
 #include "cxxreflect/reflection/type.hpp"
 
 
@@ -73,14 +75,28 @@ namespace cxxreflect { namespace reflection {
 
     auto assembly::files() const -> file_range
     {
+        core::assert_initialized(*this);
+
         metadata::database const& scope(_context->manifest_module().database());
-        core::size_type    const  row_count(scope.tables()[metadata::table_id::assembly_ref].row_count());
+        core::size_type    const  row_count(scope.tables()[metadata::table_id::file].row_count());
 
         return file_range(
             file_iterator(*this, metadata::file_token(&scope, metadata::table_id::file, 0)),
             file_iterator(*this, metadata::file_token(&scope, metadata::table_id::file, row_count)));
     }
 
+    auto assembly::manifest_resources() const -> manifest_resource_range
+    {
+        core::assert_initialized(*this);
+
+        metadata::database const& scope(_context->manifest_module().database());
+        core::size_type    const  row_count(scope.tables()[metadata::table_id::manifest_resource].row_count());
+
+        return manifest_resource_range(
+            manifest_resource_iterator(*this, metadata::manifest_resource_token(&scope, metadata::table_id::manifest_resource, 0)),
+            manifest_resource_iterator(*this, metadata::manifest_resource_token(&scope, metadata::table_id::manifest_resource, row_count)));
+    }
+
     auto assembly::modules() const -> module_range
     {
         core::assert_initialized(*this);
@@ -132,12 +148,30 @@ namespace cxxreflect { namespace reflection {
         return token.is_initialized() ? type(token, core::internal_key()) : type();
     }
 
+    auto assembly::find_manifest_resource(core::string_reference const& name) const -> manifest_resource
+    {
+        core::assert_initialized(*this);
+
+        metadata::manifest_resource_token const token(_context->find_manifest_resource(name));
+        return token.is_initialized() ? manifest_resource(*this, token, core::internal_key()) : manifest_resource();
+    }
+
     auto assembly::manifest_module() const -> module
     {
         core::assert_initialized(*this);
         return module(&_context->manifest_module(), core::internal_key());
     }
 
+    auto assembly::visit(module_visitor& visitor, bool const parallel) const -> void
+    {
+        core::assert_initialized(*this);
+
+        core::for_all(modules(), [&](module const& m)
+        {
+            m.visit(visitor, parallel);
+        });
+    }
+
     auto assembly::context(core::internal_key) const -> detail::assembly_context const&
     {
         core::assert_initialized(*this);
@@ -37,6 +37,13 @@ namespace cxxreflect { namespace reflection {
             core::internal_constructor_forwarder<file>
         > file_iterator;
 
+        typedef core::instantiating_iterator<
+            metadata::token_with_arithmetic<metadata::manifest_resource_token>::type,
+            manifest_resource,
+            assembly,
+            core::internal_constructor_forwarder<manifest_resource>
+        > manifest_resource_iterator;
+
         typedef core::instantiating_iterator<
             metadata::token_with_arithmetic<metadata::assembly_ref_token>::type,
             assembly_name,
@@ -53,10 +60,11 @@ namespace cxxreflect { namespace reflection {
             &assembly::end_module_types
         > type_iterator;
 
-        typedef core::iterator_range<module_iterator       > module_range;
-        typedef core::iterator_range<file_iterator         > file_range;
-        typedef core::iterator_range<assembly_name_iterator> assembly_name_range;
-        typedef core::iterator_range<type_iterator         > type_range;
+        typedef core::iterator_range<module_iterator           > module_range;
+        typedef core::iterator_range<file_iterator             > file_range;
+        typedef core::iterator_range<manifest_resource_iterator> manifest_resource_range;
+        typedef core::iterator_range<assembly_name_iterator    > assembly_name_range;
+        typedef core::iterator_range<type_iterator             > type_range;
 
         assembly();
         assembly(detail::assembly_context const* context, core::internal_key);
@@ -68,6 +76,7 @@ namespace cxxreflect { namespace reflection {
 
         auto referenced_assembly_names() const -> assembly_name_range;
         auto files()                     const -> file_range;
+        auto manifest_resources()        const -> manifest_resource_range;
         auto modules()                   const -> module_range;
         auto types()                     const -> type_range;
 
@@ -75,8 +84,15 @@ namespace cxxreflect { namespace reflection {
         auto find_module(core::string_reference const& name) const -> module;
         auto find_type  (core::string_reference const& namespace_name, core::string_reference const& simple_name) const -> type;
 
+        /// Finds a manifest resource by name; the resources are indexed by name when the first one
+        /// is found, so this has log N time complexity
+        auto find_manifest_resource(core::string_reference const& name) const -> manifest_resource;
+
         auto manifest_module() const -> module;
 
+        /// Visits the metadata of every module in this assembly, in order; see `module::visit()`
+        auto visit(module_visitor& visitor, bool parallel = false) const -> void;
+
         auto context(core::internal_key) const -> detail::assembly_context const&;
 
         auto is_initialized() const -> bool;
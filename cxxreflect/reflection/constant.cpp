@@ -115,6 +115,26 @@ namespace cxxreflect { namespace reflection {
     {
         return check_and_read_single_primitive<double>(row().value());
     }
+
+    auto constant::as_string() const -> core::string
+    {
+        metadata::constant_row const constant_row(row());
+        if (constant_row.type() != metadata::element_type::string)
+            throw core::runtime_error(L"attempted an invalid reinterpretation");
+
+        metadata::blob const value(constant_row.value());
+        if (core::distance(begin(value), end(value)) % sizeof(std::uint16_t) != 0)
+            throw core::metadata_error(L"invalid metadata:  string constant has odd length");
+
+        core::string result;
+        result.reserve(core::distance(begin(value), end(value)) / sizeof(std::uint16_t));
+        for (core::const_byte_iterator it(begin(value)); it != end(value); it += sizeof(std::uint16_t))
+        {
+            result.push_back(static_cast<wchar_t>(*it | (*(it + 1) << 8)));
+        }
+
+        return result;
+    }
         
     auto constant::is_initialized() const -> bool
     {
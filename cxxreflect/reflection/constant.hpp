@@ -55,7 +55,10 @@ namespace cxxreflect { namespace reflection {
         auto as_uint64()    const -> std::uint64_t;
         auto as_float()     const -> float;
         auto as_double()    const -> double;
-        // TODO auto as_string()    const -> core::string_reference;
+
+        /// Gets the value of a `string` constant.  String constants are stored as UTF-16 and are
+        /// not null-terminated, so the value is copied.
+        auto as_string() const -> core::string;
         
         auto is_initialized() const -> bool;
         auto operator!()      const -> bool;
@@ -6,6 +6,7 @@
 #include "cxxreflect/reflection/precompiled_headers.hpp"
 #include "cxxreflect/reflection/detail/loader_context.hpp"
 #include "cxxreflect/reflection/detail/member_iterator.hpp"
+#include "cxxreflect/reflection/detail/module_context.hpp"
 #include "cxxreflect/reflection/custom_attribute.hpp"
 #include "cxxreflect/reflection/guid.hpp"
 #include "cxxreflect/reflection/method.hpp"
@@ -22,91 +23,14 @@ namespace cxxreflect { namespace reflection {
     {
         core::assert_initialized(attribute);
 
-        metadata::custom_attribute_row const attribute_row(row_from(attribute));
-
-        static metadata::binding_flags const flags(metadata::binding_attribute::all_instance);
-
-        _attribute = attribute;
-
-        switch (attribute_row.type().table())
-        {
-        case metadata::table_id::method_def:
-        {
-            metadata::method_def_token const ctor_token(attribute_row.type().as<metadata::method_def_token>());
-            metadata::type_def_token   const owner_token(metadata::find_owner_of_method_def(ctor_token).token());
-
-            type const t(owner_token, core::internal_key());
-
-            auto const constructors(t.constructors(flags));
-            auto const constructor_it(core::find_if(constructors, [&](method const& ctor)
-            {
-                return ctor.metadata_token() == ctor_token.value();
-            }));
-
-            if (constructor_it == end(constructors))
-                throw core::runtime_error(L"failed to find constructor for attribute");
-
-            _reflected_type    = constructor_it->reflected_type().context(core::internal_key());
-            _constructor.get() = &constructor_it->context(core::internal_key());
-            break;
-        }
-
-        case metadata::table_id::member_ref:
-        {
-            metadata::member_ref_row const ref_row(row_from(attribute_row.type().as<metadata::member_ref_token>()));
-            metadata::member_ref_parent_token const owner_token(ref_row.parent());
-
-            switch (owner_token.table())
-            {
-            case metadata::table_id::type_ref:
-            {
-                type const t(owner_token.as<metadata::type_ref_token>(), core::internal_key());
-                if (ref_row.name() == L".ctor")
-                {
-                    // TODO Correct detection of contructors
-
-                    if (t.constructors(flags).empty())
-                        core::assert_not_yet_implemented();
-
-                    detail::loader_context const& root(detail::loader_context::from(owner_token.scope()));
-
-                    metadata::signature_comparer const compare(&root);
-
-                    auto const constructors(t.constructors(flags));
-                    auto const constructor_it(core::find_if(constructors, [&](method const& ctor)
-                    {
-                        return compare(
-                            ref_row.signature().as<metadata::method_signature>(),
-                            ctor.context(core::internal_key()).member_signature());
-                    }));
-
-                    if (constructor_it == end(constructors))
-                        throw core::runtime_error(L"failed to find constructor for attribute");
-
-                    _reflected_type    = constructor_it->reflected_type().context(core::internal_key());
-                    _constructor.get() = &constructor_it->context(core::internal_key());
-                    break;
-                }
-                else
-                {
-                    core::assert_not_yet_implemented();
-                }
-            }
-
-            default:
-            {
-                core::assert_not_yet_implemented();
-            }
-            }
-
-            break;
-        }
-
-        default:
-        {
-            core::assert_unreachable();
-        }
-        }
+        // Resolving the constructor is expensive, so it is resolved once per CustomAttribute row
+        // and cached in the module that defines the attribute:
+        detail::custom_attribute_constructor const& resolved(
+            detail::module_context::from(attribute.scope()).attribute_constructor(attribute));
+
+        _attribute         = attribute;
+        _reflected_type    = resolved.reflected_type();
+        _constructor.get() = &resolved.constructor();
     }
 
     auto custom_attribute::metadata_token() const -> core::size_type
@@ -123,6 +47,28 @@ namespace cxxreflect { namespace reflection {
         return method(type(_reflected_type, core::internal_key()), _constructor.get(), core::internal_key());
     }
 
+    auto custom_attribute::positional_arguments() const -> positional_argument_range
+    {
+        detail::custom_attribute_layout const& arguments(layout());
+        if (arguments.positional_arguments().empty())
+            return positional_argument_range();
+
+        return positional_argument_range(
+            positional_argument_iterator(&arguments, arguments.positional_arguments().data()),
+            positional_argument_iterator(&arguments, arguments.positional_arguments().data() + arguments.positional_arguments().size()));
+    }
+
+    auto custom_attribute::named_arguments() const -> named_argument_range
+    {
+        detail::custom_attribute_layout const& arguments(layout());
+        if (arguments.named_arguments().empty())
+            return named_argument_range();
+
+        return named_argument_range(
+            named_argument_iterator(&arguments, arguments.named_arguments().data()),
+            named_argument_iterator(&arguments, arguments.named_arguments().data() + arguments.named_arguments().size()));
+    }
+
     auto custom_attribute::single_string_argument() const -> core::string
     {
         metadata::custom_attribute_row const attribute(row_from(_attribute));
@@ -137,21 +83,7 @@ namespace cxxreflect { namespace reflection {
         if (prefix != 1)
             throw core::runtime_error(L"Invalid custom attribute signature");
 
-        // TODO We materialize three separate buffers here; we should look into removing one or two.
-        core::size_type const utf8_length(metadata::detail::read_sig_compressed_uint32(it, end(value_blob)));
-        if (core::distance(it, end(value_blob)) < utf8_length)
-            throw core::runtime_error(L"Invalid custom attribute value");
-
-        std::vector<char> utf8_buffer(it, it + utf8_length);
-        utf8_buffer.push_back(L'\0');
-
-        core::size_type const utf16_length(core::externals::compute_utf16_length_of_utf8_string(
-            reinterpret_cast<char const*>(it)));
-
-        std::vector<wchar_t> utf16_buffer(utf16_length);
-
-        core::externals::convert_utf8_to_utf16(utf8_buffer.data(), utf16_buffer.data(), utf16_length);
-        return core::string(utf16_buffer.data());
+        return detail::convert_custom_attribute_string(detail::read_custom_attribute_string(it, end(value_blob)));
     }
 
     auto custom_attribute::single_guid_argument() const -> guid
@@ -185,6 +117,13 @@ namespace cxxreflect { namespace reflection {
         return guid(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, aa);
     }
 
+    auto custom_attribute::layout() const -> detail::custom_attribute_layout const&
+    {
+        core::assert_initialized(*this);
+
+        return detail::module_context::from(_attribute.scope()).attribute_layout(_attribute);
+    }
+
     auto custom_attribute::is_initialized() const -> bool
     {
         return _attribute.is_initialized() && _constructor.is_initialized();
@@ -7,6 +7,7 @@
 #define CXXREFLECT_REFLECTION_CUSTOM_ATTRIBUTE_HPP_
 
 #include "cxxreflect/reflection/detail/forward_declarations.hpp"
+#include "cxxreflect/reflection/custom_attribute_argument.hpp"
 
 namespace cxxreflect { namespace reflection {
 
@@ -14,11 +15,24 @@ namespace cxxreflect { namespace reflection {
     {
     public:
 
-        // TODO typedef void positional_argument_iterator;
-        // TODO typedef void named_argument_iterator;
-
-        // TODO typedef core::iterator_range<positional_argument_iterator> positional_argument_range;
-        // TODO typedef core::iterator_range<named_argument_iterator     > named_argument_range;
+        typedef core::instantiating_iterator
+        <
+            detail::custom_attribute_argument_entry const*,
+            custom_attribute_argument,
+            detail::custom_attribute_layout const*,
+            core::internal_constructor_forwarder<custom_attribute_argument>
+        > positional_argument_iterator;
+
+        typedef core::instantiating_iterator
+        <
+            detail::custom_attribute_argument_entry const*,
+            custom_attribute_named_argument,
+            detail::custom_attribute_layout const*,
+            core::internal_constructor_forwarder<custom_attribute_named_argument>
+        > named_argument_iterator;
+
+        typedef core::iterator_range<positional_argument_iterator> positional_argument_range;
+        typedef core::iterator_range<named_argument_iterator     > named_argument_range;
 
         custom_attribute();
         custom_attribute(nullptr_t, metadata::custom_attribute_token const& attribute, core::internal_key);
@@ -29,14 +43,21 @@ namespace cxxreflect { namespace reflection {
 
         auto constructor() const -> method;
 
-        // TODO auto positional_arguments() const -> positional_argument_range;
-        // TODO auto named_arguments()      const -> named_argument_range;
-
-        // TODO These must be removed. These return the first fixed argument of the custom attribute,
-        // interpreted either as a string or a GUID.  They do no type checking (and are therefore
-        // really bad and unsafe).  They are here only to support handling of GuidAttribute and
-        // ActivatableAttribute.  Once we implement the positional and named argument support, we
-        // will remove these.
+        /// Gets the positional (fixed) and named arguments of the custom attribute
+        ///
+        /// The arguments are decoded from the blob when they are first requested, and the location
+        /// and encoding of each argument is cached for the lifetime of the loader, so subsequent
+        /// calls do not decode the blob again.  Argument values are read from the blob on demand.
+        /// Throws a `metadata_error` if the blob is malformed, or a `runtime_error` if the type of
+        /// an enumeration argument cannot be resolved.
+        auto positional_arguments() const -> positional_argument_range;
+        auto named_arguments()      const -> named_argument_range;
+
+        // TODO These should be removed in favor of the positional arguments.  These interpret the
+        // first fixed argument of the custom attribute as a string, or the fixed arguments as the
+        // components of a GUID, without consulting the constructor's signature (so they do no type
+        // checking).  They are here only to support handling of GuidAttribute and
+        // ActivatableAttribute, for which they avoid resolving the constructor's parameter types.
         auto single_string_argument() const -> core::string;
         auto single_guid_argument()   const -> guid;
 
@@ -52,6 +73,8 @@ namespace cxxreflect { namespace reflection {
         static auto get_for(metadata::has_custom_attribute_token const& parent, core::internal_key) -> detail::custom_attribute_range;
 
     private:
+
+        auto layout() const -> detail::custom_attribute_layout const&;
         
         metadata::custom_attribute_token                        _attribute;
         metadata::type_def_or_signature                         _reflected_type;
@@ -0,0 +1,327 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "cxxreflect/reflection/precompiled_headers.hpp"
+#include "cxxreflect/reflection/custom_attribute_argument.hpp"
+
+namespace cxxreflect { namespace reflection {
+
+    custom_attribute_argument::custom_attribute_argument()
+    {
+    }
+
+    custom_attribute_argument::custom_attribute_argument(detail::custom_attribute_layout         const* const layout,
+                                                         detail::custom_attribute_argument_entry const* const entry,
+                                                         core::internal_key)
+        : _scope(&layout->scope()), _type(entry->type()), _first(entry->value()), _last(layout->last())
+    {
+        unbox();
+    }
+
+    custom_attribute_argument::custom_attribute_argument(metadata::database                  const* const scope,
+                                                         detail::custom_attribute_value_type const&       type,
+                                                         core::const_byte_iterator           const        first,
+                                                         core::const_byte_iterator           const        last,
+                                                         core::internal_key)
+        : _scope(scope), _type(type), _first(first), _last(last)
+    {
+        core::assert_not_null(scope);
+        core::assert_initialized(type);
+        core::assert_not_null(first);
+        core::assert_not_null(last);
+
+        unbox();
+    }
+
+    auto custom_attribute_argument::get_kind() const -> kind
+    {
+        if (!is_initialized())
+            return kind::unknown;
+
+        if (_type.is_array())
+            return kind::array;
+
+        switch (_type.type())
+        {
+        case metadata::element_type::boolean:   return kind::boolean;
+        case metadata::element_type::character: return kind::character;
+        case metadata::element_type::i1:        return kind::int8;
+        case metadata::element_type::u1:        return kind::uint8;
+        case metadata::element_type::i2:        return kind::int16;
+        case metadata::element_type::u2:        return kind::uint16;
+        case metadata::element_type::i4:        return kind::int32;
+        case metadata::element_type::u4:        return kind::uint32;
+        case metadata::element_type::i8:        return kind::int64;
+        case metadata::element_type::u8:        return kind::uint64;
+        case metadata::element_type::r4:        return kind::single_precision;
+        case metadata::element_type::r8:        return kind::double_precision;
+        case metadata::element_type::string:    return kind::string;
+        case metadata::element_type::type:      return kind::type;
+        default:                                return kind::unknown;
+        }
+    }
+
+    auto custom_attribute_argument::is_enum() const -> bool
+    {
+        core::assert_initialized(*this);
+        return _type.is_enum();
+    }
+
+    auto custom_attribute_argument::is_boxed() const -> bool
+    {
+        core::assert_initialized(*this);
+        return _is_boxed.get();
+    }
+
+    auto custom_attribute_argument::is_null() const -> bool
+    {
+        switch (get_kind())
+        {
+        case kind::string:
+        case kind::type:
+            return metadata::detail::peek_sig_byte(_first.get(), _last.get()) == 0xff;
+
+        case kind::array:
+            return metadata::detail::peek_sig_element<std::uint32_t>(_first.get(), _last.get()) == 0xffffffff;
+
+        default:
+            return false;
+        }
+    }
+
+    auto custom_attribute_argument::as_boolean() const -> bool
+    {
+        return read_primitive<std::uint8_t>(kind::boolean) != 0;
+    }
+
+    auto custom_attribute_argument::as_character() const -> wchar_t
+    {
+        return read_primitive<wchar_t>(kind::character);
+    }
+
+    auto custom_attribute_argument::as_int8() const -> std::int8_t
+    {
+        return read_primitive<std::int8_t>(kind::int8);
+    }
+
+    auto custom_attribute_argument::as_uint8() const -> std::uint8_t
+    {
+        return read_primitive<std::uint8_t>(kind::uint8);
+    }
+
+    auto custom_attribute_argument::as_int16() const -> std::int16_t
+    {
+        return read_primitive<std::int16_t>(kind::int16);
+    }
+
+    auto custom_attribute_argument::as_uint16() const -> std::uint16_t
+    {
+        return read_primitive<std::uint16_t>(kind::uint16);
+    }
+
+    auto custom_attribute_argument::as_int32() const -> std::int32_t
+    {
+        return read_primitive<std::int32_t>(kind::int32);
+    }
+
+    auto custom_attribute_argument::as_uint32() const -> std::uint32_t
+    {
+        return read_primitive<std::uint32_t>(kind::uint32);
+    }
+
+    auto custom_attribute_argument::as_int64() const -> std::int64_t
+    {
+        return read_primitive<std::int64_t>(kind::int64);
+    }
+
+    auto custom_attribute_argument::as_uint64() const -> std::uint64_t
+    {
+        return read_primitive<std::uint64_t>(kind::uint64);
+    }
+
+    auto custom_attribute_argument::as_float() const -> float
+    {
+        return read_primitive<float>(kind::single_precision);
+    }
+
+    auto custom_attribute_argument::as_double() const -> double
+    {
+        return read_primitive<double>(kind::double_precision);
+    }
+
+    auto custom_attribute_argument::as_string() const -> core::string
+    {
+        return detail::convert_custom_attribute_string(as_utf8_string());
+    }
+
+    auto custom_attribute_argument::as_utf8_string() const -> core::const_byte_range
+    {
+        kind const k(get_kind());
+        if (k != kind::string && k != kind::type)
+            throw core::runtime_error(L"attempted an invalid reinterpretation");
+
+        core::const_byte_iterator it(_first.get());
+        return detail::read_custom_attribute_string(it, _last.get());
+    }
+
+    auto custom_attribute_argument::element_count() const -> core::size_type
+    {
+        if (get_kind() != kind::array)
+            throw core::runtime_error(L"attempted an invalid reinterpretation");
+
+        std::uint32_t const count(metadata::detail::peek_sig_element<std::uint32_t>(_first.get(), _last.get()));
+        return count != 0xffffffff ? count : 0;
+    }
+
+    auto custom_attribute_argument::elements() const -> element_range
+    {
+        core::size_type const count(element_count());
+        core::const_byte_iterator const first_element(_first.get() + sizeof(std::uint32_t));
+
+        return element_range(
+            element_iterator(_scope.get(), _type.element(), first_element, _last.get(), count, core::internal_key()),
+            element_iterator(_scope.get(), _type.element(), first_element, _last.get(), 0,     core::internal_key()));
+    }
+
+    auto custom_attribute_argument::is_initialized() const -> bool
+    {
+        return _type.is_initialized();
+    }
+
+    auto custom_attribute_argument::operator!() const -> bool
+    {
+        return !is_initialized();
+    }
+
+    template <typename T>
+    auto custom_attribute_argument::read_primitive(kind const expected_kind) const -> T
+    {
+        if (get_kind() != expected_kind)
+            throw core::runtime_error(L"attempted an invalid reinterpretation");
+
+        return metadata::detail::peek_sig_element<T>(_first.get(), _last.get());
+    }
+
+    auto custom_attribute_argument::unbox() -> void
+    {
+        // A boxed value is prefixed by the encoding of its type; we read the encoding once, here,
+        // so that the argument behaves as an argument of the boxed type:
+        if (_type.is_array() || _type.type() != metadata::element_type::custom_attribute_boxed_object)
+            return;
+
+        core::const_byte_iterator it(_first.get());
+        _type = detail::read_custom_attribute_value_type(*_scope, it, _last.get());
+        _first.get() = it;
+        _is_boxed.get() = true;
+    }
+
+
+
+
+
+    custom_attribute_element_iterator::custom_attribute_element_iterator()
+    {
+    }
+
+    custom_attribute_element_iterator::custom_attribute_element_iterator(metadata::database                  const* const scope,
+                                                                         detail::custom_attribute_value_type const&       element_type,
+                                                                         core::const_byte_iterator           const        current,
+                                                                         core::const_byte_iterator           const        last,
+                                                                         core::size_type                     const        remaining,
+                                                                         core::internal_key)
+        : _scope(scope), _element_type(element_type), _current(current), _last(last), _remaining(remaining)
+    {
+        core::assert_not_null(scope);
+        core::assert_initialized(element_type);
+
+        if (remaining != 0)
+            _value = custom_attribute_argument(scope, element_type, current, last, core::internal_key());
+    }
+
+    auto custom_attribute_element_iterator::operator*() const -> reference
+    {
+        core::assert_true([&]{ return _remaining.get() != 0; });
+        return _value;
+    }
+
+    auto custom_attribute_element_iterator::operator->() const -> pointer
+    {
+        core::assert_true([&]{ return _remaining.get() != 0; });
+        return &_value;
+    }
+
+    auto custom_attribute_element_iterator::operator++() -> custom_attribute_element_iterator&
+    {
+        core::assert_true([&]{ return _remaining.get() != 0; });
+
+        detail::skip_custom_attribute_value(*_scope, _element_type, _current.get(), _last.get());
+
+        --_remaining.get();
+        _value = _remaining.get() != 0
+            ? custom_attribute_argument(_scope.get(), _element_type, _current.get(), _last.get(), core::internal_key())
+            : custom_attribute_argument();
+
+        return *this;
+    }
+
+    auto custom_attribute_element_iterator::operator++(int) -> custom_attribute_element_iterator
+    {
+        custom_attribute_element_iterator const it(*this);
+        ++*this;
+        return it;
+    }
+
+
+
+
+
+    custom_attribute_named_argument::custom_attribute_named_argument()
+    {
+    }
+
+    custom_attribute_named_argument::custom_attribute_named_argument(detail::custom_attribute_layout         const* const layout,
+                                                                     detail::custom_attribute_argument_entry const* const entry,
+                                                                     core::internal_key)
+        : _layout(layout), _entry(entry)
+    {
+        core::assert_not_null(layout);
+        core::assert_not_null(entry);
+    }
+
+    auto custom_attribute_named_argument::name() const -> core::string_reference
+    {
+        core::assert_initialized(*this);
+        return _entry->name();
+    }
+
+    auto custom_attribute_named_argument::is_field() const -> bool
+    {
+        core::assert_initialized(*this);
+        return _entry->member_kind() == metadata::element_type::custom_attribute_field;
+    }
+
+    auto custom_attribute_named_argument::is_property() const -> bool
+    {
+        core::assert_initialized(*this);
+        return _entry->member_kind() == metadata::element_type::custom_attribute_property;
+    }
+
+    auto custom_attribute_named_argument::value() const -> custom_attribute_argument
+    {
+        core::assert_initialized(*this);
+        return custom_attribute_argument(_layout.get(), _entry.get(), core::internal_key());
+    }
+
+    auto custom_attribute_named_argument::is_initialized() const -> bool
+    {
+        return _layout.is_initialized() && _entry.is_initialized();
+    }
+
+    auto custom_attribute_named_argument::operator!() const -> bool
+    {
+        return !is_initialized();
+    }
+
+} }
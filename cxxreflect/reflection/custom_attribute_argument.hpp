@@ -0,0 +1,197 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#ifndef CXXREFLECT_REFLECTION_CUSTOM_ATTRIBUTE_ARGUMENT_HPP_
+#define CXXREFLECT_REFLECTION_CUSTOM_ATTRIBUTE_ARGUMENT_HPP_
+
+#include "cxxreflect/reflection/detail/custom_attribute_decoder.hpp"
+
+namespace cxxreflect { namespace reflection {
+
+    class custom_attribute_element_iterator;
+
+    /// An argument of a custom attribute, or an element of an array argument
+    ///
+    /// An argument is a view of its value in the blob heap; nothing is decoded or copied until one
+    /// of the `as_` accessors is called, and only `as_string()` allocates.  An enumeration argument
+    /// has the kind of its underlying type; `is_enum()` tells whether it was an enumeration.  A
+    /// `System.Object` argument is unboxed, so it has the kind of the boxed value.  Each `as_`
+    /// accessor throws a `runtime_error` if the argument does not have the corresponding kind.
+    class custom_attribute_argument
+    {
+    public:
+
+        enum class kind
+        {
+            /// Indicates the argument has an unknown kind and attempts to get its value will fail
+            unknown,
+
+            boolean,
+            character,
+            int8,
+            uint8,
+            int16,
+            uint16,
+            int32,
+            uint32,
+            int64,
+            uint64,
+            single_precision,
+            double_precision,
+            string,
+
+            /// Indicates the argument is a `System.Type`, which is encoded as its type name
+            type,
+
+            /// Indicates the argument is a single-dimensional array; see `elements()`
+            array
+        };
+
+        typedef custom_attribute_element_iterator     element_iterator;
+        typedef core::iterator_range<element_iterator> element_range;
+
+        custom_attribute_argument();
+        custom_attribute_argument(detail::custom_attribute_layout         const* layout,
+                                  detail::custom_attribute_argument_entry const* entry,
+                                  core::internal_key);
+        custom_attribute_argument(metadata::database                  const* scope,
+                                  detail::custom_attribute_value_type const& type,
+                                  core::const_byte_iterator                  first,
+                                  core::const_byte_iterator                  last,
+                                  core::internal_key);
+
+        auto get_kind() const -> kind;
+        auto is_enum()  const -> bool;
+        auto is_boxed() const -> bool;
+
+        /// Tests whether the argument is a null string, type, or array
+        auto is_null() const -> bool;
+
+        auto as_boolean()   const -> bool;
+        auto as_character() const -> wchar_t;
+        auto as_int8()      const -> std::int8_t;
+        auto as_uint8()     const -> std::uint8_t;
+        auto as_int16()     const -> std::int16_t;
+        auto as_uint16()    const -> std::uint16_t;
+        auto as_int32()     const -> std::int32_t;
+        auto as_uint32()    const -> std::uint32_t;
+        auto as_int64()     const -> std::int64_t;
+        auto as_uint64()    const -> std::uint64_t;
+        auto as_float()     const -> float;
+        auto as_double()    const -> double;
+
+        /// Gets the value of a `string` or `type` argument, converted from UTF-8.  A null string is
+        /// returned as an empty string.
+        auto as_string() const -> core::string;
+
+        /// Gets the UTF-8 bytes of a `string` or `type` argument, without copying them.  A null
+        /// string is returned as an uninitialized range.
+        auto as_utf8_string() const -> core::const_byte_range;
+
+        /// Gets the elements of an `array` argument; a null array has no elements
+        auto element_count() const -> core::size_type;
+        auto elements()      const -> element_range;
+
+        auto is_initialized() const -> bool;
+        auto operator!()      const -> bool;
+
+        CXXREFLECT_GENERATE_SAFE_BOOL_CONVERSION(custom_attribute_argument)
+
+    private:
+
+        template <typename T>
+        auto read_primitive(kind expected_kind) const -> T;
+
+        auto unbox() -> void;
+
+        core::checked_pointer<metadata::database const>    _scope;
+        detail::custom_attribute_value_type                _type;
+        core::value_initialized<bool>                      _is_boxed;
+        core::value_initialized<core::const_byte_iterator> _first;
+        core::value_initialized<core::const_byte_iterator> _last;
+    };
+
+
+
+
+
+    /// A forward iterator over the elements of an array argument of a custom attribute
+    ///
+    /// Elements may be of variable length (e.g. strings), so the iterator decodes the length of
+    /// each element as it advances past it.
+    class custom_attribute_element_iterator
+    {
+    public:
+
+        typedef custom_attribute_argument        value_type;
+        typedef custom_attribute_argument const& reference;
+        typedef custom_attribute_argument const* pointer;
+        typedef std::ptrdiff_t                   difference_type;
+        typedef std::forward_iterator_tag        iterator_category;
+
+        custom_attribute_element_iterator();
+        custom_attribute_element_iterator(metadata::database                  const* scope,
+                                          detail::custom_attribute_value_type const& element_type,
+                                          core::const_byte_iterator                  current,
+                                          core::const_byte_iterator                  last,
+                                          core::size_type                            remaining,
+                                          core::internal_key);
+
+        auto operator*()  const -> reference;
+        auto operator->() const -> pointer;
+
+        auto operator++()    -> custom_attribute_element_iterator&;
+        auto operator++(int) -> custom_attribute_element_iterator;
+
+        friend auto operator==(custom_attribute_element_iterator const& lhs, custom_attribute_element_iterator const& rhs) -> bool
+        {
+            return lhs._remaining.get() == rhs._remaining.get();
+        }
+
+        CXXREFLECT_GENERATE_EQUALITY_OPERATORS(custom_attribute_element_iterator)
+
+    private:
+
+        core::checked_pointer<metadata::database const>    _scope;
+        detail::custom_attribute_value_type                _element_type;
+        core::value_initialized<core::const_byte_iterator> _current;
+        core::value_initialized<core::const_byte_iterator> _last;
+        core::value_initialized<core::size_type>           _remaining;
+        custom_attribute_argument                          _value;
+    };
+
+
+
+
+
+    /// A named argument of a custom attribute, which sets a field or a property of the attribute
+    class custom_attribute_named_argument
+    {
+    public:
+
+        custom_attribute_named_argument();
+        custom_attribute_named_argument(detail::custom_attribute_layout         const* layout,
+                                        detail::custom_attribute_argument_entry const* entry,
+                                        core::internal_key);
+
+        auto name()        const -> core::string_reference;
+        auto is_field()    const -> bool;
+        auto is_property() const -> bool;
+        auto value()       const -> custom_attribute_argument;
+
+        auto is_initialized() const -> bool;
+        auto operator!()      const -> bool;
+
+        CXXREFLECT_GENERATE_SAFE_BOOL_CONVERSION(custom_attribute_named_argument)
+
+    private:
+
+        core::checked_pointer<detail::custom_attribute_layout         const> _layout;
+        core::checked_pointer<detail::custom_attribute_argument_entry const> _entry;
+    };
+
+} }
+
+#endif
@@ -46,6 +46,39 @@ namespace cxxreflect { namespace reflection { namespace detail {
         return *_name;
     }
 
+    auto assembly_context::find_manifest_resource(core::string_reference const& name) const -> metadata::manifest_resource_token
+    {
+        realize_manifest_resources();
+
+        auto const it(core::binary_search(
+            _manifest_resources.begin(),
+            _manifest_resources.end(),
+            std::make_pair(name, metadata::manifest_resource_token()),
+            [](manifest_resource_index_entry const& lhs, manifest_resource_index_entry const& rhs)
+        {
+            return lhs.first < rhs.first;
+        }));
+
+        return it != _manifest_resources.end() ? it->second : metadata::manifest_resource_token();
+    }
+
+    auto assembly_context::find_exported_type(core::string_reference const& namespace_name,
+                                              core::string_reference const& name) const -> metadata::exported_type_token
+    {
+        realize_exported_types();
+
+        auto const it(core::binary_search(
+            _exported_types.begin(),
+            _exported_types.end(),
+            std::make_pair(std::make_pair(namespace_name, name), metadata::exported_type_token()),
+            [](exported_type_index_entry const& lhs, exported_type_index_entry const& rhs)
+        {
+            return lhs.first < rhs.first;
+        }));
+
+        return it != _exported_types.end() ? it->second : metadata::exported_type_token();
+    }
+
     auto assembly_context::realize_name() const -> void
     {
         auto const lock(_sync.lock());
@@ -91,6 +124,66 @@ namespace cxxreflect { namespace reflection { namespace detail {
         _state.set(realization_state::other_modules);
     }
 
+    auto assembly_context::realize_manifest_resources() const -> void
+    {
+        auto const lock(_sync.lock());
+
+        if (_state.is_set(realization_state::manifest_resources))
+            return;
+
+        // The ManifestResource table is not sorted, so we sort the resources by name once.  The
+        // names are views of the string heap, so the index does not copy them.
+        metadata::database const& manifest_database(manifest_module().database());
+
+        manifest_resource_index index;
+        index.reserve(manifest_database.tables()[metadata::table_id::manifest_resource].row_count());
+        core::for_all(manifest_database.table<metadata::table_id::manifest_resource>(), [&](metadata::manifest_resource_row const& r)
+        {
+            index.push_back(std::make_pair(r.name(), r.token()));
+        });
+
+        std::sort(index.begin(), index.end(), [](manifest_resource_index_entry const& lhs, manifest_resource_index_entry const& rhs)
+        {
+            return lhs.first < rhs.first;
+        });
+
+        _manifest_resources = std::move(index);
+        _state.set(realization_state::manifest_resources);
+    }
+
+    auto assembly_context::realize_exported_types() const -> void
+    {
+        auto const lock(_sync.lock());
+
+        if (_state.is_set(realization_state::exported_types))
+            return;
+
+        // Facade assemblies may forward thousands of types, and the ExportedType table is not
+        // sorted, so we sort the exported types by name once and then use a binary search.
+        metadata::database const& manifest_database(manifest_module().database());
+
+        exported_type_index index;
+        index.reserve(manifest_database.tables()[metadata::table_id::exported_type].row_count());
+        core::for_all(manifest_database.table<metadata::table_id::exported_type>(), [&](metadata::exported_type_row const& r)
+        {
+            // A nested type is named relative to its enclosing type, so its name alone is not a
+            // key; the enclosing type is exported with it and is found instead:
+            metadata::implementation_token const implementation(r.implementation());
+            if (implementation.is_initialized() && implementation.table() == metadata::table_id::exported_type)
+                return;
+
+            index.push_back(std::make_pair(std::make_pair(r.namespace_name(), r.name()), r.token()));
+        });
+
+        std::sort(index.begin(), index.end(), [](exported_type_index_entry const& lhs, exported_type_index_entry const& rhs)
+        {
+            return lhs.first < rhs.first;
+        });
+
+        _exported_types = std::move(index);
+        _state.set(realization_state::exported_types);
+    }
+
     CXXREFLECT_DEFINE_INCOMPLETE_DELETE(unique_assembly_context_delete, assembly_context)
 
 } } }
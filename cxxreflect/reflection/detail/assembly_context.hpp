@@ -20,6 +20,13 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
         typedef std::vector<unique_module_context> module_context_storage_type;
 
+        typedef std::pair<core::string_reference, metadata::manifest_resource_token> manifest_resource_index_entry;
+        typedef std::vector<manifest_resource_index_entry>                            manifest_resource_index;
+
+        typedef std::pair<core::string_reference, core::string_reference>            type_name_pair;
+        typedef std::pair<type_name_pair, metadata::exported_type_token>              exported_type_index_entry;
+        typedef std::vector<exported_type_index_entry>                                exported_type_index;
+
         assembly_context(loader_context const* loader, module_location const& manifest_module_location);
 
         auto loader()          const -> loader_context const&;
@@ -27,19 +34,33 @@ namespace cxxreflect { namespace reflection { namespace detail {
         auto modules()         const -> module_context_storage_type const&;
         auto name()            const -> assembly_name const&;
 
+        /// Finds a manifest resource by name; returns a null token if there is no such resource
+        auto find_manifest_resource(core::string_reference const& name) const -> metadata::manifest_resource_token;
+
+        /// Finds a type exported by this assembly, either from another of its modules or because
+        /// it has been forwarded to another assembly.  Returns a null token if the assembly does
+        /// not export such a type.  Nested exported types are not in the index; they are found
+        /// through their enclosing types.
+        auto find_exported_type(core::string_reference const& namespace_name,
+                                core::string_reference const& name) const -> metadata::exported_type_token;
+
     private:
 
         enum class realization_state
         {
-            name          = 0x01,
-            other_modules = 0x02
+            name               = 0x01,
+            other_modules      = 0x02,
+            manifest_resources = 0x04,
+            exported_types     = 0x08
         };
 
         assembly_context(assembly_context const&);
         auto operator=(assembly_context const&) -> assembly_context&;
 
-        auto realize_name()    const -> void;
-        auto realize_modules() const -> void;
+        auto realize_name()               const -> void;
+        auto realize_modules()            const -> void;
+        auto realize_manifest_resources() const -> void;
+        auto realize_exported_types()     const -> void;
 
         core::checked_pointer<loader_context const> _loader;
 
@@ -49,6 +70,9 @@ namespace cxxreflect { namespace reflection { namespace detail {
         module_context_storage_type    mutable _modules;
 
         std::unique_ptr<assembly_name> mutable _name;
+
+        manifest_resource_index        mutable _manifest_resources;
+        exported_type_index            mutable _exported_types;
     };
 
 } } }
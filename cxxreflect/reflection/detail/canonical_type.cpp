@@ -0,0 +1,235 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "cxxreflect/reflection/precompiled_headers.hpp"
+#include "cxxreflect/reflection/detail/canonical_type.hpp"
+#include "cxxreflect/reflection/detail/loader_context.hpp"
+#include "cxxreflect/reflection/detail/module_context.hpp"
+
+
+
+
+
+namespace cxxreflect { namespace reflection { namespace detail { namespace {
+
+    auto mix_hash(core::size_type const hash, core::size_type const value) -> core::size_type
+    {
+        return (hash ^ value) * 16777619;
+    }
+
+    auto hash_pointer(void const* const pointer) -> core::size_type
+    {
+        // Heap allocated objects are aligned, so the low bits of the pointer carry no information:
+        std::uintptr_t const value(reinterpret_cast<std::uintptr_t>(pointer) >> 4);
+        return static_cast<core::size_type>(value ^ (value >> 16));
+    }
+
+    auto hash_signature(metadata::type_resolver const& resolver, metadata::type_signature const& signature) -> core::size_type;
+
+    /// Hashes a type referenced from a signature, consistently with the `signature_comparer`
+    ///
+    /// The type is resolved first, so a TypeRef and the TypeDef to which it refers have the same
+    /// hash, and a TypeSpec is hashed by the contents of its signature.
+    auto hash_type(metadata::type_resolver const& resolver, metadata::type_def_ref_spec_token const& type) -> core::size_type
+    {
+        metadata::type_def_spec_token const resolved_type(resolver.resolve_type(type));
+        if (resolved_type.table() == metadata::table_id::type_def)
+            return mix_hash(hash_pointer(&resolved_type.scope()), resolved_type.value());
+
+        metadata::blob const signature(row_from(resolved_type.as<metadata::type_spec_token>()).signature());
+        return hash_signature(resolver, metadata::type_signature(&resolved_type.scope(), begin(signature), end(signature)));
+    }
+
+    /// Hashes a type signature structurally, consistently with the `signature_comparer`
+    ///
+    /// Two signatures that the comparer considers equal must have the same hash.  The comparer
+    /// ignores custom modifiers, so we do too; the array shape of a general array is only hashed
+    /// by its rank.
+    auto hash_signature(metadata::type_resolver const& resolver, metadata::type_signature const& signature) -> core::size_type
+    {
+        typedef metadata::type_signature::kind kind;
+
+        core::size_type hash(mix_hash(2166136261, static_cast<core::size_type>(signature.get_kind())));
+        switch (signature.get_kind())
+        {
+        case kind::primitive:
+        {
+            return mix_hash(hash, core::as_integer(signature.primitive_type()));
+        }
+        case kind::general_array:
+        {
+            hash = mix_hash(hash, hash_signature(resolver, signature.array_type()));
+            return mix_hash(hash, signature.array_shape().rank());
+        }
+        case kind::simple_array:
+        {
+            return mix_hash(hash, hash_signature(resolver, signature.array_type()));
+        }
+        case kind::class_type:
+        {
+            hash = mix_hash(hash, signature.is_class_type() ? 1 : 0);
+            return mix_hash(hash, hash_type(resolver, signature.class_type()));
+        }
+        case kind::generic_instance:
+        {
+            hash = mix_hash(hash, signature.is_generic_class_type_instance() ? 1 : 0);
+            hash = mix_hash(hash, hash_type(resolver, signature.generic_type()));
+            core::for_all(signature.generic_arguments(), [&](metadata::type_signature const& argument)
+            {
+                hash = mix_hash(hash, hash_signature(resolver, argument));
+            });
+            return hash;
+        }
+        case kind::pointer:
+        {
+            return mix_hash(hash, hash_signature(resolver, signature.pointer_type()));
+        }
+        case kind::variable:
+        {
+            hash = mix_hash(hash, signature.is_class_variable() ? 1 : 0);
+            return mix_hash(hash, signature.variable_number());
+        }
+        default:
+        {
+            // Function pointers are compared structurally but are rare enough that we need not
+            // distinguish them in the hash:
+            return hash;
+        }
+        }
+    }
+
+} } } }
+
+namespace cxxreflect { namespace reflection { namespace detail {
+
+    canonical_type_id::canonical_type_id()
+    {
+    }
+
+    canonical_type_id::canonical_type_id(core::size_type const value)
+        : _value(value + 1)
+    {
+    }
+
+    auto canonical_type_id::value() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return _value.get() - 1;
+    }
+
+    auto canonical_type_id::is_initialized() const -> bool
+    {
+        return _value.get() != 0;
+    }
+
+
+
+
+
+    canonical_type_storage::canonical_type_storage()
+        : _next_id(0)
+    {
+    }
+
+    canonical_type_storage::~canonical_type_storage()
+    {
+        // For completeness
+    }
+
+    auto canonical_type_storage::get_id(key_type const& key) -> canonical_type_id
+    {
+        core::assert_initialized(key);
+
+        if (key.is_token())
+            return module_context::from(key.scope()).canonical_id(key.as_token());
+
+        // Fast path:  most signatures have been seen before, so we find them by identity without
+        // taking a lock or hashing their contents:
+        core::const_byte_iterator const first(key.as_blob().begin());
+        canonical_type_id const existing_id(_identity_index.find(first));
+        if (existing_id.is_initialized())
+            return existing_id;
+
+        // If the signature cannot be canonicalized (e.g. because one of its type references cannot
+        // be resolved), this throws, and we do not record an id for the blob:
+        canonical_type_id const new_id(compute_signature_id(key.as_blob().as<metadata::type_signature>()));
+
+        // Another thread may have inserted the blob while we were computing its id; if so, its id
+        // wins:
+        return _identity_index.find_or_insert(first, [&]{ return new_id; });
+    }
+
+    auto canonical_type_storage::reserve_definition_ids(core::size_type const count) -> core::size_type
+    {
+        auto const lock(_id_sync.lock());
+
+        core::size_type const first_id(_next_id);
+        _next_id += count;
+        return first_id;
+    }
+
+    auto canonical_type_storage::signature_count() const -> core::size_type
+    {
+        auto const lock(_structural_sync.lock());
+        return core::convert_integer(_structural_index.size());
+    }
+
+    auto canonical_type_storage::compute_signature_id(metadata::type_signature const& signature) -> canonical_type_id
+    {
+        loader_context const& loader(loader_context::from(signature.scope()));
+
+        // The meaning of a generic variable depends on the context from which the signature was
+        // obtained, and the signature comparer ignores custom modifiers, so such signatures are
+        // only canonical to themselves:
+        if (metadata::signature_instantiator::requires_instantiation(signature) ||
+            !signature.custom_modifiers().empty())
+            return allocate_id();
+
+        // A signature that just names a type is the same type as the type it names:
+        if (!signature.is_by_ref())
+        {
+            if (signature.is_primitive())
+            {
+                return get_id(loader.resolve_fundamental_type(signature.primitive_type()));
+            }
+            else if (signature.is_kind(metadata::type_signature::kind::class_type))
+            {
+                metadata::type_def_spec_token const type(loader.resolve_type(signature.class_type()));
+                return type.table() == metadata::table_id::type_def
+                    ? get_id(type.as<metadata::type_def_token>())
+                    : get_id(row_from(type.as<metadata::type_spec_token>()).signature());
+            }
+        }
+
+        // Otherwise, we have to find a structurally equal signature that already has an id.  We
+        // hash the signature before we take the lock because hashing resolves type references:
+        core::size_type const hash(hash_signature(loader, signature));
+
+        auto const lock(_structural_sync.lock());
+
+        metadata::signature_comparer const compare(&loader);
+
+        auto const candidates(_structural_index.equal_range(hash));
+        auto const it(std::find_if(candidates.first, candidates.second, [&](structural_index::value_type const& entry)
+        {
+            return entry.second.first.is_by_ref() == signature.is_by_ref()
+                && compare(entry.second.first, signature);
+        }));
+
+        if (it != candidates.second)
+            return it->second.second;
+
+        canonical_type_id const new_id(allocate_id());
+        _structural_index.insert(std::make_pair(hash, structural_entry(signature, new_id)));
+        return new_id;
+    }
+
+    auto canonical_type_storage::allocate_id() -> canonical_type_id
+    {
+        auto const lock(_id_sync.lock());
+        return canonical_type_id(_next_id++);
+    }
+
+} } }
@@ -0,0 +1,125 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#ifndef CXXREFLECT_REFLECTION_DETAIL_CANONICAL_TYPE_HPP_
+#define CXXREFLECT_REFLECTION_DETAIL_CANONICAL_TYPE_HPP_
+
+#include "cxxreflect/reflection/detail/concurrent_index.hpp"
+#include "cxxreflect/reflection/detail/forward_declarations.hpp"
+
+
+
+
+
+namespace cxxreflect { namespace reflection { namespace detail {
+
+    /// A small, stable identifier for a resolved type, unique within a loader
+    ///
+    /// Every resolved type in a loader, whether it is a type definition or a type signature, maps
+    /// to exactly one canonical type id, and two resolved types are the same type if and only if
+    /// their ids are equal.  Comparing and hashing ids are integer operations.  See the
+    /// `canonical_type_storage`, which assigns the ids.
+    class canonical_type_id
+    {
+    public:
+
+        canonical_type_id();
+        explicit canonical_type_id(core::size_type value);
+
+        auto value() const -> core::size_type;
+
+        auto is_initialized() const -> bool;
+
+        friend auto operator==(canonical_type_id const& lhs, canonical_type_id const& rhs) -> bool
+        {
+            return lhs._value.get() == rhs._value.get();
+        }
+
+        friend auto operator<(canonical_type_id const& lhs, canonical_type_id const& rhs) -> bool
+        {
+            return lhs._value.get() < rhs._value.get();
+        }
+
+        CXXREFLECT_GENERATE_COMPARISON_OPERATORS(canonical_type_id)
+
+    private:
+
+        // The value is stored biased by one so that zero can represent an uninitialized id:
+        core::value_initialized<core::size_type> _value;
+    };
+
+
+
+
+
+    /// Assigns canonical type ids to the resolved types of a loader (i.e., hash-conses them)
+    ///
+    /// Type definitions are cheap to canonicalize:  each module reserves a consecutive range of ids
+    /// for its TypeDef table when it is loaded, so the id of a type definition is the base of the
+    /// range of its module plus its row index.
+    ///
+    /// Type signatures are harder, because the same type may be represented by many signatures
+    /// (e.g., `IVector<String>` may be referenced from two modules, or instantiated by two member
+    /// tables).  A signature is first looked up by the identity of its blob, in a `concurrent_index`;
+    /// this lookup does not take a lock.  If the blob has not been seen,
+    /// the signature is hashed structurally, with its type references resolved to their
+    /// definitions, and compared with the other signatures that have the same hash using the
+    /// `signature_comparer`.  A signature that is just a class type or a primitive type is
+    /// canonicalized to the id of its type definition.
+    ///
+    /// Signatures that contain generic variables are only canonical to themselves, because the
+    /// meaning of a variable depends on the context from which the signature was obtained.  If a
+    /// type reference in a signature cannot be resolved, the signature cannot be canonicalized, so
+    /// the error is propagated to the caller and no id is assigned.
+    ///
+    /// Locking:  the structural index lock is held while signatures are compared, which may resolve
+    /// type references and load assemblies.  The id range lock and the identity index lock are
+    /// leaf locks:  no other lock is acquired while either is held, so a module may reserve its ids
+    /// while the loader is loading its assembly.
+    class canonical_type_storage
+    {
+    public:
+
+        typedef metadata::type_def_or_signature key_type;
+
+        canonical_type_storage();
+        ~canonical_type_storage();
+
+        /// Gets the canonical id of `key`, assigning a new id if no equivalent type has one yet.
+        /// The `key` must be a type definition or a persistent type signature in this loader.
+        auto get_id(key_type const& key) -> canonical_type_id;
+
+        /// Reserves `count` consecutive ids for the type definitions of a module and returns the
+        /// value of the first id in the range
+        auto reserve_definition_ids(core::size_type count) -> core::size_type;
+
+        /// Gets the number of structurally distinct signatures that have been assigned ids
+        auto signature_count() const -> core::size_type;
+
+    private:
+
+        typedef concurrent_index<core::const_byte_iterator, canonical_type_id, metadata_pointer_hash> identity_index;
+
+        typedef std::pair<metadata::type_signature, canonical_type_id> structural_entry;
+        typedef std::multimap<core::size_type, structural_entry>       structural_index;
+
+        canonical_type_storage(canonical_type_storage const&);
+        auto operator=(canonical_type_storage const&) -> canonical_type_storage&;
+
+        auto compute_signature_id(metadata::type_signature const& signature) -> canonical_type_id;
+        auto allocate_id() -> canonical_type_id;
+
+        identity_index                _identity_index;  // Finds the ids of blobs that have been seen
+
+        structural_index              _structural_index;
+        core::recursive_mutex mutable _structural_sync;
+
+        core::size_type               _next_id;
+        core::recursive_mutex         _id_sync;
+    };
+
+} } }
+
+#endif
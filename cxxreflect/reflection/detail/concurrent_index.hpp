@@ -0,0 +1,193 @@
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#ifndef CXXREFLECT_REFLECTION_DETAIL_CONCURRENT_INDEX_HPP_
+#define CXXREFLECT_REFLECTION_DETAIL_CONCURRENT_INDEX_HPP_
+
+#include "cxxreflect/reflection/detail/forward_declarations.hpp"
+
+
+
+
+
+namespace cxxreflect { namespace reflection { namespace detail {
+
+    /// Hashes a pointer into metadata (e.g. the first byte of a blob or of a row)
+    ///
+    /// Such a pointer may point to any byte of its heap or table, so every bit of it is significant.
+    class metadata_pointer_hash
+    {
+    public:
+
+        auto operator()(core::const_byte_iterator const pointer) const -> core::size_type
+        {
+            std::uintptr_t const value(reinterpret_cast<std::uintptr_t>(pointer));
+            return static_cast<core::size_type>(value ^ (value >> 16));
+        }
+    };
+
+
+
+
+
+    /// A hash index that is searched without locking and that grows as entries are inserted
+    ///
+    /// Each generation of the index is a chained hash table of fixed capacity.  Insertions are
+    /// serialized by the index lock; lookups are not synchronized.  A node is fully initialized
+    /// before it is stored in its bucket and is never modified after that, so a reader always sees
+    /// a consistent chain.  When a table is full, its entries are copied into a new table with
+    /// twice as many buckets, which then replaces it.  The old table is kept alive, because readers
+    /// may still be searching it; a reader that misses a key in an old table finds it when it
+    /// searches again under the lock, in `find_or_insert`.
+    ///
+    /// `Value` must be cheap to copy; `find` returns a value-initialized `Value` for a key that is
+    /// not in the index.  `Hash` computes the hash of a key; the low bits of the hash select the
+    /// bucket, so they must be well distributed.
+    template <typename Key, typename Value, typename Hash>
+    class concurrent_index
+    {
+    public:
+
+        typedef Key   key_type;
+        typedef Value value_type;
+        typedef Hash  hash_type;
+
+        explicit concurrent_index(core::size_type const initial_bucket_count = 1 << 8)
+        {
+            _tables.push_back(core::make_unique<table>(initial_bucket_count));
+            _table.store(_tables.back().get());
+        }
+
+        /// Finds the value for `key`, or returns a value-initialized value if there is none
+        auto find(key_type const& key) const -> value_type
+        {
+            node const* const existing(_table.load()->find(key));
+            return existing != nullptr ? existing->_value : value_type();
+        }
+
+        /// Finds the value for `key`, or inserts the value returned by `create()` if there is none
+        ///
+        /// `create` is called under the index lock, which is a leaf lock, so it must not acquire
+        /// any other lock (e.g. it must not resolve types).  Compute anything expensive first.
+        template <typename Create>
+        auto find_or_insert(key_type const& key, Create create) -> value_type
+        {
+            auto const lock(_sync.lock());
+
+            table* current(_table.load());
+
+            node const* const existing(current->find(key));
+            if (existing != nullptr)
+                return existing->_value;
+
+            if (current->is_full())
+            {
+                std::unique_ptr<table> new_table(core::make_unique<table>(current->bucket_count() * 2));
+                current->copy_into(*new_table);
+
+                _tables.push_back(std::move(new_table));
+                current = _tables.back().get();
+                _table.store(current);
+            }
+
+            value_type const value(create());
+            current->insert(key, value);
+            return value;
+        }
+
+    private:
+
+        class node
+        {
+        public:
+
+            node()
+                : _key(), _value(), _next()
+            {
+            }
+
+            key_type   _key;
+            value_type _value;
+            node*      _next;
+        };
+
+        /// A generation of the index:  a chained hash table with one node per bucket
+        class table
+        {
+        public:
+
+            explicit table(core::size_type const bucket_count)
+                : _bucket_count(bucket_count),
+                  _node_count(0),
+                  _buckets(core::make_unique_array<core::atomic<node*>>(bucket_count)),
+                  _nodes(core::make_unique_array<node>(bucket_count))
+            {
+                core::assert_true([&]{ return bucket_count != 0 && (bucket_count & (bucket_count - 1)) == 0; });
+            }
+
+            auto find(key_type const& key) const -> node const*
+            {
+                for (node const* n(_buckets[compute_bucket(key)].load()); n != nullptr; n = n->_next)
+                {
+                    if (n->_key == key)
+                        return n;
+                }
+
+                return nullptr;
+            }
+
+            auto insert(key_type const& key, value_type const& value) -> void
+            {
+                core::assert_true([&]{ return !is_full(); });
+
+                core::size_type const bucket(compute_bucket(key));
+
+                node& new_node(_nodes[_node_count++]);
+                new_node._key   = key;
+                new_node._value = value;
+                new_node._next  = _buckets[bucket].load();
+
+                // The node must be fully initialized before we publish it, because readers do not lock:
+                _buckets[bucket].store(&new_node);
+            }
+
+            auto bucket_count() const -> core::size_type { return _bucket_count;                }
+            auto is_full()      const -> bool            { return _node_count == _bucket_count; }
+
+            /// Inserts every entry of this table into `other`, which must have room for them
+            auto copy_into(table& other) const -> void
+            {
+                for (core::size_type i(0); i != _node_count; ++i)
+                    other.insert(_nodes[i]._key, _nodes[i]._value);
+            }
+
+        private:
+
+            table(table const&);
+            auto operator=(table const&) -> table&;
+
+            auto compute_bucket(key_type const& key) const -> core::size_type
+            {
+                return hash_type()(key) & (_bucket_count - 1);
+            }
+
+            core::size_type                        _bucket_count;
+            core::size_type                        _node_count;
+            std::unique_ptr<core::atomic<node*>[]> _buckets;
+            std::unique_ptr<node[]>                _nodes;   // One per bucket; nodes never move
+        };
+
+        typedef std::vector<std::unique_ptr<table>> table_sequence;
+
+        concurrent_index(concurrent_index const&);
+        auto operator=(concurrent_index const&) -> concurrent_index&;
+
+        core::atomic<table*>  _table;  // The current generation of the index
+        table_sequence        _tables; // Every generation, kept alive for readers
+        core::recursive_mutex _sync;   // Serializes insertions into the index
+    };
+
+} } }
+
+#endif
@@ -0,0 +1,629 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "cxxreflect/reflection/precompiled_headers.hpp"
+#include "cxxreflect/reflection/detail/assembly_context.hpp"
+#include "cxxreflect/reflection/detail/custom_attribute_decoder.hpp"
+#include "cxxreflect/reflection/detail/loader_context.hpp"
+#include "cxxreflect/reflection/detail/module_context.hpp"
+#include "cxxreflect/reflection/assembly_name.hpp"
+#include "cxxreflect/reflection/method.hpp"
+#include "cxxreflect/reflection/type.hpp"
+
+
+
+
+
+namespace cxxreflect { namespace reflection { namespace detail { namespace {
+
+    /// Gets the size of a fixed-size value of type `type`, or zero if values of `type` are not of
+    /// fixed size
+    auto compute_fixed_value_size(metadata::element_type const type) -> core::size_type
+    {
+        switch (type)
+        {
+        case metadata::element_type::boolean:
+        case metadata::element_type::i1:
+        case metadata::element_type::u1:
+            return 1;
+
+        case metadata::element_type::character:
+        case metadata::element_type::i2:
+        case metadata::element_type::u2:
+            return 2;
+
+        case metadata::element_type::i4:
+        case metadata::element_type::u4:
+        case metadata::element_type::r4:
+            return 4;
+
+        case metadata::element_type::i8:
+        case metadata::element_type::u8:
+        case metadata::element_type::r8:
+            return 8;
+
+        default:
+            return 0;
+        }
+    }
+
+    auto is_scalar_value_type(metadata::element_type const type) -> bool
+    {
+        return compute_fixed_value_size(type) != 0
+            || type == metadata::element_type::string
+            || type == metadata::element_type::type
+            || type == metadata::element_type::custom_attribute_boxed_object;
+    }
+
+    /// Gets the underlying type of the enumeration `type`.  An enumeration has exactly one instance
+    /// field (named `value__`), whose type is the underlying type.
+    auto compute_enum_underlying_type(metadata::type_def_token const& type) -> metadata::element_type
+    {
+        auto const fields(metadata::find_fields(type));
+        auto const value_field(core::find_if(fields, [](metadata::field_row const& field)
+        {
+            return !field.flags().is_set(metadata::field_attribute::static_);
+        }));
+
+        if (value_field == end(fields))
+            throw core::runtime_error(L"failed to find the value field of an enumeration");
+
+        metadata::type_signature const value_type((*value_field).signature().as<metadata::field_signature>().type());
+        if (!value_type.is_primitive() || compute_fixed_value_size(value_type.primitive_type()) == 0)
+            throw core::runtime_error(L"enumeration has an invalid underlying type");
+
+        return value_type.primitive_type();
+    }
+
+    auto find_type_in_assembly(assembly_context       const& assembly,
+                               core::string_reference const& namespace_name,
+                               core::string_reference const& name) -> metadata::type_def_token
+    {
+        metadata::type_def_token result;
+        core::for_all(assembly.modules(), [&](unique_module_context const& module)
+        {
+            if (!result.is_initialized())
+                result = module->type_def_index().find(namespace_name, name);
+        });
+
+        return result;
+    }
+
+    auto trim_spaces(core::string const& s) -> core::string
+    {
+        core::string::size_type const first(s.find_first_not_of(L' '));
+        if (first == core::string::npos)
+            return core::string();
+
+        return s.substr(first, s.find_last_not_of(L' ') - first + 1);
+    }
+
+    /// Resolves the enumeration named by `utf8_name` in a FieldOrPropType encoding
+    ///
+    /// The name is a type name, optionally followed by a comma and the name of the assembly that
+    /// defines the type.  An unqualified name refers to a type in the assembly that contains the
+    /// attribute or in the system assembly.  A qualified name refers either to an assembly that is
+    /// referenced by the module, which we look for among the module's assembly references, or to
+    /// the module's own assembly.  If it names neither, we throw a `runtime_error`; a qualified
+    /// name must never silently resolve to a type in some other assembly.
+    ///
+    /// The name of a nested type is the name of its enclosing type, a `+`, and its simple name.  We
+    /// find the outermost type as above, then each nested type within the type that encloses it.
+    auto resolve_enum_by_name(metadata::database const& scope, core::const_byte_range const& utf8_name)
+        -> metadata::type_def_token
+    {
+        core::string const qualified_name(convert_custom_attribute_string(utf8_name));
+
+        core::string::size_type const assembly_separator(qualified_name.find(L','));
+        core::string const full_type_name(trim_spaces(qualified_name.substr(0, assembly_separator)));
+
+        core::string::size_type const nested_separator(full_type_name.find(L'+'));
+        core::string const type_name(full_type_name.substr(0, nested_separator));
+
+        core::string::size_type const namespace_separator(type_name.rfind(L'.'));
+        core::string const namespace_name(namespace_separator == core::string::npos
+            ? core::string()
+            : type_name.substr(0, namespace_separator));
+        core::string const simple_name(namespace_separator == core::string::npos
+            ? type_name
+            : type_name.substr(namespace_separator + 1));
+
+        loader_context const& loader(loader_context::from(scope));
+        assembly_context const& scope_assembly(module_context::from(scope).assembly());
+
+        metadata::type_def_token result;
+        if (assembly_separator == core::string::npos)
+        {
+            result = find_type_in_assembly(scope_assembly, namespace_name.c_str(), simple_name.c_str());
+            if (!result.is_initialized())
+                result = find_type_in_assembly(loader.system_module().assembly(), namespace_name.c_str(), simple_name.c_str());
+        }
+        else
+        {
+            core::string const assembly_name(trim_spaces(qualified_name.substr(
+                assembly_separator + 1,
+                qualified_name.find(L',', assembly_separator + 1) - assembly_separator - 1)));
+
+            auto const references(scope.table<metadata::table_id::assembly_ref>());
+            auto const reference(core::find_if(references, [&](metadata::assembly_ref_row const& row)
+            {
+                return row.name() == core::string_reference(assembly_name.c_str());
+            }));
+
+            if (reference == end(references) && scope_assembly.name().simple_name() != assembly_name)
+                throw core::runtime_error(L"enumeration type of a custom attribute argument names an unreferenced assembly");
+
+            assembly_context const& target_assembly(reference != end(references)
+                ? module_context::from(loader.resolve_assembly_ref((*reference).token())).assembly()
+                : scope_assembly);
+
+            result = find_type_in_assembly(target_assembly, namespace_name.c_str(), simple_name.c_str());
+        }
+
+        if (!result.is_initialized())
+            throw core::runtime_error(L"failed to resolve the enumeration type of a custom attribute argument");
+
+        for (core::string::size_type first(nested_separator); first != core::string::npos; )
+        {
+            core::string::size_type const last(full_type_name.find(L'+', first + 1));
+            core::string const nested_name(full_type_name.substr(first + 1, last == core::string::npos
+                ? core::string::npos
+                : last - first - 1));
+
+            result = loader.resolve_nested_type(result, nested_name.c_str());
+            first = last;
+        }
+
+        return result;
+    }
+
+    auto read_scalar_value_type(metadata::database const&  scope,
+                                core::const_byte_iterator& it,
+                                core::const_byte_iterator  last) -> custom_attribute_value_type
+    {
+        metadata::element_type const type(static_cast<metadata::element_type>(metadata::detail::read_sig_byte(it, last)));
+        if (type == metadata::element_type::custom_attribute_enum)
+        {
+            metadata::type_def_token const enum_type(resolve_enum_by_name(scope, read_custom_attribute_string(it, last)));
+            return custom_attribute_value_type(compute_enum_underlying_type(enum_type), metadata::element_type::end, true);
+        }
+
+        if (!is_scalar_value_type(type))
+            throw core::metadata_error(L"invalid custom attribute value type");
+
+        return custom_attribute_value_type(type, metadata::element_type::end, false);
+    }
+
+    auto compute_scalar_value_type(metadata::type_signature const& signature) -> custom_attribute_value_type
+    {
+        if (signature.is_primitive())
+        {
+            metadata::element_type const type(signature.primitive_type());
+            if (type == metadata::element_type::object)
+                return custom_attribute_value_type(metadata::element_type::custom_attribute_boxed_object, metadata::element_type::end, false);
+
+            if (!is_scalar_value_type(type))
+                throw core::runtime_error(L"invalid custom attribute argument type");
+
+            return custom_attribute_value_type(type, metadata::element_type::end, false);
+        }
+
+        if (!signature.is_kind(metadata::type_signature::kind::class_type))
+            throw core::runtime_error(L"invalid custom attribute argument type");
+
+        loader_context const& loader(loader_context::from(signature.scope()));
+
+        metadata::type_def_spec_token const resolved_type(loader.resolve_type(signature.class_type()));
+        if (resolved_type.table() != metadata::table_id::type_def)
+            throw core::runtime_error(L"invalid custom attribute argument type");
+
+        metadata::type_def_token const type(resolved_type.as<metadata::type_def_token>());
+
+        // The only value types that may be used are enumerations; the only reference types are
+        // System.Type and System.Object (which is usually encoded as OBJECT, handled above):
+        if (signature.is_value_type())
+            return custom_attribute_value_type(compute_enum_underlying_type(type), metadata::element_type::end, true);
+
+        metadata::type_def_row const type_row(row_from(type));
+        if (type_row.namespace_name() == loader.system_namespace())
+        {
+            if (type_row.name() == L"Type")
+                return custom_attribute_value_type(metadata::element_type::type, metadata::element_type::end, false);
+
+            if (type_row.name() == L"Object")
+                return custom_attribute_value_type(metadata::element_type::custom_attribute_boxed_object, metadata::element_type::end, false);
+        }
+
+        throw core::runtime_error(L"invalid custom attribute argument type");
+    }
+
+    /// Gets the signature of the constructor of `attribute`, with its generic class variables
+    /// replaced by the generic arguments of the attribute type if that type is an instantiation
+    auto get_constructor_signature(metadata::custom_attribute_token const& attribute) -> metadata::method_signature
+    {
+        metadata::custom_attribute_type_token const constructor(row_from(attribute).type());
+        switch (constructor.table())
+        {
+        case metadata::table_id::method_def:
+            return row_from(constructor.as<metadata::method_def_token>()).signature().as<metadata::method_signature>();
+
+        case metadata::table_id::member_ref:
+        {
+            // The signature of a reference to a constructor of a generic attribute type (which has a
+            // TypeSpec parent) refers to the generic parameters of the type; the instantiated
+            // signature is found in the member table of the attribute type:
+            metadata::member_ref_row const ref_row(row_from(constructor.as<metadata::member_ref_token>()));
+            if (ref_row.parent().table() == metadata::table_id::type_spec)
+                return module_context::from(attribute.scope()).attribute_constructor(attribute).constructor().member_signature();
+
+            return ref_row.signature().as<metadata::method_signature>();
+        }
+
+        default:
+            core::assert_unreachable();
+        }
+    }
+
+} } } }
+
+namespace cxxreflect { namespace reflection { namespace detail {
+
+    custom_attribute_value_type::custom_attribute_value_type()
+    {
+    }
+
+    custom_attribute_value_type::custom_attribute_value_type(metadata::element_type const type,
+                                                             metadata::element_type const element_type,
+                                                             bool                   const is_enum)
+        : _type(type), _element_type(element_type), _is_enum(is_enum)
+    {
+        core::assert_true([&]{ return (type == metadata::element_type::sz_array) == (element_type != metadata::element_type::end); });
+    }
+
+    auto custom_attribute_value_type::type() const -> metadata::element_type
+    {
+        core::assert_initialized(*this);
+        return _type.get();
+    }
+
+    auto custom_attribute_value_type::element_type() const -> metadata::element_type
+    {
+        core::assert_initialized(*this);
+        core::assert_true([&]{ return is_array(); });
+        return _element_type.get();
+    }
+
+    auto custom_attribute_value_type::is_enum() const -> bool
+    {
+        core::assert_initialized(*this);
+        return _is_enum.get();
+    }
+
+    auto custom_attribute_value_type::is_array() const -> bool
+    {
+        core::assert_initialized(*this);
+        return _type.get() == metadata::element_type::sz_array;
+    }
+
+    auto custom_attribute_value_type::element() const -> custom_attribute_value_type
+    {
+        return custom_attribute_value_type(element_type(), metadata::element_type::end, _is_enum.get());
+    }
+
+    auto custom_attribute_value_type::is_initialized() const -> bool
+    {
+        return _type.get() != metadata::element_type::end;
+    }
+
+    auto compute_custom_attribute_value_type(metadata::type_signature const& signature) -> custom_attribute_value_type
+    {
+        core::assert_initialized(signature);
+
+        if (!signature.is_simple_array())
+            return compute_scalar_value_type(signature);
+
+        custom_attribute_value_type const element(compute_scalar_value_type(signature.array_type()));
+        return custom_attribute_value_type(metadata::element_type::sz_array, element.type(), element.is_enum());
+    }
+
+    auto read_custom_attribute_value_type(metadata::database const&       scope,
+                                          core::const_byte_iterator&      it,
+                                          core::const_byte_iterator const last) -> custom_attribute_value_type
+    {
+        if (metadata::detail::peek_sig_byte(it, last) != core::as_integer(metadata::element_type::sz_array))
+            return read_scalar_value_type(scope, it, last);
+
+        ++it;
+        custom_attribute_value_type const element(read_scalar_value_type(scope, it, last));
+        return custom_attribute_value_type(metadata::element_type::sz_array, element.type(), element.is_enum());
+    }
+
+    auto skip_custom_attribute_value(metadata::database          const& scope,
+                                     custom_attribute_value_type const& type,
+                                     core::const_byte_iterator&         it,
+                                     core::const_byte_iterator   const  last) -> void
+    {
+        core::assert_initialized(type);
+
+        if (type.is_array())
+        {
+            // A null array is encoded with a count of 0xffffffff and has no elements:
+            std::uint32_t const count(metadata::detail::read_sig_element<std::uint32_t>(it, last));
+            if (count == 0xffffffff)
+                return;
+
+            // Elements of fixed size can be skipped all at once:
+            core::size_type const element_size(compute_fixed_value_size(type.element_type()));
+            if (element_size != 0)
+            {
+                if (core::distance(it, last) / element_size < count)
+                    throw core::metadata_error(L"invalid custom attribute array");
+
+                it += count * element_size;
+                return;
+            }
+
+            custom_attribute_value_type const element(type.element());
+            for (std::uint32_t i(0); i != count; ++i)
+                skip_custom_attribute_value(scope, element, it, last);
+
+            return;
+        }
+
+        switch (type.type())
+        {
+        case metadata::element_type::string:
+        case metadata::element_type::type:
+        {
+            read_custom_attribute_string(it, last);
+            return;
+        }
+        case metadata::element_type::custom_attribute_boxed_object:
+        {
+            custom_attribute_value_type const boxed_type(read_custom_attribute_value_type(scope, it, last));
+            skip_custom_attribute_value(scope, boxed_type, it, last);
+            return;
+        }
+        default:
+        {
+            core::size_type const size(compute_fixed_value_size(type.type()));
+            if (core::distance(it, last) < size)
+                throw core::metadata_error(L"invalid custom attribute value");
+
+            it += size;
+            return;
+        }
+        }
+    }
+
+    auto read_custom_attribute_string(core::const_byte_iterator& it, core::const_byte_iterator const last)
+        -> core::const_byte_range
+    {
+        // A null string is encoded as the single byte 0xff, which is not a valid compressed length:
+        if (metadata::detail::peek_sig_byte(it, last) == 0xff)
+        {
+            ++it;
+            return core::const_byte_range();
+        }
+
+        core::size_type const length(metadata::detail::read_sig_compressed_uint32(it, last));
+        if (core::distance(it, last) < length)
+            throw core::metadata_error(L"invalid custom attribute string");
+
+        core::const_byte_range const result(it, it + length);
+        it += length;
+        return result;
+    }
+
+    auto convert_custom_attribute_string(core::const_byte_range const& utf8_string) -> core::string
+    {
+        if (utf8_string.empty())
+            return core::string();
+
+        std::vector<char> utf8_buffer(utf8_string.begin(), utf8_string.end());
+        utf8_buffer.push_back('\0');
+
+        core::size_type const utf16_length(core::externals::compute_utf16_length_of_utf8_string(utf8_buffer.data()));
+
+        std::vector<wchar_t> utf16_buffer(utf16_length);
+
+        core::externals::convert_utf8_to_utf16(utf8_buffer.data(), utf16_buffer.data(), utf16_length);
+        return core::string(utf16_buffer.data());
+    }
+
+
+
+
+
+    custom_attribute_argument_entry::custom_attribute_argument_entry(custom_attribute_value_type const& type,
+                                                                     core::const_byte_iterator   const  value,
+                                                                     metadata::element_type      const  member_kind,
+                                                                     core::string                       name)
+        : _type(type), _value(value), _member_kind(member_kind), _name(std::move(name))
+    {
+        core::assert_initialized(type);
+        core::assert_not_null(value);
+    }
+
+    auto custom_attribute_argument_entry::type() const -> custom_attribute_value_type const&
+    {
+        return _type;
+    }
+
+    auto custom_attribute_argument_entry::value() const -> core::const_byte_iterator
+    {
+        return _value;
+    }
+
+    auto custom_attribute_argument_entry::member_kind() const -> metadata::element_type
+    {
+        return _member_kind;
+    }
+
+    auto custom_attribute_argument_entry::name() const -> core::string_reference
+    {
+        return _name.c_str();
+    }
+
+
+
+
+
+    custom_attribute_layout::custom_attribute_layout(metadata::custom_attribute_token const& attribute)
+        : _scope(&attribute.scope())
+    {
+        core::assert_initialized(attribute);
+
+        metadata::custom_attribute_row const attribute_row(row_from(attribute));
+        metadata::blob                 const value(attribute_row.value());
+
+        _last = value.end();
+        core::const_byte_iterator it(value.begin());
+
+        // All custom attribute blobs begin with a two-byte, little-endian prolog with the value 1:
+        if (metadata::detail::read_sig_element<std::uint16_t>(it, _last) != 1)
+            throw core::metadata_error(L"invalid custom attribute signature");
+
+        // The encoding of each positional argument is determined by the type of the corresponding
+        // constructor parameter:
+        metadata::method_signature const constructor(get_constructor_signature(attribute));
+        _positional_arguments.reserve(constructor.parameter_count());
+        core::for_all(constructor.parameters(), [&](metadata::type_signature const& parameter)
+        {
+            custom_attribute_value_type const type(compute_custom_attribute_value_type(parameter));
+            _positional_arguments.push_back(custom_attribute_argument_entry(type, it, metadata::element_type::end, core::string()));
+            skip_custom_attribute_value(*_scope, type, it, _last);
+        });
+
+        // Each named argument describes its own encoding.  Some compilers omit the count of named
+        // arguments if there are none, so we tolerate its absence:
+        if (it == _last)
+            return;
+
+        std::uint16_t const named_argument_count(metadata::detail::read_sig_element<std::uint16_t>(it, _last));
+        _named_arguments.reserve(named_argument_count);
+        for (std::uint16_t i(0); i != named_argument_count; ++i)
+        {
+            metadata::element_type const member_kind(static_cast<metadata::element_type>(
+                metadata::detail::read_sig_byte(it, _last)));
+
+            if (member_kind != metadata::element_type::custom_attribute_field &&
+                member_kind != metadata::element_type::custom_attribute_property)
+                throw core::metadata_error(L"invalid custom attribute named argument");
+
+            custom_attribute_value_type const type(read_custom_attribute_value_type(*_scope, it, _last));
+            core::string name(convert_custom_attribute_string(read_custom_attribute_string(it, _last)));
+
+            _named_arguments.push_back(custom_attribute_argument_entry(type, it, member_kind, std::move(name)));
+            skip_custom_attribute_value(*_scope, type, it, _last);
+        }
+    }
+
+    auto custom_attribute_layout::scope() const -> metadata::database const&
+    {
+        return *_scope;
+    }
+
+    auto custom_attribute_layout::last() const -> core::const_byte_iterator
+    {
+        return _last;
+    }
+
+    auto custom_attribute_layout::positional_arguments() const -> entry_sequence const&
+    {
+        return _positional_arguments;
+    }
+
+    auto custom_attribute_layout::named_arguments() const -> entry_sequence const&
+    {
+        return _named_arguments;
+    }
+
+
+
+
+
+    custom_attribute_constructor::custom_attribute_constructor(metadata::custom_attribute_token const& attribute)
+    {
+        core::assert_initialized(attribute);
+
+        metadata::custom_attribute_type_token const constructor_token(row_from(attribute).type());
+
+        // A MemberRef constructor is resolved through the loader, which caches the resolved
+        // MethodDef in the member reference cache of the referencing module, so each distinct
+        // reference is resolved only once, regardless of how many attributes use it:
+        metadata::method_def_token const definition([&]() -> metadata::method_def_token
+        {
+            switch (constructor_token.table())
+            {
+            case metadata::table_id::method_def:
+            {
+                return constructor_token.as<metadata::method_def_token>();
+            }
+
+            case metadata::table_id::member_ref:
+            {
+                metadata::member_ref_token const ref_token(constructor_token.as<metadata::member_ref_token>());
+                metadata::member_ref_row   const ref_row(row_from(ref_token));
+
+                if (ref_row.name() != core::string_reference::from_literal(L".ctor"))
+                    throw core::runtime_error(L"failed to find constructor for attribute");
+
+                return loader_context::from(attribute.scope())
+                    .resolve_member_ref(ref_token)
+                    .as<metadata::method_def_token>();
+            }
+
+            default:
+            {
+                core::assert_unreachable();
+            }
+            }
+        }());
+
+        // A constructor of a generic attribute type is referenced through a TypeSpec that names the
+        // instantiation, so we search the constructors of the instantiated type:
+        metadata::type_def_ref_spec_or_signature const attribute_type([&]() -> metadata::type_def_ref_spec_or_signature
+        {
+            if (constructor_token.table() == metadata::table_id::member_ref)
+            {
+                metadata::member_ref_parent_token const parent(
+                    row_from(constructor_token.as<metadata::member_ref_token>()).parent());
+
+                if (parent.table() == metadata::table_id::type_spec)
+                    return parent.as<metadata::type_spec_token>();
+            }
+
+            return metadata::find_owner_of_method_def(definition).token();
+        }());
+
+        static metadata::binding_flags const flags(metadata::binding_attribute::all_instance);
+
+        type const t(attribute_type, core::internal_key());
+
+        auto const constructors(t.constructors(flags));
+        auto const constructor_it(core::find_if(constructors, [&](method const& ctor)
+        {
+            return ctor.metadata_token() == definition.value();
+        }));
+
+        if (constructor_it == end(constructors))
+            throw core::runtime_error(L"failed to find constructor for attribute");
+
+        _reflected_type    = constructor_it->reflected_type().context(core::internal_key());
+        _constructor.get() = &constructor_it->context(core::internal_key());
+    }
+
+    auto custom_attribute_constructor::reflected_type() const -> metadata::type_def_or_signature const&
+    {
+        return _reflected_type;
+    }
+
+    auto custom_attribute_constructor::constructor() const -> method_table_entry const&
+    {
+        return *_constructor.get();
+    }
+
+} } }
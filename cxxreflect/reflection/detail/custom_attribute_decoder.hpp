@@ -0,0 +1,178 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#ifndef CXXREFLECT_REFLECTION_DETAIL_CUSTOM_ATTRIBUTE_DECODER_HPP_
+#define CXXREFLECT_REFLECTION_DETAIL_CUSTOM_ATTRIBUTE_DECODER_HPP_
+
+#include "cxxreflect/reflection/detail/forward_declarations.hpp"
+
+
+
+
+
+namespace cxxreflect { namespace reflection { namespace detail {
+
+    /// The encoding of a value in a custom attribute blob (ECMA 335-2010 II.23.3)
+    ///
+    /// A value is a primitive, a SerString (used for both `string` and `System.Type` values), a
+    /// boxed value that is prefixed by its own encoding (used for `System.Object` values), or a
+    /// single-dimensional array of one of those.  An enumeration is encoded as its underlying type,
+    /// so we record that a value is an enumeration but otherwise treat it as its underlying type.
+    ///
+    /// The `type()` is one of the primitive element types `boolean` through `string`, or `type`,
+    /// `custom_attribute_boxed_object`, or `sz_array`.  For an array, `element_type()` is the type
+    /// of each element and `is_enum()` applies to the elements.
+    class custom_attribute_value_type
+    {
+    public:
+
+        custom_attribute_value_type();
+        custom_attribute_value_type(metadata::element_type type, metadata::element_type element_type, bool is_enum);
+
+        auto type()         const -> metadata::element_type;
+        auto element_type() const -> metadata::element_type;
+        auto is_enum()      const -> bool;
+        auto is_array()     const -> bool;
+
+        /// Gets the encoding of each element of an array
+        auto element() const -> custom_attribute_value_type;
+
+        auto is_initialized() const -> bool;
+
+    private:
+
+        core::value_initialized<metadata::element_type> _type;
+        core::value_initialized<metadata::element_type> _element_type;
+        core::value_initialized<bool>                   _is_enum;
+    };
+
+    /// Computes the encoding of a fixed argument whose constructor parameter has type `signature`.
+    /// Enumeration types are resolved to find their underlying types.  Throws a `runtime_error` if
+    /// the type cannot be the type of a custom attribute argument.
+    auto compute_custom_attribute_value_type(metadata::type_signature const& signature) -> custom_attribute_value_type;
+
+    /// Reads a FieldOrPropType encoding, which precedes each named argument and each boxed value,
+    /// and advances `it` past it.  An enumeration is named by its (optionally assembly-qualified)
+    /// type name, which is resolved from `scope`.
+    auto read_custom_attribute_value_type(metadata::database const&  scope,
+                                          core::const_byte_iterator& it,
+                                          core::const_byte_iterator  last) -> custom_attribute_value_type;
+
+    /// Advances `it` past a value encoded as `type`, without decoding it
+    auto skip_custom_attribute_value(metadata::database           const& scope,
+                                     custom_attribute_value_type  const& type,
+                                     core::const_byte_iterator&          it,
+                                     core::const_byte_iterator           last) -> void;
+
+    /// Reads a SerString and advances `it` past it.  Returns the UTF-8 bytes of the string, which
+    /// remain in the blob heap; a null string is returned as an uninitialized range.
+    auto read_custom_attribute_string(core::const_byte_iterator& it, core::const_byte_iterator last) -> core::const_byte_range;
+
+    /// Converts the UTF-8 bytes of a SerString to a string; a null string is converted to an empty
+    /// string
+    auto convert_custom_attribute_string(core::const_byte_range const& utf8_string) -> core::string;
+
+
+
+
+
+    /// The encoding and location of a single argument in a custom attribute blob
+    class custom_attribute_argument_entry
+    {
+    public:
+
+        custom_attribute_argument_entry(custom_attribute_value_type const& type,
+                                        core::const_byte_iterator          value,
+                                        metadata::element_type             member_kind,
+                                        core::string                       name);
+
+        auto type()  const -> custom_attribute_value_type const&;
+        auto value() const -> core::const_byte_iterator;
+
+        /// For a named argument, `custom_attribute_field` or `custom_attribute_property`; for a
+        /// positional argument, `end`
+        auto member_kind() const -> metadata::element_type;
+
+        /// For a named argument, the name of the field or property; otherwise an empty string
+        auto name() const -> core::string_reference;
+
+    private:
+
+        custom_attribute_value_type _type;
+        core::const_byte_iterator   _value;
+        metadata::element_type      _member_kind;
+        core::string                _name;
+    };
+
+    /// The layout of the arguments in a custom attribute blob
+    ///
+    /// Arguments are variable-length, and the encoding of a positional argument is determined by
+    /// the constructor's signature (which may require us to resolve enumeration types), so finding
+    /// the Nth argument requires us to decode every argument before it.  The layout records the
+    /// encoding and position of each argument.  It is computed once per CustomAttribute row (see
+    /// `module_context::attribute_layout()`); the values themselves are not decoded or copied
+    /// until they are requested.
+    class custom_attribute_layout
+    {
+    public:
+
+        typedef std::vector<custom_attribute_argument_entry> entry_sequence;
+
+        /// Decodes the layout of `attribute`.  Throws a `metadata_error` if the blob is malformed
+        /// and a `runtime_error` if a type used by an argument cannot be resolved.
+        explicit custom_attribute_layout(metadata::custom_attribute_token const& attribute);
+
+        auto scope() const -> metadata::database const&;
+
+        /// Gets the end of the blob; each argument extends at most to the end of the blob
+        auto last()  const -> core::const_byte_iterator;
+
+        auto positional_arguments() const -> entry_sequence const&;
+        auto named_arguments()      const -> entry_sequence const&;
+
+    private:
+
+        custom_attribute_layout(custom_attribute_layout const&);
+        auto operator=(custom_attribute_layout const&) -> custom_attribute_layout&;
+
+        core::checked_pointer<metadata::database const> _scope;
+        core::const_byte_iterator                       _last;
+        entry_sequence                                  _positional_arguments;
+        entry_sequence                                  _named_arguments;
+    };
+
+
+
+
+
+    /// The resolved constructor of a custom attribute
+    ///
+    /// Finding the constructor requires us to build the member table of the attribute type and, for
+    /// a MemberRef constructor, to resolve the reference and compare signatures.  The result never
+    /// changes, so it is computed once per CustomAttribute row (see
+    /// `module_context::attribute_constructor()`).
+    class custom_attribute_constructor
+    {
+    public:
+
+        /// Resolves the constructor of `attribute`.  Throws a `runtime_error` if the constructor
+        /// cannot be found.
+        explicit custom_attribute_constructor(metadata::custom_attribute_token const& attribute);
+
+        auto reflected_type() const -> metadata::type_def_or_signature const&;
+        auto constructor()    const -> method_table_entry const&;
+
+    private:
+
+        custom_attribute_constructor(custom_attribute_constructor const&);
+        auto operator=(custom_attribute_constructor const&) -> custom_attribute_constructor&;
+
+        metadata::type_def_or_signature                 _reflected_type;
+        core::checked_pointer<method_table_entry const> _constructor;
+    };
+
+} } }
+
+#endif
@@ -14,17 +14,25 @@ namespace cxxreflect { namespace reflection {
     class assembly_name;
     class constant;
     class custom_attribute;
+    class custom_attribute_argument;
+    class custom_attribute_element_iterator;
+    class custom_attribute_named_argument;
     class custom_modifier_iterator;
+    class enum_value;
+    class enum_value_table;
     class event;
     class field;
     class file;
     class guid;
     class loader;
     class loader_configuration;
+    class manifest_resource;
     class method;
     class module;
     class module_location;
     class module_locator;
+    class module_preresolution_result;
+    class module_visitor;
     class parameter;
     class property;
     class type;
@@ -48,6 +56,14 @@ namespace cxxreflect { namespace reflection {
         unicode_string_format
     };
 
+    /// The forms of the name of a type; see `type::format_name_into()`
+    enum class type_name_kind
+    {
+        simple_name,
+        full_name,
+        assembly_qualified_name
+    };
+
     enum class type_visibility
     {
         unknown,
@@ -71,16 +87,31 @@ namespace cxxreflect { namespace reflection { namespace detail {
     class assembly_context;
     class array_type_policy;
     class by_ref_type_policy;
+    class canonical_type_id;
+    class canonical_type_storage;
+    class custom_attribute_argument_entry;
+    class custom_attribute_constructor;
+    class custom_attribute_layout;
+    class custom_attribute_value_type;
     class definition_type_policy;
     class generic_instantiation_type_policy;
     class generic_variable_type_policy;
+    class interface_closure;
+    class interface_closure_block;
     class loader_context;
+    class member_table_cursor;
     class member_table_entry;
     class member_table_entry_with_instantiation;
     class member_table_entry_with_override_slot;
+    class member_table_instantiation;
+    class member_table_layer;
+    class member_table_packed_entry;
     class membership_context;
     class membership_handle;
+    class membership_statistics;
     class membership_storage;
+    class method_parameter_descriptor;
+    class method_parameter_table;
     class module_context;
     class module_type_def_index;
     class module_type_def_index_iterator_constructor;
@@ -89,7 +120,12 @@ namespace cxxreflect { namespace reflection { namespace detail {
     class pointer_type_policy;
     class specialization_type_policy;
     class reference_type_policy;
+    class type_def_ancestry;
+    class type_name_cache;
     class type_policy;
+    class type_policy_dispatch;
+
+    enum class type_policy_kind : std::uint8_t;
 
     typedef core::instantiating_iterator
     <
@@ -161,6 +197,8 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
     template <member_kind> class member_table_entry_facade;
     template <member_kind> class member_table_iterator_constructor;
+    template <member_kind> class member_name_iterator_constructor;
+    template <member_kind> class member_view_iterator_constructor;
     template <member_kind> class member_traits;
 
     typedef member_table_entry_facade<member_kind::event     > event_table_entry;
@@ -176,35 +214,35 @@ namespace cxxreflect { namespace reflection { namespace detail {
     typedef member_traits<member_kind::property  > property_traits;
 
     typedef core::instantiating_iterator<
-        core::stride_iterator,
+        member_table_cursor,
         member_table_entry_facade<member_kind::event> const*,
         member_kind,
         member_table_iterator_constructor<member_kind::event>
     > event_table_iterator;
 
     typedef core::instantiating_iterator<
-        core::stride_iterator,
+        member_table_cursor,
         member_table_entry_facade<member_kind::field> const*,
         member_kind,
         member_table_iterator_constructor<member_kind::field>
     > field_table_iterator;
 
     typedef core::instantiating_iterator<
-        core::stride_iterator,
+        member_table_cursor,
         member_table_entry_facade<member_kind::interface_> const*,
         member_kind,
         member_table_iterator_constructor<member_kind::interface_>
     > interface_table_iterator;
 
     typedef core::instantiating_iterator<
-        core::stride_iterator,
+        member_table_cursor,
         member_table_entry_facade<member_kind::method> const*,
         member_kind,
         member_table_iterator_constructor<member_kind::method>
     > method_table_iterator;
 
     typedef core::instantiating_iterator<
-        core::stride_iterator,
+        member_table_cursor,
         member_table_entry_facade<member_kind::property> const*,
         member_kind,
         member_table_iterator_constructor<member_kind::property>
@@ -216,6 +254,69 @@ namespace cxxreflect { namespace reflection { namespace detail {
     typedef core::iterator_range<method_table_iterator   > method_table_range;
     typedef core::iterator_range<property_table_iterator > property_table_range;
 
+    class member_name_index;
+    class member_name_index_entry;
+
+    typedef core::instantiating_iterator<
+        member_name_index_entry const*,
+        member_table_entry_facade<member_kind::event> const*,
+        member_table_layer const*,
+        member_name_iterator_constructor<member_kind::event>
+    > event_name_iterator;
+
+    typedef core::instantiating_iterator<
+        member_name_index_entry const*,
+        member_table_entry_facade<member_kind::field> const*,
+        member_table_layer const*,
+        member_name_iterator_constructor<member_kind::field>
+    > field_name_iterator;
+
+    typedef core::instantiating_iterator<
+        member_name_index_entry const*,
+        member_table_entry_facade<member_kind::method> const*,
+        member_table_layer const*,
+        member_name_iterator_constructor<member_kind::method>
+    > method_name_iterator;
+
+    typedef core::instantiating_iterator<
+        member_name_index_entry const*,
+        member_table_entry_facade<member_kind::property> const*,
+        member_table_layer const*,
+        member_name_iterator_constructor<member_kind::property>
+    > property_name_iterator;
+
+    typedef core::iterator_range<event_name_iterator   > event_name_range;
+    typedef core::iterator_range<field_name_iterator   > field_name_range;
+    typedef core::iterator_range<method_name_iterator  > method_name_range;
+    typedef core::iterator_range<property_name_iterator> property_name_range;
+
+    class member_view;
+
+    typedef core::instantiating_iterator<
+        std::uint32_t const*,
+        member_table_entry_facade<member_kind::field> const*,
+        member_table_layer const*,
+        member_view_iterator_constructor<member_kind::field>
+    > field_view_iterator;
+
+    typedef core::instantiating_iterator<
+        std::uint32_t const*,
+        member_table_entry_facade<member_kind::method> const*,
+        member_table_layer const*,
+        member_view_iterator_constructor<member_kind::method>
+    > method_view_iterator;
+
+    typedef core::instantiating_iterator<
+        std::uint32_t const*,
+        member_table_entry_facade<member_kind::property> const*,
+        member_table_layer const*,
+        member_view_iterator_constructor<member_kind::property>
+    > property_view_iterator;
+
+    typedef core::iterator_range<field_view_iterator   > field_view_range;
+    typedef core::iterator_range<method_view_iterator  > method_view_range;
+    typedef core::iterator_range<property_view_iterator> property_view_range;
+
     using std::begin;
     using std::end;
 
@@ -42,7 +42,7 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
 namespace cxxreflect { namespace reflection { namespace detail {
 
     loader_context::loader_context(module_locator locator, loader_configuration configuration)
-        : _locator(std::move(locator)), _configuration(std::move(configuration))
+        : _locator(std::move(locator)), _configuration(std::move(configuration)), _interface_count(0)
     {
     }
 
@@ -228,23 +228,33 @@ namespace cxxreflect { namespace reflection { namespace detail {
             return cached_result;
 
         // Ok, we don't have a cached result; let's resolve the reference:
-        metadata::member_ref_row const ref_row(row_from(ref));
+        metadata::member_ref_row          const ref_row(row_from(ref));
+        metadata::member_ref_parent_token const parent(ref_row.parent());
+
+        // A MethodDef parent is only used to supply the call site signature of a vararg method
+        // defined in this module; the reference refers to that method:
+        if (parent.is<metadata::method_def_token>())
+        {
+            metadata::method_def_token const method(parent.as<metadata::method_def_token>());
+
+            resolution_cache.set(ref, method);
+            return method;
+        }
 
         metadata::type_def_token const parent_type([&]() -> metadata::type_def_token
         {
-            metadata::member_ref_parent_token const parent(ref_row.parent());
             switch (parent.table())
             {
             case metadata::table_id::type_ref:
                 return resolve_type_ref(parent.as<metadata::type_ref_token>());
 
             case metadata::table_id::module_ref:
-                // This class table is used only for global members
-                core::assert_not_yet_implemented();
-
-            case metadata::table_id::method_def:
-                // This class table is only used for call site varargs usage
-                core::assert_not_yet_implemented();
+            {
+                // This class table is used only for global members, which are members of the
+                // <Module> type, which is always the first TypeDef in its module:
+                metadata::database const& target_scope(resolve_module_ref(parent.as<metadata::module_ref_token>()));
+                return metadata::type_def_token(&target_scope, metadata::table_id::type_def, 0);
+            }
 
             case metadata::table_id::type_spec:
                 return resolve_primary_type(compute_type(parent.as<metadata::type_spec_token>()));
@@ -261,51 +271,51 @@ namespace cxxreflect { namespace reflection { namespace detail {
         bool const is_field_signature(metadata::signature_flags(*member_blob.begin())
             .with_mask(metadata::signature_attribute::calling_convention_mask) == metadata::signature_attribute::field);
 
-        metadata::signature_comparer  const signatures_are_equal(this);
-
-        metadata::type_ref_spec_token const unresolved_parent(ref_row.parent().as<metadata::type_ref_spec_token>());
-        metadata::type_def_token      const resolved_parent  (resolve_primary_type(compute_type(unresolved_parent)));
+        metadata::signature_comparer const signatures_are_equal(this);
 
-        auto const membership(_membership.get_membership(resolved_parent));
+        // The name index of the member tables of the parent type reduces the search to the members
+        // with the referenced name, so we only need to compare the signatures of the overloads.
+        // The tables include inherited members, but a reference names a member of its parent:
+        membership_handle const parent_membership(get_membership(parent_type));
         if (is_field_signature)
         {
-            auto const fields(find_fields(resolved_parent));
-            auto const field(core::find_if(fields, [&](metadata::field_row const& f) -> bool
-            {
-                if (f.name() != ref_row.name())
-                    return false;
-
-                metadata::field_signature const row_signature(f.signature().as<metadata::field_signature>());
-                metadata::field_signature const ref_signature(ref_row.signature().as<metadata::field_signature>());
+            metadata::field_signature const ref_signature(ref_row.signature().as<metadata::field_signature>());
 
-                return signatures_are_equal(row_signature, ref_signature);
+            auto const fields(parent_membership.find_fields(ref_row.name()));
+            auto const field(core::find_if(fields, [&](field_table_entry const* const entry) -> bool
+            {
+                metadata::field_token const f(entry->member_token());
+                return metadata::find_owner_of_field(f).token() == parent_type
+                    && signatures_are_equal(row_from(f).signature().as<metadata::field_signature>(), ref_signature);
             }));
 
             if (field == end(fields))
                 throw core::metadata_error(L"referenced field does not exist");
 
-            resolution_cache.set(ref, field->token());
-            return field->token();
+            metadata::field_token const result((*field)->member_token());
+
+            resolution_cache.set(ref, result);
+            return result;
         }
         else // it's a method signature
         {
-            auto const methods(find_method_defs(resolved_parent));
-            auto const method(core::find_if(methods, [&](metadata::method_def_row const& m) -> bool
-            {
-                if (m.name() != ref_row.name())
-                    return false;
+            metadata::method_signature const ref_signature(ref_row.signature().as<metadata::method_signature>());
 
-                metadata::method_signature const row_signature(m.signature().as<metadata::method_signature>());
-                metadata::method_signature const ref_signature(ref_row.signature().as<metadata::method_signature>());
-
-                return signatures_are_equal(row_signature, ref_signature);
+            auto const methods(parent_membership.find_methods(ref_row.name()));
+            auto const method(core::find_if(methods, [&](method_table_entry const* const entry) -> bool
+            {
+                metadata::method_def_token const m(entry->member_token());
+                return metadata::find_owner_of_method_def(m).token() == parent_type
+                    && signatures_are_equal(row_from(m).signature().as<metadata::method_signature>(), ref_signature);
             }));
 
             if (method == end(methods))
                 throw core::metadata_error(L"referenced method does not exist");
 
-            resolution_cache.set(ref, method->token());
-            return method->token();
+            metadata::method_def_token const result((*method)->member_token());
+
+            resolution_cache.set(ref, result);
+            return result;
         }
     }
 
@@ -332,9 +342,26 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
         metadata::resolution_scope_token const resolution_scope(ref_row.resolution_scope());
 
-        // If the resolution scope is null, we need to look in the exported_type table for this type
+        // If the resolution scope is null, the type is exported by the assembly that contains this
+        // module, so we need to look in its exported_type table for this type:
         if (!resolution_scope.is_initialized())
-            core::assert_not_yet_implemented();
+        {
+            metadata::type_def_token const result(resolve_exported_type(module.assembly(), usable_namespace, ref_row.name()));
+
+            resolution_cache.set(ref, result);
+            return result;
+        }
+
+        // If the resolution scope is a type ref, this is a nested type.  We resolve the enclosing
+        // type first; the nested type is defined in the same scope as its enclosing type:
+        if (resolution_scope.is<metadata::type_ref_token>())
+        {
+            metadata::type_def_token const enclosing_type(resolve_type_ref(resolution_scope.as<metadata::type_ref_token>()));
+            metadata::type_def_token const result(resolve_nested_type(enclosing_type, ref_row.name()));
+
+            resolution_cache.set(ref, result);
+            return result;
+        }
 
         // Otherwise, we need to resolve the target scope; the logic is different for each kind of
         // resolution scope, so this is a bit of work...
@@ -366,13 +393,6 @@ namespace cxxreflect { namespace reflection { namespace detail {
                     : resolve_assembly_ref(assembly_ref_scope);
             }
 
-            // If we have a type ref, this is a nested type.  We need to resolve the target type ref
-            // to find the enclosing type.  The nested type will be defined in the same scope.
-            case metadata::table_id::type_ref:
-            {
-                core::assert_not_yet_implemented();
-            }
-
             // There are no other valid resolution scope tables:
             default:
             {
@@ -383,16 +403,110 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
         module_context const& target_module(module_context::from(target_scope));
 
-        // Find the target type in the module:
-        metadata::type_def_token const result(target_module.type_def_index().find(usable_namespace, ref_row.name()));
+        // Find the target type in the module.  If it is not defined there, it may have been
+        // forwarded to another assembly (e.g. by a facade assembly):
+        metadata::type_def_token result(target_module.type_def_index().find(usable_namespace, ref_row.name()));
         if (!result.is_initialized())
-            throw core::runtime_error(L"failed to locate referenced type in scope");
+            result = resolve_exported_type(target_module.assembly(), usable_namespace, ref_row.name());
 
         // Finally, cache the result and return it:
         resolution_cache.set(ref, result);
         return result;
     }
 
+    auto loader_context::resolve_exported_type(assembly_context       const& assembly,
+                                               core::string_reference const& namespace_name,
+                                               core::string_reference const& name) const -> metadata::type_def_token
+    {
+        // Each step of a forwarding chain moves to another assembly.  Chains are short, so we
+        // detect cycles by remembering each assembly we have visited:
+        std::vector<assembly_context const*> visited;
+
+        assembly_context const* current(&assembly);
+        for (;;)
+        {
+            if (std::find(visited.begin(), visited.end(), current) != visited.end())
+                throw core::runtime_error(L"failed to resolve exported type:  type forwarders form a cycle");
+
+            visited.push_back(current);
+
+            metadata::exported_type_token const exported_type(current->find_exported_type(namespace_name, name));
+            if (!exported_type.is_initialized())
+                throw core::runtime_error(L"failed to locate referenced type in scope");
+
+            metadata::implementation_token const implementation(row_from(exported_type).implementation());
+            if (!implementation.is_initialized())
+                throw core::metadata_error(L"invalid metadata:  exported type has no implementation");
+
+            switch (implementation.table())
+            {
+            // If we have a file, the type is defined in another module of the same assembly.  Type
+            // names are unique within an assembly, so we can search each of its modules:
+            case metadata::table_id::file:
+            {
+                metadata::type_def_token result;
+                core::find_if(current->modules(), [&](unique_module_context const& module)
+                {
+                    result = module->type_def_index().find(namespace_name, name);
+                    return result.is_initialized();
+                });
+
+                if (!result.is_initialized())
+                    throw core::runtime_error(L"failed to locate exported type in its module");
+
+                return result;
+            }
+
+            // If we have an assembly ref, the type has been forwarded to another assembly.  It is
+            // either defined there or forwarded again:
+            case metadata::table_id::assembly_ref:
+            {
+                metadata::assembly_ref_token const assembly_ref(implementation.as<metadata::assembly_ref_token>());
+                metadata::database const& target_scope(is_windows_runtime_assembly_ref(assembly_ref)
+                    ? resolve_namespace(namespace_name)
+                    : resolve_assembly_ref(assembly_ref));
+
+                module_context const& target_module(module_context::from(target_scope));
+
+                metadata::type_def_token const result(target_module.type_def_index().find(namespace_name, name));
+                if (result.is_initialized())
+                    return result;
+
+                current = &target_module.assembly();
+                break;
+            }
+
+            // Nested exported types are not in the index, so there are no other valid tables:
+            default:
+            {
+                core::assert_unreachable();
+            }
+            }
+        }
+    }
+
+    auto loader_context::resolve_nested_type(metadata::type_def_token const& enclosing_type,
+                                             core::string_reference   const& name) const -> metadata::type_def_token
+    {
+        core::assert_initialized(enclosing_type);
+
+        // The NestedClass table is sorted by nested type, not by enclosing type, so we have to
+        // search all of it.  The result is cached by the caller, so each reference is searched once:
+        metadata::database const& scope(enclosing_type.scope());
+        auto const it(std::find_if(
+            scope.begin<metadata::table_id::nested_class>(),
+            scope.end<metadata::table_id::nested_class>(),
+            [&](metadata::nested_class_row const& row)
+        {
+            return row.enclosing_class() == enclosing_type && row_from(row.nested_class()).name() == name;
+        }));
+
+        if (it == scope.end<metadata::table_id::nested_class>())
+            throw core::runtime_error(L"failed to locate referenced nested type in its enclosing type");
+
+        return it->nested_class();
+    }
+
     auto loader_context::resolve_namespace(core::string_reference const namespace_name) const
         -> metadata::database const&
     {
@@ -475,6 +589,33 @@ namespace cxxreflect { namespace reflection { namespace detail {
         return _membership.get_membership(type);
     }
 
+    auto loader_context::get_membership_statistics() const -> membership_statistics
+    {
+        return _membership.statistics();
+    }
+
+    auto loader_context::allocate_interface_id() const -> core::size_type
+    {
+        core::recursive_mutex_lock const lock(_sync.lock());
+        return _interface_count++;
+    }
+
+    auto loader_context::get_canonical_type_id(metadata::type_def_or_signature const& type) const -> canonical_type_id
+    {
+        return _canonical_types.get_id(type);
+    }
+
+    auto loader_context::reserve_canonical_type_ids(core::size_type const count) const -> core::size_type
+    {
+        return _canonical_types.reserve_definition_ids(count);
+    }
+
+    auto loader_context::get_type_name(metadata::type_def_or_signature const& type, type_name_kind const kind) const
+        -> core::string_reference
+    {
+        return _type_names.get_name(type, kind);
+    }
+
     auto loader_context::from(metadata::database const& scope) -> loader_context const&
     {
         return module_context::from(scope).assembly().loader();
@@ -6,8 +6,10 @@
 #ifndef CXXREFLECT_REFLECTION_DETAIL_LOADER_CONTEXT_HPP_
 #define CXXREFLECT_REFLECTION_DETAIL_LOADER_CONTEXT_HPP_
 
+#include "cxxreflect/reflection/detail/canonical_type.hpp"
 #include "cxxreflect/reflection/detail/forward_declarations.hpp"
 #include "cxxreflect/reflection/detail/membership.hpp"
+#include "cxxreflect/reflection/detail/type_name_builder.hpp"
 #include "cxxreflect/reflection/loader_configuration.hpp"
 #include "cxxreflect/reflection/module_locator.hpp"
 
@@ -46,6 +48,18 @@ namespace cxxreflect { namespace reflection { namespace detail {
         auto resolve_type_ref    (metadata::type_ref_token    ) const -> metadata::type_def_token;
         auto resolve_namespace   (core::string_reference      ) const -> metadata::database const&;
 
+        /// Resolves a type that is exported by `assembly` rather than defined in it, following
+        /// type forwarders across assemblies until the type definition is found.  Throws a
+        /// `runtime_error` if the type is not exported or if the forwarders form a cycle.
+        auto resolve_exported_type(assembly_context       const& assembly,
+                                   core::string_reference const& namespace_name,
+                                   core::string_reference const& name) const -> metadata::type_def_token;
+
+        /// Resolves a type named `name` that is nested in `enclosing_type`.  Throws a
+        /// `runtime_error` if there is no such nested type.
+        auto resolve_nested_type(metadata::type_def_token const& enclosing_type,
+                                 core::string_reference   const& name) const -> metadata::type_def_token;
+
         auto locator() const -> module_locator const&;
 
         auto system_module()    const -> module_context const&;
@@ -55,6 +69,24 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
         auto get_membership(metadata::type_def_or_signature const& type) const -> membership_handle;
 
+        /// Gets the number of member tables built by this loader and the memory that they use
+        auto get_membership_statistics() const -> membership_statistics;
+
+        /// Allocates a new dense interface id; ids start at zero.  See `module_context::interface_id()`.
+        auto allocate_interface_id() const -> core::size_type;
+
+        /// Gets the canonical id of `type`; two resolved types are the same type if and only if their
+        /// ids are equal.  See `canonical_type_storage`.
+        auto get_canonical_type_id(metadata::type_def_or_signature const& type) const -> canonical_type_id;
+
+        /// Reserves `count` consecutive canonical ids for the type definitions of a module and
+        /// returns the value of the first.  See `module_context::canonical_id()`.
+        auto reserve_canonical_type_ids(core::size_type count) const -> core::size_type;
+
+        /// Gets the name of `type` in the form `kind`; names are built once and cached.  See
+        /// `type_name_cache`.
+        auto get_type_name(metadata::type_def_or_signature const& type, type_name_kind kind) const -> core::string_reference;
+
         static auto from(metadata::database const& scope) -> loader_context const&;
 
     private:
@@ -79,8 +111,11 @@ namespace cxxreflect { namespace reflection { namespace detail {
         assembly_map                                mutable _assemblies;
         namespace_map                               mutable _namespaces;
         membership_storage                          mutable _membership;
+        canonical_type_storage                      mutable _canonical_types;
+        type_name_cache                             mutable _type_names;
         fundamental_type_cache                      mutable _fundamental_types;
         core::checked_pointer<module_context const> mutable _system_module;
+        core::size_type                             mutable _interface_count;
         core::recursive_mutex                       mutable _sync;
     };
 
@@ -0,0 +1,86 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#ifndef CXXREFLECT_REFLECTION_DETAIL_MEMBER_TABLE_CURSOR_HPP_
+#define CXXREFLECT_REFLECTION_DETAIL_MEMBER_TABLE_CURSOR_HPP_
+
+#include "cxxreflect/reflection/detail/forward_declarations.hpp"
+
+
+
+
+
+namespace cxxreflect { namespace reflection { namespace detail {
+
+    /// A random access iterator over the entries of a `member_table_layer`
+    ///
+    /// The cursor identifies an entry by its index in the table, not by its address, because the
+    /// entries of a layered table are not contiguous.  Dereferencing the cursor yields a pointer to
+    /// the entry.
+    class member_table_cursor
+    {
+    public:
+
+        typedef std::random_access_iterator_tag     iterator_category;
+        typedef core::difference_type               difference_type;
+        typedef member_table_packed_entry const*    value_type;
+        typedef value_type                          reference;
+        typedef core::indirectable<value_type>      pointer;
+
+        member_table_cursor();
+        member_table_cursor(member_table_layer const* table, core::size_type index);
+
+        auto get()        const -> reference;
+        auto operator*()  const -> reference;
+        auto operator->() const -> pointer;
+
+        auto operator++() -> member_table_cursor& { ++_index.get(); return *this; }
+        auto operator--() -> member_table_cursor& { --_index.get(); return *this; }
+
+        auto operator++(int) -> member_table_cursor { member_table_cursor const it(*this); ++*this; return it; }
+        auto operator--(int) -> member_table_cursor { member_table_cursor const it(*this); --*this; return it; }
+
+        auto operator+=(difference_type const n) -> member_table_cursor&
+        {
+            _index.get() = static_cast<core::size_type>(static_cast<difference_type>(_index.get()) + n);
+            return *this;
+        }
+
+        auto operator-=(difference_type const n) -> member_table_cursor& { return *this += -n; }
+
+        auto operator[](difference_type const n) const -> reference { return *(member_table_cursor(*this) += n); }
+
+        auto is_initialized() const -> bool;
+
+        friend auto operator+(member_table_cursor it, difference_type const n) -> member_table_cursor { return it +=  n; }
+        friend auto operator+(difference_type const n, member_table_cursor it) -> member_table_cursor { return it +=  n; }
+        friend auto operator-(member_table_cursor it, difference_type const n) -> member_table_cursor { return it += -n; }
+
+        friend auto operator-(member_table_cursor const& lhs, member_table_cursor const& rhs) -> difference_type
+        {
+            return static_cast<difference_type>(lhs._index.get()) - static_cast<difference_type>(rhs._index.get());
+        }
+
+        friend auto operator==(member_table_cursor const& lhs, member_table_cursor const& rhs) -> bool
+        {
+            return lhs._index.get() == rhs._index.get();
+        }
+
+        friend auto operator<(member_table_cursor const& lhs, member_table_cursor const& rhs) -> bool
+        {
+            return lhs._index.get() < rhs._index.get();
+        }
+
+        CXXREFLECT_GENERATE_COMPARISON_OPERATORS(member_table_cursor)
+
+    private:
+
+        core::checked_pointer<member_table_layer const> _table;
+        core::value_initialized<core::size_type>       _index;
+    };
+
+} } }
+
+#endif
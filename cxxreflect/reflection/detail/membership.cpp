@@ -6,6 +6,7 @@
 #include "cxxreflect/reflection/precompiled_headers.hpp"
 #include "cxxreflect/reflection/detail/loader_context.hpp"
 #include "cxxreflect/reflection/detail/membership.hpp"
+#include "cxxreflect/reflection/detail/module_context.hpp"
 #include "cxxreflect/reflection/detail/type_resolution.hpp"
 
 
@@ -277,29 +278,26 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
         {
         }
 
-        explicit built_table(core::const_byte_range const range_, bool const is_instantiated_)
-            : _range(range_), _is_instantiated(is_instantiated_)
+        explicit built_table(member_table_layer const* const layer_)
+            : _layer(layer_)
         {
         }
 
-        auto byte_range()      const -> core::const_byte_range const& { return _range;           }
-        auto is_instantiated() const -> bool                          { return _is_instantiated; }
+        auto layer() const -> member_table_layer const* { return _layer.get(); }
 
         auto iterator_range() const -> range_type
         {
-            core::size_type const stride(_is_instantiated.get()
-                ? sizeof(member_table_entry_with_instantiation)
-                : sizeof(member_table_entry));
+            if (_layer.get() == nullptr)
+                return range_type();
 
             return range_type(
-                iterator_type(MemberTag, core::stride_iterator(_range.begin(), stride)),
-                iterator_type(MemberTag, core::stride_iterator(_range.end(),   stride)));
+                iterator_type(MemberTag, _layer.get()->begin()),
+                iterator_type(MemberTag, _layer.get()->end()));
         }
 
     private:
 
-        core::const_byte_range        _range;
-        core::value_initialized<bool> _is_instantiated;
+        core::value_initialized<member_table_layer const*> _layer;
     };
 
 
@@ -339,12 +337,18 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
 
             // Test to see whether we've already created the table; if we have we can return now:
             auto& membership(_storage->get_membership(type).context(core::internal_key()));
-            if (membership.get_state().is_set(membership_context::primary_state_flag_for(MemberTag)))
-            {
-                return internal_table(
-                    membership.get_range<MemberTag>().value(),
-                    membership.get_state().is_set(membership_context::instantiated_state_flag_for(MemberTag)));
-            }
+            auto const existing_table(get_existing_table(membership));
+            if (existing_table.has_value())
+                return existing_table.value();
+
+            // Otherwise, we must build the table.  Only one thread may build the tables for a type
+            // at a time, so we acquire the type's construction latch, then check again in case
+            // another thread built the table while we were waiting for the latch:
+            core::recursive_mutex_lock const latch(_storage->lock_construction(membership, core::internal_key()));
+
+            auto const latched_existing_table(get_existing_table(membership));
+            if (latched_existing_table.has_value())
+                return latched_existing_table.value();
 
             // Resolve the type to its definition and signature.  If resolution was successful and
             // we found a type definition, compute a new table for the type and return it:
@@ -357,7 +361,7 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
             // If we don't have a signature or a definition, we can simply return an empty table:
             if (!def_and_sig.has_signature())
             {
-                membership.set_table<MemberTag>(core::const_byte_range(), false);
+                membership.set_table<MemberTag>(nullptr);
                 return internal_table();
             }
 
@@ -382,12 +386,22 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
             }
 
             // Otherwise, this is a signature for which we do not need to create a table:
-            membership.set_table<MemberTag>(core::const_byte_range(), false);
+            membership.set_table<MemberTag>(nullptr);
             return internal_table();
         }
 
     private:
 
+        /// Gets the table of `membership`, if it has already been created
+        static auto get_existing_table(membership_context const& membership) -> core::optional<internal_table>
+        {
+            membership_context::state_flags const flags(membership.get_state());
+            if (!flags.is_set(membership_context::primary_state_flag_for(MemberTag)))
+                return core::optional<internal_table>();
+
+            return internal_table(membership.get_layer<MemberTag>().value());
+        }
+
         /// Entry point for the recursive table creation process
         ///
         /// This is called by `get_or_create_table` when a new table needs to be created.  This
@@ -402,6 +416,7 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
             // construct, so we'll construct them once here:
             auto const instantiator_arguments(create_instantiator_arguments(type));
 
+            internal_table        base_table;
             interim_sequence_type new_table;
 
             // To start off, we get the instantiated contexts from the base class.  This process
@@ -415,8 +430,9 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
             metadata::type_def_ref_spec_token const base_token(row_from(type.type_def()).extends());
             if (base_token.is_initialized())
             {
-                new_table = get_or_create_table_with_base_elements(
-                    get_type_def_or_signature(_resolver->resolve_type(base_token)),
+                base_table = create_table(get_type_def_or_signature(_resolver->resolve_type(base_token)));
+                new_table = get_table_with_base_elements(
+                    base_table,
                     type.type_def(),
                     type.signature(),
                     instantiator_arguments);
@@ -450,68 +466,213 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
                 post_insertion_recurse_with_context(new_context, new_table, inherited_element_count, traits_type());
             });
 
-            return create_internal_table(type.best_match(), new_table);
+            return create_internal_table(type.best_match(), base_table, new_table);
         }
 
-        auto create_internal_table(metadata::type_def_or_signature const& type, interim_sequence_type const& new_table) const
+        /// Creates the table for `type` from the computed `new_table`
+        ///
+        /// If the computed table starts with the entries of `base_table`, the new table is created
+        /// as a layer over the base table that stores only the entries that differ from the base
+        /// table and the entries appended to it.  Otherwise, a flat table is created.
+        auto create_internal_table(metadata::type_def_or_signature const& type,
+                                   internal_table                  const& base_table,
+                                   interim_sequence_type           const& new_table) const
             -> internal_table
         {
             if (new_table.empty())
                 return internal_table();
 
-            bool const use_instantiated_contexts(std::any_of(begin(new_table), end(new_table), [&](interim_type const& x)
+            // The type for which we are creating the table may differ from the type whose latch
+            // our caller holds (e.g., if the caller requested the table for a type definition and
+            // we are creating the table for its signature), so we acquire the latch here as well:
+            auto& membership(_storage->get_membership(type).context(core::internal_key()));
+            core::recursive_mutex_lock const latch(_storage->lock_construction(membership, core::internal_key()));
+
+            auto const existing_table(get_existing_table(membership));
+            if (existing_table.has_value())
+                return existing_table.value();
+
+            // Find the inherited entries that differ from the corresponding base table entries.
+            // We can only share the base table if every one of its entries is present in the new
+            // table (property filtering may remove base entries).  If most of the inherited entries
+            // differ (e.g., when all of the members of a generic base type are instantiated), a
+            // layer saves little space and makes every lookup slower, so we build a flat table.
+            member_table_layer const* const base_layer(base_table.layer());
+            core::size_type const base_size(base_layer != nullptr ? base_layer->size() : 0);
+            core::size_type const new_size(core::convert_integer(new_table.size()));
+
+            std::vector<core::size_type> replaced_indices;
+            bool share_base(base_layer != nullptr && base_size <= new_size);
+            if (share_base)
             {
-                return x.instantiated_signature().is_initialized();
-            }));
+                for (core::size_type i(0); i != base_size; ++i)
+                {
+                    entry_type const* const base_entry(member_table_iterator_constructor<MemberTag>()(
+                        MemberTag, member_table_cursor(base_layer, i)));
 
-            auto& membership(_storage->get_membership(type).context(core::internal_key()));
-            if (use_instantiated_contexts)
+                    if (!is_same_entry(new_table[i], *base_entry))
+                        replaced_indices.push_back(i);
+                }
+
+                share_base = replaced_indices.size() * 2 <= base_size;
+            }
+
+            // If the new table is identical to the base table, we simply share the base table:
+            if (share_base && replaced_indices.empty() && base_size == new_size)
             {
-                std::vector<member_table_entry_with_instantiation> entries(new_table.size());
-                std::transform(begin(new_table), end(new_table), begin(entries), [&](interim_type const& x) { return x; });
+                membership.set_table<MemberTag>(base_layer);
+                return internal_table(base_layer);
+            }
 
-                membership.set_table<MemberTag>(_storage->allocate_table(core::const_byte_range(
-                    reinterpret_cast<core::const_byte_iterator>(entries.data()),
-                    reinterpret_cast<core::const_byte_iterator>(entries.data() + entries.size())), core::internal_key()), true);
+            // The entries owned by the new layer:  the replacements come first, in index order,
+            // followed by the appended entries:
+            std::vector<interim_type const*> owned_entries;
+            if (share_base)
+            {
+                std::transform(begin(replaced_indices), end(replaced_indices), std::back_inserter(owned_entries),
+                    [&](core::size_type const i) { return &new_table[i]; });
 
-                return internal_table(membership.get_range<MemberTag>().value(), true);
+                for (core::size_type i(base_size); i != new_size; ++i)
+                    owned_entries.push_back(&new_table[i]);
             }
             else
             {
-                // TODO Rework allocation scheme here
-                std::vector<member_table_entry> entries(new_table.size());
-                std::transform(begin(new_table), end(new_table), begin(entries), [&](interim_type const& x)
+                replaced_indices.clear();
+                std::transform(begin(new_table), end(new_table), std::back_inserter(owned_entries),
+                    [&](interim_type const& x) { return &x; });
+            }
+
+            // Each entry whose scope differs from the layer's scope requires instantiation data, so
+            // we use the scope shared by the most entries as the layer's scope:
+            std::map<metadata::database const*, core::size_type> scope_counts;
+            core::for_all(owned_entries, [&](interim_type const* const x)
+            {
+                ++scope_counts[&x->member_token().scope()];
+            });
+
+            metadata::database const* const layer_scope(std::max_element(begin(scope_counts), end(scope_counts),
+                [](std::pair<metadata::database const* const, core::size_type> const& lhs,
+                   std::pair<metadata::database const* const, core::size_type> const& rhs)
+            {
+                return lhs.second < rhs.second;
+            })->first);
+
+            // Pack the entries.  Entries that differ from the layer only in scope share their
+            // instantiation data; all other instantiation data is unique to its entry.
+            std::vector<member_table_packed_entry>                packed_entries;
+            std::vector<member_table_instantiation>               instantiations;
+            std::map<metadata::database const*, core::size_type> scope_instantiations;
+
+            core::for_all(owned_entries, [&](interim_type const* const x)
+            {
+                metadata::database              const* const scope(&x->member_token().scope());
+                metadata::type_def_or_signature const        instantiating_type(get_recorded_instantiating_type(*x));
+                metadata::blob                  const        instantiated_signature(x->instantiated_signature());
+
+                core::size_type instantiation(0);
+                if (instantiating_type.is_initialized() || instantiated_signature.is_initialized())
                 {
-                    return member_table_entry(x.member_token());
-                });
+                    instantiations.push_back(member_table_instantiation(scope, instantiating_type, instantiated_signature));
+                    instantiation = core::convert_integer(instantiations.size());
+                }
+                else if (scope != layer_scope)
+                {
+                    core::size_type& scope_instantiation(scope_instantiations[scope]);
+                    if (scope_instantiation == 0)
+                    {
+                        instantiations.push_back(member_table_instantiation(scope, instantiating_type, instantiated_signature));
+                        scope_instantiation = core::convert_integer(instantiations.size());
+                    }
+
+                    instantiation = scope_instantiation;
+                }
 
-                membership.set_table<MemberTag>(_storage->allocate_table(core::const_byte_range(
-                    reinterpret_cast<core::const_byte_iterator>(entries.data()),
-                    reinterpret_cast<core::const_byte_iterator>(entries.data() + entries.size())), core::internal_key()), false);
+                packed_entries.push_back(member_table_packed_entry(
+                    x->member_token().value(),
+                    core::convert_integer(packed_entries.size()),
+                    instantiation));
+            });
 
-                return internal_table(membership.get_range<MemberTag>().value(), false);
-            }
+            core::const_byte_range const indices(_storage->allocate_table(core::const_byte_range(
+                reinterpret_cast<core::const_byte_iterator>(replaced_indices.data()),
+                reinterpret_cast<core::const_byte_iterator>(replaced_indices.data() + replaced_indices.size())), core::internal_key()));
+
+            core::const_byte_range const instantiation_bytes(_storage->allocate_table(core::const_byte_range(
+                reinterpret_cast<core::const_byte_iterator>(instantiations.data()),
+                reinterpret_cast<core::const_byte_iterator>(instantiations.data() + instantiations.size())), core::internal_key()));
+
+            member_table_layer const* const layer(_storage->allocate_layer(
+                member_table_layer(
+                    share_base ? base_layer : nullptr,
+                    layer_scope,
+                    reinterpret_cast<core::size_type const*>(indices.begin()),
+                    core::convert_integer(replaced_indices.size()),
+                    core::convert_integer(owned_entries.size() - replaced_indices.size()),
+                    reinterpret_cast<member_table_instantiation const*>(instantiation_bytes.begin())),
+                core::const_byte_range(
+                    reinterpret_cast<core::const_byte_iterator>(packed_entries.data()),
+                    reinterpret_cast<core::const_byte_iterator>(packed_entries.data() + packed_entries.size())),
+                core::internal_key()));
+
+            membership.set_table<MemberTag>(layer);
+            return internal_table(layer);
+        }
+
+        /// Gets the instantiating type of `x` that is recorded when `x` is packed
+        ///
+        /// If the instantiating type is a type definition, it is the type that owns the member, so
+        /// we do not need to record it (see `member_table_instantiation`).
+        static auto get_recorded_instantiating_type(interim_type const& x) -> metadata::type_def_or_signature
+        {
+            if (!x.instantiating_type().is_initialized() || !x.instantiating_type().is_blob())
+                return metadata::type_def_or_signature();
+
+            return x.instantiating_type();
+        }
+
+        /// Tests whether the computed entry `x` is equivalent to the existing table entry `y`
+        ///
+        /// The entries are equivalent if they refer to the same member with the same instantiated
+        /// signature and the same recorded instantiating type.  Instantiated signatures are compared by
+        /// address:  an entry copied unchanged from the base table keeps the base entry's signature,
+        /// whereas a signature instantiated for the derived type is a new allocation and is thus
+        /// conservatively treated as different.
+        static auto is_same_entry(interim_type const& x, entry_type const& y) -> bool
+        {
+            if (x.member_token().template as<token_type>() != y.member_token())
+                return false;
+
+            bool const x_has_signature(x.instantiated_signature().is_initialized());
+            if (x_has_signature != y.has_instantiated_signature())
+                return false;
+
+            if (x_has_signature && x.instantiated_signature().begin() != y.instantiated_signature().begin())
+                return false;
+
+            metadata::type_def_or_signature const x_type(get_recorded_instantiating_type(x));
+            if (x_type.is_initialized() != y.has_instantiating_type())
+                return false;
+
+            return !x_type.is_initialized() || x_type == y.instantiating_type();
         }
 
-        /// Gets or creates the element table for base type and clones and instantiates the elements
+        /// Clones the elements of a base type's table and instantiates them for the derived type
         ///
-        /// The `base_type` is the base type for which to obtain an element table.  The table is
-        /// computed, then the elements are instantiated with the provided `instantiator_arguments`,
-        /// if there are any.  The resulting table is then returned.
+        /// The `base_type_table` is the already-created table of the base type.  Its elements are
+        /// instantiated with the provided `instantiator_arguments`, if there are any.  The resulting
+        /// table is then returned.
         ///
         /// The returned table is always a new sequence that is cloned from the base type's table.
         /// Note that this function is called both for ordinary types and for generic parameters.
         ///
         /// The derived type signature may be uninitialized.
-        auto get_or_create_table_with_base_elements(metadata::type_def_or_signature const& base_type,
-                                                    metadata::type_def_or_signature const& derived_type,
-                                                    metadata::blob                  const& derived_type_signature,
-                                                    instantiator_arguments_type     const& instantiator_arguments) const
+        auto get_table_with_base_elements(internal_table                  const& base_type_table,
+                                          metadata::type_def_or_signature const& derived_type,
+                                          metadata::blob                  const& derived_type_signature,
+                                          instantiator_arguments_type     const& instantiator_arguments) const
             -> interim_sequence_type
         {
-            core::assert_initialized(base_type);
-
-            auto const base_table(create_table(base_type).iterator_range());
+            auto const base_table(base_type_table.iterator_range());
             if (base_table.empty())
                 return interim_sequence_type();
 
@@ -714,11 +875,12 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
             // correctly generate interface sets.  The process_generic_parameter_constraints does
             // not itself recurse, but it sets up the context that is required to share the same
             // post-insertion logic used by the other create table path.
-            interim_sequence_type new_table(get_or_create_table_with_base_elements(base_type, type, metadata::blob(), empty_arguments));
+            internal_table const base_table(create_table(base_type));
+            interim_sequence_type new_table(get_table_with_base_elements(base_table, type, metadata::blob(), empty_arguments));
 
             process_generic_parameter_constraints(new_table, constraints, traits_type());
 
-            return create_internal_table(type, new_table);
+            return create_internal_table(type, base_table, new_table);
         }
 
         /// Processes the generic parameters for potential insertion into a context table
@@ -861,6 +1023,85 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
         recursive_table_builder<MemberTag>(&loader_context::from(type.scope()), &storage).create_table(type);
     }
 
+
+
+
+
+    /// Gets the name of the member at `index` in the `MemberTag` table whose top layer is `layer`
+    template <member_kind MemberTag>
+    auto get_member_name(member_table_layer const& layer, core::size_type const index) -> core::string_reference
+    {
+        return row_from(member_table_entry_facade<MemberTag>::from(layer.entry(index))->member_token()).name();
+    }
+
+    /// Orders the entries of a `member_name_index` by hash, then by name, then by table index
+    ///
+    /// A search key is a hash and a name; an entry is equivalent to a key if it has the same hash
+    /// and name.  Names are only compared when hashes are equal.
+    template <member_kind MemberTag>
+    class member_name_comparer
+    {
+    public:
+
+        typedef std::pair<std::uint32_t, core::string_reference> key_type;
+
+        explicit member_name_comparer(member_table_layer const* const layer)
+            : _layer(layer)
+        {
+            core::assert_not_null(layer);
+        }
+
+        auto operator()(member_name_index_entry const& lhs, member_name_index_entry const& rhs) const -> bool
+        {
+            if (lhs.hash() != rhs.hash())
+                return lhs.hash() < rhs.hash();
+
+            core::string_reference const lhs_name(name_of(lhs));
+            core::string_reference const rhs_name(name_of(rhs));
+            if (lhs_name != rhs_name)
+                return lhs_name < rhs_name;
+
+            return lhs.index() < rhs.index();
+        }
+
+        auto operator()(member_name_index_entry const& lhs, key_type const& rhs) const -> bool
+        {
+            if (lhs.hash() != rhs.first)
+                return lhs.hash() < rhs.first;
+
+            return name_of(lhs) < rhs.second;
+        }
+
+        auto operator()(key_type const& lhs, member_name_index_entry const& rhs) const -> bool
+        {
+            if (lhs.first != rhs.hash())
+                return lhs.first < rhs.hash();
+
+            return lhs.second < name_of(rhs);
+        }
+
+    private:
+
+        auto name_of(member_name_index_entry const& entry) const -> core::string_reference
+        {
+            return get_member_name<MemberTag>(*_layer.get(), entry.index());
+        }
+
+        core::checked_pointer<member_table_layer const> _layer;
+    };
+
+    /// Narrows a field of a `member_table_packed_entry` to its 16-bit storage
+    ///
+    /// A layer with more than 65,535 entries or instantiations cannot be packed; rather than
+    /// silently truncating the value (which would corrupt the entry-to-layer mapping), we fail.
+    auto narrow_packed_field(core::size_type const value) -> std::uint16_t
+    {
+        if (value > std::numeric_limits<std::uint16_t>::max())
+            throw core::runtime_error(L"member table layer is too large to be packed");
+
+        return static_cast<std::uint16_t>(value);
+    }
+
 } } } }
 
 
@@ -1449,6 +1690,88 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
 
 
+    member_table_instantiation::member_table_instantiation()
+    {
+    }
+
+    member_table_instantiation::member_table_instantiation(metadata::database              const* const scope,
+                                                           metadata::type_def_or_signature const&       instantiating_type,
+                                                           metadata::blob                  const&       instantiated_signature)
+        : _scope(scope),
+          _instantiating_type(instantiating_type),
+          _instantiated_signature(instantiated_signature)
+    {
+        core::assert_not_null(scope);
+    }
+
+    auto member_table_instantiation::scope() const -> metadata::database const&
+    {
+        return *_scope;
+    }
+
+    auto member_table_instantiation::instantiating_type() const -> metadata::type_def_or_signature const&
+    {
+        return _instantiating_type;
+    }
+
+    auto member_table_instantiation::instantiated_signature() const -> metadata::blob const&
+    {
+        return _instantiated_signature;
+    }
+
+
+
+
+
+    member_table_packed_entry::member_table_packed_entry()
+        : _member_token_value(), _position(), _instantiation()
+    {
+    }
+
+    member_table_packed_entry::member_table_packed_entry(core::size_type const member_token_value,
+                                                         core::size_type const position,
+                                                         core::size_type const instantiation)
+        : _member_token_value(member_token_value),
+          _position(narrow_packed_field(position)),
+          _instantiation(narrow_packed_field(instantiation))
+    {
+    }
+
+    auto member_table_packed_entry::layer() const -> member_table_layer const&
+    {
+        core::assert_initialized(*this);
+
+        // The entries of a layer are stored immediately after the layer:
+        member_table_packed_entry const* const first_entry(this - _position);
+        return *(reinterpret_cast<member_table_layer const*>(first_entry) - 1);
+    }
+
+    auto member_table_packed_entry::member_token() const -> metadata::unrestricted_token
+    {
+        core::assert_initialized(*this);
+
+        member_table_instantiation const* const data(instantiation());
+        return metadata::unrestricted_token(
+            data != nullptr ? &data->scope() : &layer().scope(),
+            _member_token_value);
+    }
+
+    auto member_table_packed_entry::instantiation() const -> member_table_instantiation const*
+    {
+        core::assert_initialized(*this);
+
+        return _instantiation != 0 ? &layer().instantiation(_instantiation) : nullptr;
+    }
+
+    auto member_table_packed_entry::is_initialized() const -> bool
+    {
+        return _member_token_value != 0;
+    }
+
+
+
+
+
     template <member_kind MemberTag>
     auto member_table_entry_facade<MemberTag>::member_token() const -> token_type
     {
@@ -1479,7 +1802,11 @@ namespace cxxreflect { namespace reflection { namespace detail {
     {
         core::assert_initialized(*this);
 
-        return is_instantiated() && entry_with_instantiation().instantiating_type().is_initialized();
+        if (is_instantiated())
+            return entry_with_instantiation().instantiating_type().is_initialized();
+
+        member_table_instantiation const* const data(entry().instantiation());
+        return data != nullptr && data->instantiating_type().is_initialized();
     }
     
     template <member_kind MemberTag>
@@ -1488,7 +1815,9 @@ namespace cxxreflect { namespace reflection { namespace detail {
         core::assert_initialized(*this);
         core::assert_true([&]{ return has_instantiating_type(); });
 
-        return !is_instantiated() ? metadata::type_def_or_signature() : entry_with_instantiation().instantiating_type();
+        return !is_instantiated()
+            ? entry().instantiation()->instantiating_type()
+            : entry_with_instantiation().instantiating_type();
     }
     
     template <member_kind MemberTag>
@@ -1496,7 +1825,11 @@ namespace cxxreflect { namespace reflection { namespace detail {
     {
         core::assert_initialized(*this);
 
-        return is_instantiated() && entry_with_instantiation().instantiated_signature().is_initialized();
+        if (is_instantiated())
+            return entry_with_instantiation().instantiated_signature().is_initialized();
+
+        member_table_instantiation const* const data(entry().instantiation());
+        return data != nullptr && data->instantiated_signature().is_initialized();
     }
     
     template <member_kind MemberTag>
@@ -1505,7 +1838,9 @@ namespace cxxreflect { namespace reflection { namespace detail {
         core::assert_initialized(*this);
         core::assert_true([&]{ return has_instantiated_signature(); });
 
-        return !is_instantiated() ? metadata::blob() : entry_with_instantiation().instantiated_signature();
+        return !is_instantiated()
+            ? entry().instantiation()->instantiated_signature()
+            : entry_with_instantiation().instantiated_signature();
     }
 
     template <member_kind MemberTag>
@@ -1521,11 +1856,11 @@ namespace cxxreflect { namespace reflection { namespace detail {
     }
 
     template <member_kind MemberTag>
-    auto member_table_entry_facade<MemberTag>::entry() const -> member_table_entry const&
+    auto member_table_entry_facade<MemberTag>::entry() const -> member_table_packed_entry const&
     {
         core::assert_true([&]{ return !is_instantiated(); });
 
-        return *reinterpret_cast<member_table_entry const*>(this);
+        return *reinterpret_cast<member_table_packed_entry const*>(this);
     }
 
     template <member_kind MemberTag>
@@ -1541,13 +1876,17 @@ namespace cxxreflect { namespace reflection { namespace detail {
     {
         core::assert_initialized(*this);
 
-        return is_instantiated()
-            ? member_table_entry_with_instantiation(entry_with_instantiation())
-            : member_table_entry_with_instantiation(entry());
+        if (is_instantiated())
+            return entry_with_instantiation();
+
+        return member_table_entry_with_instantiation(
+            entry().member_token(),
+            has_instantiating_type()     ? instantiating_type()     : metadata::type_def_or_signature(),
+            has_instantiated_signature() ? instantiated_signature() : metadata::blob());
     }
 
     template <member_kind MemberTag>
-    auto member_table_entry_facade<MemberTag>::from(member_table_entry const* const e)
+    auto member_table_entry_facade<MemberTag>::from(member_table_packed_entry const* const e)
         -> member_table_entry_facade const*
     {
         if (e == nullptr)
@@ -1588,23 +1927,13 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
 
     template <member_kind MemberTag>
-    auto member_table_iterator_constructor<MemberTag>::operator()(member_kind const& kind, core::stride_iterator const& current) const
+    auto member_table_iterator_constructor<MemberTag>::operator()(member_kind const& kind, member_table_cursor const& cursor) const
         -> member_table_entry_facade<MemberTag> const*
     {
         core::assert_true([&]{ return kind == MemberTag; });
-        core::assert_initialized(current);
-
-        switch (current.stride())
-        {
-        case sizeof(member_table_entry):
-            return member_table_entry_facade<MemberTag>::from(reinterpret_cast<member_table_entry const*>(*current));
-
-        case sizeof(member_table_entry_with_instantiation):
-            return member_table_entry_facade<MemberTag>::from(reinterpret_cast<member_table_entry_with_instantiation const*>(*current));
+        core::assert_initialized(cursor);
 
-        default:
-            core::assert_unreachable();
-        }
+        return member_table_entry_facade<MemberTag>::from(*cursor);
     }
 
     template class member_table_iterator_constructor<member_kind::event     >;
@@ -1617,164 +1946,541 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
 
 
-    membership_context::membership_context()
+    member_table_cursor::member_table_cursor()
     {
     }
 
-    auto membership_context::get_state() const -> state_flags
+    member_table_cursor::member_table_cursor(member_table_layer const* const table, core::size_type const index)
+        : _table(table), _index(index)
     {
-        return state_flags(_state.load());
+        core::assert_not_null(table);
     }
 
-    template <member_kind MemberTag>
-    auto membership_context::get_table() const
-        -> core::optional<typename member_table_iterator_generator<MemberTag>::range_type>
+    auto member_table_cursor::get() const -> reference
     {
-        typedef typename member_table_iterator_generator<MemberTag>::type       iterator_type;
-        typedef typename member_table_iterator_generator<MemberTag>::range_type range_type;
+        core::assert_initialized(*this);
+        return _table->entry(_index.get());
+    }
 
-        // First, check to see if we've built this table; if we haven't, return immediately:
-        state_flags const flags(_state.load());
-        if (!flags.is_set(primary_state_flag_for(MemberTag)))
-            return core::optional<range_type>();
+    auto member_table_cursor::operator*() const -> reference
+    {
+        return get();
+    }
 
-        // Otherwise, obtain the table range and convert it into an iterable range:
-        core::size_type const stride(flags.is_set(instantiated_state_flag_for(MemberTag))
-            ? sizeof(member_table_entry_with_instantiation)
-            : sizeof(member_table_entry));
+    auto member_table_cursor::operator->() const -> pointer
+    {
+        return get();
+    }
 
-        membership_context_base<MemberTag> const& base(*this);
+    auto member_table_cursor::is_initialized() const -> bool
+    {
+        return _table.is_initialized();
+    }
 
-        return range_type(
-            iterator_type(MemberTag, core::stride_iterator(base._first.load(), stride)),
-            iterator_type(MemberTag, core::stride_iterator(base._last.load(),  stride)));
+
+
+
+
+    member_table_layer::member_table_layer(member_table_layer         const* const base,
+                                           metadata::database         const* const scope,
+                                           core::size_type            const* const replaced_indices,
+                                           core::size_type                   const replaced_count,
+                                           core::size_type                   const appended_count,
+                                           member_table_instantiation const* const instantiations)
+        : _base(base),
+          _scope(scope),
+          _replaced_indices(replaced_indices),
+          _instantiations(instantiations),
+          _base_size(base != nullptr ? base->size() : 0),
+          _replaced_count(replaced_count),
+          _appended_count(appended_count)
+    {
+        core::assert_not_null(scope);
+        core::assert_true([&]{ return base != nullptr || replaced_count == 0; });
+        core::assert_true([&]{ return replaced_count == 0 || replaced_indices != nullptr; });
     }
 
-    template <member_kind MemberTag>
-    auto membership_context::get_range() const
-        -> core::optional<core::const_byte_range>
+    auto member_table_layer::base() const -> member_table_layer const*
     {
-        // First, check to see if we've built this table; if we haven't, return immediately:
-        state_flags const flags(_state.load());
-        if (!flags.is_set(primary_state_flag_for(MemberTag)))
-            return core::optional<core::const_byte_range>();
+        return _base;
+    }
 
-        membership_context_base<MemberTag> const& base(*this);
+    auto member_table_layer::scope() const -> metadata::database const&
+    {
+        return *_scope;
+    }
 
-        return core::const_byte_range(base._first.load(), base._last.load());
+    auto member_table_layer::size() const -> core::size_type
+    {
+        return _base_size + _appended_count;
     }
 
-    template <member_kind MemberTag>
-    auto membership_context::set_table(core::const_byte_range const table_range, bool const is_instantiated)
-        -> typename member_table_iterator_generator<MemberTag>::range_type
+    auto member_table_layer::begin() const -> member_table_cursor
     {
-        state_flags const current_flags(_state.load());
-        core::assert_true([&]{ return !current_flags.is_set(primary_state_flag_for(MemberTag)); });
+        return member_table_cursor(this, 0);
+    }
 
-        membership_context_base<MemberTag>& base(*this);
+    auto member_table_layer::end() const -> member_table_cursor
+    {
+        return member_table_cursor(this, size());
+    }
+
+    auto member_table_layer::entry(core::size_type const index) const -> member_table_packed_entry const*
+    {
+        core::assert_true([&]{ return index < size(); });
 
-        base._first.store(table_range.begin());
-        base._last.store (table_range.end());
+        // Walk down the layers until we find the layer that owns the entry.  An entry is owned by
+        // a layer if it was appended in that layer or if that layer replaced it:
+        member_table_layer const* layer(this);
+        for (;;)
+        {
+            if (index >= layer->_base_size)
+                return layer->owned_entry(layer->_replaced_count + (index - layer->_base_size));
 
-        // Note:  The state must be stored last, to ensure that a request to get a table fails
-        // until the table pointers have been set.  We require that all possible callers of this
-        // function synchronize, so there is no race between reading the flags above and setting
-        // the flags here.
-        state const new_flag_bits(
-            primary_state_flag_for(MemberTag) |
-            (is_instantiated ? instantiated_state_flag_for(MemberTag) : state()));
+            core::size_type const* const first_replaced(layer->_replaced_indices);
+            core::size_type const* const last_replaced (layer->_replaced_indices + layer->_replaced_count);
 
-        _state.store(current_flags.enumerator() | new_flag_bits);
+            core::size_type const* const it(std::lower_bound(first_replaced, last_replaced, index));
+            if (it != last_replaced && *it == index)
+                return layer->owned_entry(core::convert_integer(it - first_replaced));
 
-        return get_table<MemberTag>().value();
+            layer = layer->_base;
+        }
     }
 
-    auto membership_context::primary_state_flag_for(member_kind const kind) -> state
+    auto member_table_layer::owned_entry(core::size_type const position) const -> member_table_packed_entry const*
     {
-        return (state)((core::size_type)1 << (core::size_type)kind);
+        core::assert_true([&]{ return position < _replaced_count + _appended_count; });
+
+        // The entries of a layer are stored immediately after the layer:
+        return reinterpret_cast<member_table_packed_entry const*>(this + 1) + position;
     }
 
-    auto membership_context::instantiated_state_flag_for(member_kind const kind) -> state
+    auto member_table_layer::instantiation(core::size_type const index) const -> member_table_instantiation const&
     {
-        return (state)((core::size_type)1 << ((core::size_type)kind + 8));
+        core::assert_true([&]{ return index != 0; });
+        core::assert_not_null(_instantiations);
+
+        return _instantiations[index - 1];
     }
 
-    template auto membership_context::get_table<member_kind::event     >() const -> core::optional<member_table_iterator_generator<member_kind::event     >::range_type>;
-    template auto membership_context::get_table<member_kind::field     >() const -> core::optional<member_table_iterator_generator<member_kind::field     >::range_type>;
-    template auto membership_context::get_table<member_kind::interface_>() const -> core::optional<member_table_iterator_generator<member_kind::interface_>::range_type>;
-    template auto membership_context::get_table<member_kind::method    >() const -> core::optional<member_table_iterator_generator<member_kind::method    >::range_type>;
-    template auto membership_context::get_table<member_kind::property  >() const -> core::optional<member_table_iterator_generator<member_kind::property  >::range_type>;
-    
-    template auto membership_context::get_range<member_kind::event     >() const -> core::optional<core::const_byte_range>;
-    template auto membership_context::get_range<member_kind::field     >() const -> core::optional<core::const_byte_range>;
-    template auto membership_context::get_range<member_kind::interface_>() const -> core::optional<core::const_byte_range>;
-    template auto membership_context::get_range<member_kind::method    >() const -> core::optional<core::const_byte_range>;
-    template auto membership_context::get_range<member_kind::property  >() const -> core::optional<core::const_byte_range>;
-    
-    template auto membership_context::set_table<member_kind::event     >(core::const_byte_range, bool) -> member_table_iterator_generator<member_kind::event     >::range_type;
-    template auto membership_context::set_table<member_kind::field     >(core::const_byte_range, bool) -> member_table_iterator_generator<member_kind::field     >::range_type;
-    template auto membership_context::set_table<member_kind::interface_>(core::const_byte_range, bool) -> member_table_iterator_generator<member_kind::interface_>::range_type;
-    template auto membership_context::set_table<member_kind::method    >(core::const_byte_range, bool) -> member_table_iterator_generator<member_kind::method    >::range_type;
-    template auto membership_context::set_table<member_kind::property  >(core::const_byte_range, bool) -> member_table_iterator_generator<member_kind::property  >::range_type;
 
 
 
 
+    interface_closure_block::interface_closure_block()
+        : _index(0), _bits(0)
+    {
+    }
 
-    membership_handle::membership_handle()
+    interface_closure_block::interface_closure_block(std::uint32_t const index, std::uint32_t const bits)
+        : _index(index), _bits(bits)
     {
     }
 
-    membership_handle::membership_handle(membership_storage* const storage,
-                                         membership_context* const context,
-                                         core::internal_key)
-        : _storage(storage), _context(context)
+    auto interface_closure_block::index() const -> std::uint32_t
     {
-        core::assert_not_null(storage);
-        core::assert_not_null(context);
+        return _index;
     }
 
-    auto membership_handle::get_events() const -> event_table_range
+    auto interface_closure_block::bits() const -> std::uint32_t
     {
-        return get_table<member_kind::event>();
+        return _bits;
     }
 
-    auto membership_handle::get_fields() const -> field_table_range
+    interface_closure::interface_closure(core::size_type const block_count)
+        : _block_count(block_count)
     {
-        return get_table<member_kind::field>();
     }
 
-    auto membership_handle::get_interfaces() const -> interface_table_range
+    auto interface_closure::begin() const -> interface_closure_block const*
     {
-        return get_table<member_kind::interface_>();
+        return reinterpret_cast<interface_closure_block const*>(this + 1);
     }
 
-    auto membership_handle::get_methods() const -> method_table_range
+    auto interface_closure::end() const -> interface_closure_block const*
     {
-        return get_table<member_kind::method>();
+        return begin() + _block_count;
     }
 
-    auto membership_handle::get_properties() const -> property_table_range
+    auto interface_closure::contains(core::size_type const interface_id) const -> bool
     {
-        return get_table<member_kind::property>();
+        std::uint32_t const index(core::convert_integer(interface_id / 32));
+
+        interface_closure_block const* const it(std::lower_bound(begin(), end(), index,
+            [](interface_closure_block const& block, std::uint32_t const target_index)
+        {
+            return block.index() < target_index;
+        }));
+
+        if (it == end() || it->index() != index)
+            return false;
+
+        return (it->bits() & (static_cast<std::uint32_t>(1) << (interface_id % 32))) != 0;
     }
 
-    auto membership_handle::context(core::internal_key) const -> membership_context&
+
+
+
+
+    member_name_index_entry::member_name_index_entry()
+        : _hash(0), _index(0)
     {
-        core::assert_initialized(*this);
+    }
 
-        return *_context;
+    member_name_index_entry::member_name_index_entry(std::uint32_t const hash, std::uint32_t const index)
+        : _hash(hash), _index(index)
+    {
     }
 
-    auto membership_handle::is_initialized() const -> bool
+    auto member_name_index_entry::hash() const -> std::uint32_t
     {
-        return _storage.is_initialized() && _context.is_initialized();
+        return _hash;
     }
 
-    template <member_kind MemberTag>
-    auto membership_handle::get_table() const -> typename member_table_iterator_generator<MemberTag>::range_type
+    auto member_name_index_entry::index() const -> std::uint32_t
     {
-        core::assert_initialized(*this);
+        return _index;
+    }
+
+    member_name_index::member_name_index(core::size_type const entry_count)
+        : _entry_count(entry_count)
+    {
+    }
+
+    auto member_name_index::begin() const -> member_name_index_entry const*
+    {
+        return reinterpret_cast<member_name_index_entry const*>(this + 1);
+    }
+
+    auto member_name_index::end() const -> member_name_index_entry const*
+    {
+        return begin() + _entry_count;
+    }
+
+    auto member_name_index::compute_hash(core::string_reference const& name) -> std::uint32_t
+    {
+        // FNV-1a; names are short, so hashing is cheap compared with comparing names:
+        std::uint32_t hash(2166136261);
+        core::for_all(name, [&](core::character const c)
+        {
+            hash = (hash ^ static_cast<std::uint32_t>(c)) * 16777619;
+        });
+
+        return hash;
+    }
+
+    template <member_kind MemberTag>
+    auto member_name_iterator_constructor<MemberTag>::operator()(member_table_layer      const* const layer,
+                                                                 member_name_index_entry const* const entry) const
+        -> member_table_entry_facade<MemberTag> const*
+    {
+        core::assert_not_null(layer);
+        core::assert_not_null(entry);
+
+        return member_table_entry_facade<MemberTag>::from(layer->entry(entry->index()));
+    }
+
+    template class member_name_iterator_constructor<member_kind::event   >;
+    template class member_name_iterator_constructor<member_kind::field   >;
+    template class member_name_iterator_constructor<member_kind::method  >;
+    template class member_name_iterator_constructor<member_kind::property>;
+
+
+
+
+
+    member_view::member_view(metadata::binding_flags const flags, core::size_type const count, member_view const* const next)
+        : _flags(flags), _count(count), _next(next)
+    {
+    }
+
+    auto member_view::flags() const -> metadata::binding_flags
+    {
+        return _flags;
+    }
+
+    auto member_view::next() const -> member_view const*
+    {
+        return _next;
+    }
+
+    auto member_view::begin() const -> std::uint32_t const*
+    {
+        return reinterpret_cast<std::uint32_t const*>(this + 1);
+    }
+
+    auto member_view::end() const -> std::uint32_t const*
+    {
+        return begin() + _count;
+    }
+
+    template <member_kind MemberTag>
+    auto member_view_iterator_constructor<MemberTag>::operator()(member_table_layer const* const layer,
+                                                                 std::uint32_t      const* const index) const
+        -> member_table_entry_facade<MemberTag> const*
+    {
+        core::assert_not_null(layer);
+        core::assert_not_null(index);
+
+        return member_table_entry_facade<MemberTag>::from(layer->entry(*index));
+    }
+
+    template class member_view_iterator_constructor<member_kind::field   >;
+    template class member_view_iterator_constructor<member_kind::method  >;
+    template class member_view_iterator_constructor<member_kind::property>;
+
+
+
+
+
+    membership_context::membership_context()
+    {
+    }
+
+    auto membership_context::get_state() const -> state_flags
+    {
+        return state_flags(_state.load());
+    }
+
+    template <member_kind MemberTag>
+    auto membership_context::get_table() const
+        -> core::optional<typename member_table_iterator_generator<MemberTag>::range_type>
+    {
+        typedef typename member_table_iterator_generator<MemberTag>::type       iterator_type;
+        typedef typename member_table_iterator_generator<MemberTag>::range_type range_type;
+
+        // First, check to see if we've built this table; if we haven't, return immediately:
+        auto const layer(get_layer<MemberTag>());
+        if (!layer.has_value())
+            return core::optional<range_type>();
+
+        // Otherwise, convert the top layer of the table into an iterable range.  An empty table
+        // has no layers:
+        if (layer.value() == nullptr)
+            return range_type();
+
+        return range_type(
+            iterator_type(MemberTag, layer.value()->begin()),
+            iterator_type(MemberTag, layer.value()->end()));
+    }
+
+    template <member_kind MemberTag>
+    auto membership_context::get_layer() const
+        -> core::optional<member_table_layer const*>
+    {
+        state_flags const flags(_state.load());
+        if (!flags.is_set(primary_state_flag_for(MemberTag)))
+            return core::optional<member_table_layer const*>();
+
+        membership_context_base<MemberTag> const& base(*this);
+        return base._table.load();
+    }
+
+    template <member_kind MemberTag>
+    auto membership_context::set_table(member_table_layer const* const table)
+        -> typename member_table_iterator_generator<MemberTag>::range_type
+    {
+        state_flags const current_flags(_state.load());
+        core::assert_true([&]{ return !current_flags.is_set(primary_state_flag_for(MemberTag)); });
+
+        membership_context_base<MemberTag>& base(*this);
+
+        base._table.store(table);
+
+        // Note:  The state must be stored last, to ensure that a request to get a table fails
+        // until the table pointer has been set.  We require that all possible callers of this
+        // function synchronize (they hold the type's construction latch; see membership_storage),
+        // so there is no race between reading the flags above and setting the flags here.
+        _state.store(current_flags.enumerator() | primary_state_flag_for(MemberTag));
+
+        return get_table<MemberTag>().value();
+    }
+
+    auto membership_context::primary_state_flag_for(member_kind const kind) -> state
+    {
+        return (state)((core::size_type)1 << (core::size_type)kind);
+    }
+
+    auto membership_context::get_interface_closure() const -> interface_closure const*
+    {
+        return _interface_closure.load();
+    }
+
+    auto membership_context::set_interface_closure(interface_closure const* const closure) -> void
+    {
+        core::assert_not_null(closure);
+        core::assert_true([&]{ return _interface_closure.load() == nullptr; });
+
+        // As with set_table, callers must hold the type's construction latch:
+        _interface_closure.store(closure);
+    }
+
+    template <member_kind MemberTag>
+    auto membership_context::get_name_index() const -> member_name_index const*
+    {
+        membership_context_base<MemberTag> const& base(*this);
+        return base._name_index.load();
+    }
+
+    template <member_kind MemberTag>
+    auto membership_context::set_name_index(member_name_index const* const index) -> void
+    {
+        core::assert_not_null(index);
+
+        // As with set_table, callers must hold the type's construction latch:
+        membership_context_base<MemberTag>& base(*this);
+        core::assert_true([&]{ return base._name_index.load() == nullptr; });
+
+        base._name_index.store(index);
+    }
+
+    template auto membership_context::get_table<member_kind::event     >() const -> core::optional<member_table_iterator_generator<member_kind::event     >::range_type>;
+    template auto membership_context::get_table<member_kind::field     >() const -> core::optional<member_table_iterator_generator<member_kind::field     >::range_type>;
+    template auto membership_context::get_table<member_kind::interface_>() const -> core::optional<member_table_iterator_generator<member_kind::interface_>::range_type>;
+    template auto membership_context::get_table<member_kind::method    >() const -> core::optional<member_table_iterator_generator<member_kind::method    >::range_type>;
+    template auto membership_context::get_table<member_kind::property  >() const -> core::optional<member_table_iterator_generator<member_kind::property  >::range_type>;
+
+    template auto membership_context::get_layer<member_kind::event     >() const -> core::optional<member_table_layer const*>;
+    template auto membership_context::get_layer<member_kind::field     >() const -> core::optional<member_table_layer const*>;
+    template auto membership_context::get_layer<member_kind::interface_>() const -> core::optional<member_table_layer const*>;
+    template auto membership_context::get_layer<member_kind::method    >() const -> core::optional<member_table_layer const*>;
+    template auto membership_context::get_layer<member_kind::property  >() const -> core::optional<member_table_layer const*>;
+
+    template auto membership_context::set_table<member_kind::event     >(member_table_layer const*) -> member_table_iterator_generator<member_kind::event     >::range_type;
+    template auto membership_context::set_table<member_kind::field     >(member_table_layer const*) -> member_table_iterator_generator<member_kind::field     >::range_type;
+    template auto membership_context::set_table<member_kind::interface_>(member_table_layer const*) -> member_table_iterator_generator<member_kind::interface_>::range_type;
+    template auto membership_context::set_table<member_kind::method    >(member_table_layer const*) -> member_table_iterator_generator<member_kind::method    >::range_type;
+    template auto membership_context::set_table<member_kind::property  >(member_table_layer const*) -> member_table_iterator_generator<member_kind::property  >::range_type;
+
+    template <member_kind MemberTag>
+    auto membership_context::get_views() const -> member_view const*
+    {
+        membership_context_base<MemberTag> const& base(*this);
+        return base._views.load();
+    }
+
+    template <member_kind MemberTag>
+    auto membership_context::insert_view(member_view const* const view) -> void
+    {
+        core::assert_not_null(view);
+
+        // As with set_table, callers must hold the type's construction latch.  Readers walk the
+        // list without synchronization, so the view must be linked before it is published:
+        membership_context_base<MemberTag>& base(*this);
+        core::assert_true([&]{ return view->next() == base._views.load(); });
+
+        base._views.store(view);
+    }
+
+    template auto membership_context::get_name_index<member_kind::event   >() const -> member_name_index const*;
+    template auto membership_context::get_name_index<member_kind::field   >() const -> member_name_index const*;
+    template auto membership_context::get_name_index<member_kind::method  >() const -> member_name_index const*;
+    template auto membership_context::get_name_index<member_kind::property>() const -> member_name_index const*;
+
+    template auto membership_context::set_name_index<member_kind::event   >(member_name_index const*) -> void;
+    template auto membership_context::set_name_index<member_kind::field   >(member_name_index const*) -> void;
+    template auto membership_context::set_name_index<member_kind::method  >(member_name_index const*) -> void;
+    template auto membership_context::set_name_index<member_kind::property>(member_name_index const*) -> void;
+
+    template auto membership_context::get_views<member_kind::field   >() const -> member_view const*;
+    template auto membership_context::get_views<member_kind::method  >() const -> member_view const*;
+    template auto membership_context::get_views<member_kind::property>() const -> member_view const*;
+
+    template auto membership_context::insert_view<member_kind::field   >(member_view const*) -> void;
+    template auto membership_context::insert_view<member_kind::method  >(member_view const*) -> void;
+    template auto membership_context::insert_view<member_kind::property>(member_view const*) -> void;
+
+
+
+
+
+    membership_handle::membership_handle()
+    {
+    }
+
+    membership_handle::membership_handle(membership_storage* const storage,
+                                         membership_context* const context,
+                                         core::internal_key)
+        : _storage(storage), _context(context)
+    {
+        core::assert_not_null(storage);
+        core::assert_not_null(context);
+    }
+
+    auto membership_handle::get_events() const -> event_table_range
+    {
+        return get_table<member_kind::event>();
+    }
+
+    auto membership_handle::get_fields() const -> field_table_range
+    {
+        return get_table<member_kind::field>();
+    }
+
+    auto membership_handle::get_interfaces() const -> interface_table_range
+    {
+        return get_table<member_kind::interface_>();
+    }
+
+    auto membership_handle::get_methods() const -> method_table_range
+    {
+        return get_table<member_kind::method>();
+    }
+
+    auto membership_handle::get_properties() const -> property_table_range
+    {
+        return get_table<member_kind::property>();
+    }
+
+    auto membership_handle::get_interface_closure() const -> interface_closure const&
+    {
+        core::assert_initialized(*this);
+
+        interface_closure const* const existing_closure(_context->get_interface_closure());
+        if (existing_closure != nullptr)
+            return *existing_closure;
+
+        _storage->create_interface_closure(*_context, core::internal_key());
+        return *_context->get_interface_closure();
+    }
+
+    auto membership_handle::find_events(core::string_reference const& name) const -> event_name_range
+    {
+        return find_by_name<member_kind::event>(name);
+    }
+
+    auto membership_handle::find_fields(core::string_reference const& name) const -> field_name_range
+    {
+        return find_by_name<member_kind::field>(name);
+    }
+
+    auto membership_handle::find_methods(core::string_reference const& name) const -> method_name_range
+    {
+        return find_by_name<member_kind::method>(name);
+    }
+
+    auto membership_handle::find_properties(core::string_reference const& name) const -> property_name_range
+    {
+        return find_by_name<member_kind::property>(name);
+    }
+
+    auto membership_handle::context(core::internal_key) const -> membership_context&
+    {
+        core::assert_initialized(*this);
+
+        return *_context;
+    }
+
+    auto membership_handle::is_initialized() const -> bool
+    {
+        return _storage.is_initialized() && _context.is_initialized();
+    }
+
+    template <member_kind MemberTag>
+    auto membership_handle::get_table() const -> typename member_table_iterator_generator<MemberTag>::range_type
+    {
+        core::assert_initialized(*this);
 
         // First, check to see if we already have a table; if we do, return it:
         auto const existing_table(_context->get_table<MemberTag>());
@@ -1790,43 +2496,403 @@ namespace cxxreflect { namespace reflection { namespace detail {
             : typename member_table_iterator_generator<MemberTag>::range_type();
     }
 
+    template <member_kind MemberTag>
+    auto membership_handle::get_view(metadata::binding_flags                                           flags,
+                                     reflection::type                                           const& reflected_type,
+                                     typename member_view_iterator_generator<MemberTag>::filter_type filter) const
+        -> typename member_view_iterator_generator<MemberTag>::range_type
+    {
+        typedef typename member_view_iterator_generator<MemberTag>::type       iterator_type;
+        typedef typename member_view_iterator_generator<MemberTag>::range_type range_type;
+
+        core::assert_initialized(*this);
+        core::assert_not_null(filter);
+
+        // No filter distinguishes case, so views are shared by case-sensitive and case-insensitive
+        // requests:
+        flags.unset(metadata::binding_attribute::ignore_case);
+
+        auto const table(get_table<MemberTag>());
+        if (table.empty())
+            return range_type();
+
+        member_table_layer const* const layer(_context->get_layer<MemberTag>().value());
+
+        member_view const* view(_context->get_views<MemberTag>());
+        while (view != nullptr && view->flags() != flags)
+            view = view->next();
+
+        if (view == nullptr)
+        {
+            // We filter the table before we acquire the construction latch because filtering may
+            // require the member tables of other types (e.g., the property filter examines the
+            // accessor methods of each property):
+            std::vector<std::uint32_t> indices;
+            for (core::size_type index(0); index != layer->size(); ++index)
+            {
+                if (!filter(flags, reflected_type, member_table_entry_facade<MemberTag>::from(layer->entry(index))))
+                    indices.push_back(core::convert_integer(index));
+            }
+
+            view = _storage->create_view<MemberTag>(*_context, flags, indices, core::internal_key());
+        }
+
+        return range_type(iterator_type(layer, view->begin()), iterator_type(layer, view->end()));
+    }
+
     template auto membership_handle::get_table<member_kind::event     >() const -> member_table_iterator_generator<member_kind::event     >::range_type;
     template auto membership_handle::get_table<member_kind::field     >() const -> member_table_iterator_generator<member_kind::field     >::range_type;
     template auto membership_handle::get_table<member_kind::interface_>() const -> member_table_iterator_generator<member_kind::interface_>::range_type;
     template auto membership_handle::get_table<member_kind::method    >() const -> member_table_iterator_generator<member_kind::method    >::range_type;
+    template <member_kind MemberTag>
+    auto membership_handle::find_by_name(core::string_reference const& name) const
+        -> typename member_name_iterator_generator<MemberTag>::range_type
+    {
+        typedef typename member_name_iterator_generator<MemberTag>::type       iterator_type;
+        typedef typename member_name_iterator_generator<MemberTag>::range_type range_type;
+
+        core::assert_initialized(*this);
+
+        member_name_index const* index(_context->get_name_index<MemberTag>());
+        if (index == nullptr)
+        {
+            _storage->create_name_index<MemberTag>(*_context, core::internal_key());
+            index = _context->get_name_index<MemberTag>();
+        }
+
+        // An empty table has no layers (and its index has no entries):
+        auto const table(_context->get_layer<MemberTag>());
+        if (!table.has_value() || table.value() == nullptr)
+            return range_type();
+
+        member_table_layer const* const layer(table.value());
+
+        auto const range(std::equal_range(index->begin(), index->end(),
+            std::make_pair(member_name_index::compute_hash(name), name),
+            member_name_comparer<MemberTag>(layer)));
+
+        return range_type(iterator_type(layer, range.first), iterator_type(layer, range.second));
+    }
+
     template auto membership_handle::get_table<member_kind::property  >() const -> member_table_iterator_generator<member_kind::property  >::range_type;
 
+    template auto membership_handle::find_by_name<member_kind::event   >(core::string_reference const&) const -> member_name_iterator_generator<member_kind::event   >::range_type;
+    template auto membership_handle::find_by_name<member_kind::field   >(core::string_reference const&) const -> member_name_iterator_generator<member_kind::field   >::range_type;
+    template auto membership_handle::find_by_name<member_kind::method  >(core::string_reference const&) const -> member_name_iterator_generator<member_kind::method  >::range_type;
+    template auto membership_handle::find_by_name<member_kind::property>(core::string_reference const&) const -> member_name_iterator_generator<member_kind::property>::range_type;
+
+    template auto membership_handle::get_view<member_kind::field   >(metadata::binding_flags, reflection::type const&, member_view_iterator_generator<member_kind::field   >::filter_type) const -> member_view_iterator_generator<member_kind::field   >::range_type;
+    template auto membership_handle::get_view<member_kind::method  >(metadata::binding_flags, reflection::type const&, member_view_iterator_generator<member_kind::method  >::filter_type) const -> member_view_iterator_generator<member_kind::method  >::range_type;
+    template auto membership_handle::get_view<member_kind::property>(metadata::binding_flags, reflection::type const&, member_view_iterator_generator<member_kind::property>::filter_type) const -> member_view_iterator_generator<member_kind::property>::range_type;
+
+
+
+
+
+    membership_storage::index_node::index_node(key_type const& key)
+        : _key(key)
+    {
+        core::assert_initialized(key);
+    }
+
+    membership_statistics::membership_statistics()
+    {
+    }
+
+    membership_statistics::membership_statistics(core::size_type const layer_count,
+                                                 core::size_type const entry_count,
+                                                 core::size_type const table_bytes,
+                                                 core::size_type const signature_bytes)
+        : _layer_count(layer_count),
+          _entry_count(entry_count),
+          _table_bytes(table_bytes),
+          _signature_bytes(signature_bytes)
+    {
+    }
+
+    auto membership_statistics::layer_count() const -> core::size_type
+    {
+        return _layer_count.get();
+    }
+
+    auto membership_statistics::entry_count() const -> core::size_type
+    {
+        return _entry_count.get();
+    }
+
+    auto membership_statistics::table_bytes() const -> core::size_type
+    {
+        return _table_bytes.get();
+    }
+
+    auto membership_statistics::signature_bytes() const -> core::size_type
+    {
+        return _signature_bytes.get();
+    }
+
 
 
 
 
     membership_storage::membership_storage()
+        : _index(1 << 10),
+          _identity_index(1 << 10),
+          _layer_count(0),
+          _entry_count(0),
+          _table_bytes(0),
+          _signature_bytes(0)
+    {
+    }
+
+    membership_storage::~membership_storage()
     {
+        // For completeness
     }
 
     auto membership_storage::get_membership(key_type const& key) -> membership_handle
     {
-        core::recursive_mutex_lock const lock(_sync.lock());
+        core::assert_initialized(key);
+
+        loader_context const& loader(loader_context::from(key.scope()));
+
+        // The canonical type id of a type definition is computed without resolution:
+        if (key.is_token())
+            return membership_handle(this, &get_node(loader.get_canonical_type_id(key), key)->_context, core::internal_key());
+
+        // Fast path:  most lookups are for signatures that we have already seen, so we can find
+        // them by identity without taking a lock or canonicalizing them:
+        core::const_byte_iterator const first(key.as_blob().begin());
+        index_node* const existing_node(_identity_index.find(first));
+        if (existing_node != nullptr)
+            return membership_handle(this, &existing_node->_context, core::internal_key());
+
+        // Slow path:  canonicalizing the signature may resolve types and load assemblies, so we do
+        // it before we take any lock.  If one of its types cannot be resolved, the blob is its own
+        // key:
+        canonical_type_id id;
+        try
+        {
+            id = loader.get_canonical_type_id(key);
+        }
+        catch (core::runtime_error const&)
+        {
+        }
+
+        index_node* const canonical_node(id.is_initialized() ? get_node(id, key) : nullptr);
+        index_node* const node(_identity_index.find_or_insert(first, [&]() -> index_node*
+        {
+            if (canonical_node != nullptr)
+                return canonical_node;
+
+            _identity_nodes.push_back(core::make_unique<index_node>(key));
+            return _identity_nodes.back().get();
+        }));
+
+        return membership_handle(this, &node->_context, core::internal_key());
+    }
+
+    auto membership_storage::get_node(canonical_type_id const id, key_type const& key) -> index_node*
+    {
+        index_node* const existing_node(_index.find(id));
+        if (existing_node != nullptr)
+            return existing_node;
 
-        return membership_handle(this, &_index[key], core::internal_key());
+        // The index searches again under its lock, in case another thread inserted the node after
+        // our first search, and only then do we create the node:
+        return _index.find_or_insert(id, [&]() -> index_node*
+        {
+            _nodes.push_back(core::make_unique<index_node>(key));
+            return _nodes.back().get();
+        });
     }
 
     auto membership_storage::allocate_signature(core::const_byte_range const transient_range, core::internal_key) -> core::const_byte_range
     {
+        core::recursive_mutex_lock const lock(_allocator_sync.lock());
+        _signature_bytes += transient_range.size();
         return allocate_range(_signature_allocator, transient_range);
     }
 
     auto membership_storage::allocate_table(core::const_byte_range const transient_range, core::internal_key) -> core::const_byte_range
     {
-        return allocate_range(_table_allocator, transient_range);
+        if (transient_range.empty())
+            return core::const_byte_range();
+
+        // Every allocation is padded to the alignment of the layers, so that layers, instantiation
+        // data, and index arrays may be freely mixed in the table allocator:
+        core::size_type const alignment(std::alignment_of<member_table_layer>::value);
+        core::size_type const size(transient_range.size());
+        core::size_type const padded_size((size + alignment - 1) / alignment * alignment);
+
+        core::recursive_mutex_lock const lock(_allocator_sync.lock());
+        _table_bytes += padded_size;
+
+        auto const persistent_range(_table_allocator.allocate(padded_size));
+        core::range_checked_copy(begin(transient_range), end(transient_range), begin(persistent_range), end(persistent_range));
+        return core::const_byte_range(persistent_range.begin(), persistent_range.begin() + size);
+    }
+
+    auto membership_storage::allocate_layer(member_table_layer     const& transient_layer,
+                                            core::const_byte_range const  entries,
+                                            core::internal_key) -> member_table_layer const*
+    {
+        std::vector<core::byte> transient_bytes(core::begin_bytes(transient_layer), core::end_bytes(transient_layer));
+        transient_bytes.insert(transient_bytes.end(), begin(entries), end(entries));
+
+        core::recursive_mutex_lock const lock(_allocator_sync.lock());
+        ++_layer_count;
+        _entry_count += entries.size() / sizeof(member_table_packed_entry);
+
+        return reinterpret_cast<member_table_layer const*>(allocate_table(core::const_byte_range(
+            transient_bytes.data(),
+            transient_bytes.data() + transient_bytes.size()), core::internal_key()).begin());
+    }
+
+    auto membership_storage::statistics() const -> membership_statistics
+    {
+        core::recursive_mutex_lock const lock(_allocator_sync.lock());
+        return membership_statistics(_layer_count, _entry_count, _table_bytes, _signature_bytes);
     }
     
     template <member_kind MemberTag>
     auto membership_storage::create_table(membership_context& context, core::internal_key) -> void
     {
-        core::recursive_mutex_lock const lock(_sync.lock());
+        // The table builder acquires the construction latch for each type whose table it builds:
+        internal_create_table<MemberTag>(*this, node_from_context(context)._key);
+    }
+
+    auto membership_storage::create_interface_closure(membership_context& context, core::internal_key) -> void
+    {
+        interface_table_range const interfaces(membership_handle(this, &context, core::internal_key()).get_interfaces());
+
+        // We obtain the interface ids before we acquire the construction latch because allocating
+        // an id synchronizes on the module that defines the interface and on the loader:
+        std::vector<core::size_type> ids;
+        core::for_all(interfaces, [&](interface_table_entry const* const entry)
+        {
+            metadata::type_def_ref_token const primary_type(compute_primary_type(compute_type(
+                interface_traits::get_interface_type(entry->member_token()))));
 
-        internal_create_table<MemberTag>(*this, key_from_context(context));
+            if (!primary_type.is_initialized())
+                return;
+
+            metadata::type_def_token const definition(resolve_type(primary_type).as_token());
+            ids.push_back(module_context::from(definition.scope()).interface_id(definition));
+        });
+
+        std::sort(begin(ids), end(ids));
+
+        std::vector<interface_closure_block> blocks;
+        core::for_all(ids, [&](core::size_type const id)
+        {
+            std::uint32_t const index(core::convert_integer(id / 32));
+            std::uint32_t const bit(static_cast<std::uint32_t>(1) << (id % 32));
+
+            if (blocks.empty() || blocks.back().index() != index)
+                blocks.push_back(interface_closure_block(index, bit));
+            else
+                blocks.back() = interface_closure_block(index, blocks.back().bits() | bit);
+        });
+
+        interface_closure const transient_closure(core::convert_integer(blocks.size()));
+
+        std::vector<core::byte> transient_bytes(core::begin_bytes(transient_closure), core::end_bytes(transient_closure));
+        transient_bytes.insert(transient_bytes.end(),
+            reinterpret_cast<core::const_byte_iterator>(blocks.data()),
+            reinterpret_cast<core::const_byte_iterator>(blocks.data() + blocks.size()));
+
+        auto const lock(lock_construction(context, core::internal_key()));
+
+        // Another thread may have built the closure while we were computing ours:
+        if (context.get_interface_closure() != nullptr)
+            return;
+
+        context.set_interface_closure(reinterpret_cast<interface_closure const*>(allocate_table(core::const_byte_range(
+            transient_bytes.data(),
+            transient_bytes.data() + transient_bytes.size()), core::internal_key()).begin()));
+    }
+
+    template <member_kind MemberTag>
+    auto membership_storage::create_name_index(membership_context& context, core::internal_key) -> void
+    {
+        if (!context.get_layer<MemberTag>().has_value())
+            create_table<MemberTag>(context, core::internal_key());
+
+        auto const table(context.get_layer<MemberTag>());
+        member_table_layer const* const layer(table.has_value() ? table.value() : nullptr);
+
+        // We hash the names before we acquire the construction latch because reading a name may
+        // require conversion of the name by the database that defines the member:
+        std::vector<member_name_index_entry> entries;
+        if (layer != nullptr)
+        {
+            entries.reserve(layer->size());
+            for (core::size_type index(0); index != layer->size(); ++index)
+            {
+                std::uint32_t const hash(member_name_index::compute_hash(get_member_name<MemberTag>(*layer, index)));
+                entries.push_back(member_name_index_entry(hash, core::convert_integer(index)));
+            }
+
+            std::sort(begin(entries), end(entries), member_name_comparer<MemberTag>(layer));
+        }
+
+        member_name_index const transient_index(core::convert_integer(entries.size()));
+
+        std::vector<core::byte> transient_bytes(core::begin_bytes(transient_index), core::end_bytes(transient_index));
+        transient_bytes.insert(transient_bytes.end(),
+            reinterpret_cast<core::const_byte_iterator>(entries.data()),
+            reinterpret_cast<core::const_byte_iterator>(entries.data() + entries.size()));
+
+        auto const lock(lock_construction(context, core::internal_key()));
+
+        // Another thread may have built the index while we were computing ours:
+        if (context.get_name_index<MemberTag>() != nullptr)
+            return;
+
+        context.set_name_index<MemberTag>(reinterpret_cast<member_name_index const*>(allocate_table(core::const_byte_range(
+            transient_bytes.data(),
+            transient_bytes.data() + transient_bytes.size()), core::internal_key()).begin()));
+    }
+
+    template <member_kind MemberTag>
+    auto membership_storage::create_view(membership_context                & context,
+                                         metadata::binding_flags       const  flags,
+                                         std::vector<std::uint32_t>    const& indices,
+                                         core::internal_key) -> member_view const*
+    {
+        auto const lock(lock_construction(context, core::internal_key()));
+
+        // Another thread may have built the view while we were filtering the table:
+        member_view const* const first_view(context.get_views<MemberTag>());
+        for (member_view const* view(first_view); view != nullptr; view = view->next())
+        {
+            if (view->flags() == flags)
+                return view;
+        }
+
+        member_view const transient_view(flags, core::convert_integer(indices.size()), first_view);
+
+        std::vector<core::byte> transient_bytes(core::begin_bytes(transient_view), core::end_bytes(transient_view));
+        transient_bytes.insert(transient_bytes.end(),
+            reinterpret_cast<core::const_byte_iterator>(indices.data()),
+            reinterpret_cast<core::const_byte_iterator>(indices.data() + indices.size()));
+
+        member_view const* const new_view(reinterpret_cast<member_view const*>(allocate_table(core::const_byte_range(
+            transient_bytes.data(),
+            transient_bytes.data() + transient_bytes.size()), core::internal_key()).begin()));
+
+        context.insert_view<MemberTag>(new_view);
+        return new_view;
+    }
+
+    auto membership_storage::lock_construction(membership_context& context, core::internal_key) -> core::recursive_mutex_lock
+    {
+        return node_from_context(context)._latch.lock();
+    }
+
+    auto membership_storage::id_hash::operator()(canonical_type_id const& id) const -> core::size_type
+    {
+        return id.value();
     }
 
     auto membership_storage::allocate_range(allocator_type& allocator, core::const_byte_range const transient_range) -> core::const_byte_range
@@ -1836,11 +2902,9 @@ namespace cxxreflect { namespace reflection { namespace detail {
         return persistent_range;
     }
 
-    auto membership_storage::key_from_context(membership_context& key) -> key_type const&
+    auto membership_storage::node_from_context(membership_context& context) -> index_node&
     {
-        typedef std::pair<key_type, membership_context> pair_type;
-
-        return reinterpret_cast<pair_type*>(core::begin_bytes(key) - offsetof(pair_type, second))->first;
+        return *reinterpret_cast<index_node*>(core::begin_bytes(context) - offsetof(index_node, _context));
     }
 
     template auto membership_storage::create_table<member_kind::event     >(membership_context&, core::internal_key) -> void;
@@ -1849,4 +2913,13 @@ namespace cxxreflect { namespace reflection { namespace detail {
     template auto membership_storage::create_table<member_kind::method    >(membership_context&, core::internal_key) -> void;
     template auto membership_storage::create_table<member_kind::property  >(membership_context&, core::internal_key) -> void;
 
+    template auto membership_storage::create_name_index<member_kind::event   >(membership_context&, core::internal_key) -> void;
+    template auto membership_storage::create_name_index<member_kind::field   >(membership_context&, core::internal_key) -> void;
+    template auto membership_storage::create_name_index<member_kind::method  >(membership_context&, core::internal_key) -> void;
+    template auto membership_storage::create_name_index<member_kind::property>(membership_context&, core::internal_key) -> void;
+
+    template auto membership_storage::create_view<member_kind::field   >(membership_context&, metadata::binding_flags, std::vector<std::uint32_t> const&, core::internal_key) -> member_view const*;
+    template auto membership_storage::create_view<member_kind::method  >(membership_context&, metadata::binding_flags, std::vector<std::uint32_t> const&, core::internal_key) -> member_view const*;
+    template auto membership_storage::create_view<member_kind::property>(membership_context&, metadata::binding_flags, std::vector<std::uint32_t> const&, core::internal_key) -> member_view const*;
+
 } } }
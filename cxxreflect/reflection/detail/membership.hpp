@@ -6,7 +6,10 @@
 #ifndef CXXREFLECT_REFLECTION_DETAIL_MEMBERSHIP_HPP_
 #define CXXREFLECT_REFLECTION_DETAIL_MEMBERSHIP_HPP_
 
+#include "cxxreflect/reflection/detail/canonical_type.hpp"
+#include "cxxreflect/reflection/detail/concurrent_index.hpp"
 #include "cxxreflect/reflection/detail/forward_declarations.hpp"
+#include "cxxreflect/reflection/detail/member_table_cursor.hpp"
 
 
 
@@ -31,8 +34,8 @@ namespace cxxreflect { namespace reflection { namespace detail {
     ///
     /// One thing that warrants further comment:  the `interim_type` is the type used during table
     /// computation:  we compute the table using this type, then once the table is computed it is
-    /// reduced either to `member_table_entry` or `member_table_entry_with_instantiation`, as
-    /// approprite.  For most types, we simply use `member_table_entry_with_instantiation` for the
+    /// packed into `member_table_packed_entry` objects.  For most types, we simply use
+    /// `member_table_entry_with_instantiation` for the
     /// interim type.  The exception is methods:  we need to store additional information to
     /// correctly compute overrides.  More information is available in the implementation of the
     /// method traits's `insert_member` static member function.
@@ -228,13 +231,9 @@ namespace cxxreflect { namespace reflection { namespace detail {
     /// in a metadata database.  The parent of a member is a type.  The parent is computable via the
     /// metadata database from the member token.
     ///
-    /// This type represents a member in a member table.  It is member kind neutral, so it can
-    /// represent any kind of member.  Each table consists of entries either of this type or of the
-    /// `member_table_entry_with_instantiation_type`.  Each table must consist of one or the other;
-    /// mixing and matching is not permitted (this ensures that each element in a particular table
-    /// has the same size, for simpler iteration and offset computation).  We could use the
-    /// `member_table_entry_with_instantiation_type` for every table, but it is a waste of space,
-    /// and for this code, every byte counts.
+    /// This type represents a member during table computation.  It is member kind neutral, so it
+    /// can represent any kind of member.  It is implicitly convertible to the interim entry types;
+    /// once a table is computed, its entries are packed into `member_table_packed_entry` objects.
     class member_table_entry
     {
     public:
@@ -319,17 +318,70 @@ namespace cxxreflect { namespace reflection { namespace detail {
         override_slot                         _override_slot;
     };
 
-    // The size of the two types cannot be the same because the size is used to determine the entry
-    // type when we dereference an iterator into a member table.
-    CXXREFLECT_STATIC_ASSERT(
-        sizeof(member_table_entry) !=
-        sizeof(member_table_entry_with_instantiation));
+    /// The instantiation data of a packed member table entry
+    ///
+    /// Most entries in a table refer to members defined in the table's scope and have no
+    /// instantiated signature, so they need nothing beyond their token.  Entries that refer to a
+    /// member in another scope or that are instantiated refer to one of these objects, stored in an
+    /// array owned by the layer that owns the entry.
+    ///
+    /// The instantiating type is only recorded if it is a signature (i.e., a generic type
+    /// instantiation).  Otherwise, it is the type definition that owns the member, which can be
+    /// computed from the member token.
+    class member_table_instantiation
+    {
+    public:
 
-    // We use a common allocator for the two types, so they must have the same alignment.  As long
-    // as they have the same alignment, we don't have to worry about alignment.
-    CXXREFLECT_STATIC_ASSERT(
-        std::alignment_of<member_table_entry>::value ==
-        std::alignment_of<member_table_entry_with_instantiation>::value);
+        member_table_instantiation();
+        member_table_instantiation(metadata::database              const* scope,
+                                   metadata::type_def_or_signature const& instantiating_type,
+                                   metadata::blob                  const& instantiated_signature);
+
+        auto scope()                  const -> metadata::database              const&;
+        auto instantiating_type()     const -> metadata::type_def_or_signature const&;
+        auto instantiated_signature() const -> metadata::blob                  const&;
+
+    private:
+
+        core::checked_pointer<metadata::database const> _scope;
+        metadata::type_def_or_signature                 _instantiating_type;
+        metadata::blob                                  _instantiated_signature;
+    };
+
+    /// An entry in a member table, as stored in a `member_table_layer`
+    ///
+    /// Each entry is eight bytes:  the 32-bit token value of the member, the position of the entry
+    /// in its layer's entry array, and the one-based index of its instantiation data in its layer's
+    /// instantiation array (zero if it has none).  The scope of the member is the scope of the
+    /// layer unless the entry has instantiation data, which then records the scope.
+    ///
+    /// The entries of a layer are stored immediately after the layer, so we can find the layer of
+    /// an entry from its position.  This allows a pointer to an entry to be used by itself.  The
+    /// constructor throws a `runtime_error` if the position or instantiation index does not fit
+    /// in sixteen bits.
+    class member_table_packed_entry
+    {
+    public:
+
+        member_table_packed_entry();
+        member_table_packed_entry(core::size_type member_token_value,
+                                  core::size_type position,
+                                  core::size_type instantiation);
+
+        auto layer()         const -> member_table_layer const&;
+        auto member_token()  const -> metadata::unrestricted_token;
+        auto instantiation() const -> member_table_instantiation const*;
+
+        auto is_initialized() const -> bool;
+
+    private:
+
+        core::size_type _member_token_value;
+        std::uint16_t   _position;
+        std::uint16_t   _instantiation;
+    };
+
+    CXXREFLECT_STATIC_ASSERT(sizeof(member_table_packed_entry) == 8);
 
 
 
@@ -337,14 +389,61 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
     /// The internal storage type of a member table
     ///
-    /// Because a member table may have entries either of type `member_table_entry` or of type
-    /// `member_table_entry_with_instantiation`, we cannot use a particular type for this table.
-    /// Instead, we will simply use an array of bytes and keep track of the kind of element that
-    /// is stored in the table (both types should have the same alignment requirement).
+    /// Most of the members of a type are inherited, and the table of a derived type starts with
+    /// the entries of its base type's table, in the same order.  Rather than copying all of those
+    /// entries into every derived type's table, a table is built as a layer over its base type's
+    /// table.  A layer owns only the entries that differ from the base table (overriding methods,
+    /// members whose signatures are instantiated differently) and the entries appended after the
+    /// base entries.  Every other entry is found by walking down to the base layer, so finding an
+    /// entry costs O(d) for a layer d levels above the layer that owns it.
     ///
-    /// When we iterate over the table, we'll use the `stride_iterator` with the correctly
-    /// computed stride value.
-    typedef core::array_range<core::byte const> member_table;
+    /// The entries owned by a layer are stored immediately after it, in the same allocation, and
+    /// are packed (see `member_table_packed_entry`).  A layer without a base is a flat table.
+    /// Layers are allocated by the `membership_storage` and are never destroyed.
+    class member_table_layer
+    {
+    public:
+
+        member_table_layer(member_table_layer         const* base,
+                           metadata::database         const* scope,
+                           core::size_type            const* replaced_indices,
+                           core::size_type                   replaced_count,
+                           core::size_type                   appended_count,
+                           member_table_instantiation const* instantiations);
+
+        auto base()  const -> member_table_layer const*;
+        auto scope() const -> metadata::database const&;
+        auto size()  const -> core::size_type;
+
+        auto begin() const -> member_table_cursor;
+        auto end()   const -> member_table_cursor;
+
+        /// Gets the entry at `index`, walking down to the layer that owns it if necessary
+        auto entry(core::size_type index) const -> member_table_packed_entry const*;
+
+        /// Gets the entry at `position` in this layer's own entry array
+        auto owned_entry(core::size_type position) const -> member_table_packed_entry const*;
+
+        /// Gets this layer's instantiation data with the given one-based `index`
+        auto instantiation(core::size_type index) const -> member_table_instantiation const&;
+
+    private:
+
+        // Note:  This type is copied bytewise into the table allocator, so it must remain
+        // trivially copyable.  The entries that replace base entries are stored first, in the same
+        // order as their (sorted) indices in `_replaced_indices`; the appended entries follow them.
+        member_table_layer         const* _base;
+        metadata::database         const* _scope;
+        core::size_type            const* _replaced_indices;
+        member_table_instantiation const* _instantiations;
+        core::size_type                   _base_size;
+        core::size_type                   _replaced_count;
+        core::size_type                   _appended_count;
+    };
+
+    // The packed entries of a layer are stored immediately after it:
+    CXXREFLECT_STATIC_ASSERT(
+        sizeof(member_table_layer) % std::alignment_of<member_table_packed_entry>::value == 0);
 
 
 
@@ -352,11 +451,15 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
     /// A generic, type-checked member context type
     ///
-    /// This type encapsulates a `member_table_entry` behind an interface that actually uses the
-    /// types with which we want to work.  The `member_table_entry` type is intentionally general:
-    /// it is designed to be usable for all member types.  When we use a particular member table,
-    /// though, we want to use it naturally, as if it refers to the particular kind of member that
-    /// the table contains.  This wrapper provides that interface.
+    /// This type encapsulates a `member_table_packed_entry` (or, during table computation, an
+    /// interim `member_table_entry_with_instantiation`) behind an interface that actually uses the
+    /// types with which we want to work.  The entry types are intentionally general:  they are
+    /// designed to be usable for all member types.  When we use a particular member table, though,
+    /// we want to use it naturally, as if it refers to the particular kind of member that the
+    /// table contains.  This wrapper provides that interface.
+    ///
+    /// The low bit of a facade pointer distinguishes the two entry types:  it is set for an interim
+    /// entry, for which `is_instantiated()` returns `true`.
     template <member_kind MemberTag>
     class member_table_entry_facade
     {
@@ -383,7 +486,7 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
         auto realize() const -> member_table_entry_with_instantiation;
 
-        static auto from(member_table_entry                    const*) -> member_table_entry_facade const*;
+        static auto from(member_table_packed_entry             const*) -> member_table_entry_facade const*;
         static auto from(member_table_entry_with_instantiation const*) -> member_table_entry_facade const*;
         static auto from(member_table_entry_with_override_slot const*) -> member_table_entry_facade const*;
 
@@ -394,7 +497,7 @@ namespace cxxreflect { namespace reflection { namespace detail {
         auto operator=(member_table_entry_facade const&) -> void;
         ~member_table_entry_facade();
 
-        auto entry()                    const -> member_table_entry const&;
+        auto entry()                    const -> member_table_packed_entry const&;
         auto entry_with_instantiation() const -> member_table_entry_with_instantiation const&;
     };
 
@@ -407,7 +510,7 @@ namespace cxxreflect { namespace reflection { namespace detail {
     {
     public:
 
-        auto operator()(member_kind const& kind, core::stride_iterator const& current) const ->
+        auto operator()(member_kind const& kind, member_table_cursor const& current) const ->
             member_table_entry_facade<MemberTag> const*;
     };
 
@@ -425,7 +528,7 @@ namespace cxxreflect { namespace reflection { namespace detail {
     public:
 
         typedef core::instantiating_iterator<
-            core::stride_iterator,
+            member_table_cursor,
             member_table_entry_facade<MemberTag> const*,
             member_kind,
             member_table_iterator_constructor<MemberTag>
@@ -438,6 +541,212 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
 
 
+    /// One 32-bit block of an `interface_closure` bitset
+    class interface_closure_block
+    {
+    public:
+
+        interface_closure_block();
+        interface_closure_block(std::uint32_t index, std::uint32_t bits);
+
+        /// The index of the block; the block holds the bits for interface ids [32 * index, 32 * index + 32)
+        auto index() const -> std::uint32_t;
+        auto bits()  const -> std::uint32_t;
+
+    private:
+
+        std::uint32_t _index;
+        std::uint32_t _bits;
+    };
+
+    CXXREFLECT_STATIC_ASSERT(sizeof(interface_closure_block) == 8);
+
+    /// The set of interfaces implemented by a type, stored as a compressed bitset
+    ///
+    /// Each loader assigns a dense id to every interface type definition that it encounters (see
+    /// `module_context::interface_id()`).  The closure of a type contains the id of every interface
+    /// in the type's interface table, which already includes all inherited interfaces.  A type
+    /// typically implements only a handful of the interfaces known to a loader, so only the nonzero
+    /// 32-bit blocks of the bitset are stored, sorted by index.  Testing for an interface is a
+    /// binary search of these few blocks followed by a bit test.
+    ///
+    /// For a generic interface instantiation, the closure contains the id of its generic interface
+    /// definition; a set bit for a generic interface therefore means only that the type implements
+    /// some instantiation of it.  The blocks are stored immediately after the closure object.
+    class interface_closure
+    {
+    public:
+
+        explicit interface_closure(core::size_type block_count);
+
+        auto begin() const -> interface_closure_block const*;
+        auto end()   const -> interface_closure_block const*;
+
+        auto contains(core::size_type interface_id) const -> bool;
+
+    private:
+
+        core::size_type _block_count;
+    };
+
+    CXXREFLECT_STATIC_ASSERT(
+        sizeof(interface_closure) % std::alignment_of<interface_closure_block>::value == 0);
+
+
+
+
+
+    /// One entry of a `member_name_index`:  the hash of a member's name and its index in the table
+    class member_name_index_entry
+    {
+    public:
+
+        member_name_index_entry();
+        member_name_index_entry(std::uint32_t hash, std::uint32_t index);
+
+        auto hash()  const -> std::uint32_t;
+        auto index() const -> std::uint32_t;
+
+    private:
+
+        std::uint32_t _hash;
+        std::uint32_t _index;
+    };
+
+    CXXREFLECT_STATIC_ASSERT(sizeof(member_name_index_entry) == 8);
+
+    /// An index of the entries of a member table, ordered by name
+    ///
+    /// By-name member lookup would otherwise have to walk the entire member table of a type,
+    /// including every inherited member, and compare the name of each member.  The index orders
+    /// the entries of a table by the hash of their names, then by name, then by their index in the
+    /// table, so all of the members with a given name (e.g., the overloads of a method) are a
+    /// contiguous range of the index, in table order.  A lookup compares hashes by binary search
+    /// and only compares names when hashes are equal, so it costs O(log N) integer comparisons plus
+    /// O(R) for R results.
+    ///
+    /// The index contains every entry of the table, regardless of binding flags, so one index is
+    /// shared by all by-name queries; binding flags are applied to the entries found in the index.
+    /// An index is built lazily, the first time a table is searched by name, and is stored in the
+    /// table allocator.  The entries are stored immediately after the index object.
+    class member_name_index
+    {
+    public:
+
+        explicit member_name_index(core::size_type entry_count);
+
+        auto begin() const -> member_name_index_entry const*;
+        auto end()   const -> member_name_index_entry const*;
+
+        static auto compute_hash(core::string_reference const& name) -> std::uint32_t;
+
+    private:
+
+        core::size_type _entry_count;
+    };
+
+    CXXREFLECT_STATIC_ASSERT(
+        sizeof(member_name_index) % std::alignment_of<member_name_index_entry>::value == 0);
+
+    template <member_kind MemberTag>
+    class member_name_iterator_constructor
+    {
+    public:
+
+        auto operator()(member_table_layer const* layer, member_name_index_entry const* entry) const ->
+            member_table_entry_facade<MemberTag> const*;
+    };
+
+    /// Generator for member name index iterator types; see `member_table_iterator_generator`
+    template <member_kind MemberTag>
+    class member_name_iterator_generator
+    {
+    public:
+
+        typedef core::instantiating_iterator<
+            member_name_index_entry const*,
+            member_table_entry_facade<MemberTag> const*,
+            member_table_layer const*,
+            member_name_iterator_constructor<MemberTag>
+        > type;
+
+        typedef core::iterator_range<type> range_type;
+    };
+
+
+
+
+
+    /// The entries of a member table that match a set of binding flags
+    ///
+    /// Enumerating the members of a type with a set of binding flags filters every entry of the
+    /// member table, and each filter call reads the metadata of the member and of its declaring
+    /// type.  Most programs use only a few sets of flags (e.g., public instance members), and they
+    /// enumerate the members of the same types many times, so we filter the table once for each set
+    /// of flags and cache the result.  A view stores the indices of the unfiltered entries, in
+    /// table order, immediately after the view object; enumerating a view is a contiguous scan with
+    /// no filter calls.
+    ///
+    /// The views of a table are a singly-linked list, newest first; a table typically has only a
+    /// handful of views.  Views are allocated by the `membership_storage` and are never destroyed.
+    class member_view
+    {
+    public:
+
+        member_view(metadata::binding_flags flags, core::size_type count, member_view const* next);
+
+        auto flags() const -> metadata::binding_flags;
+        auto next()  const -> member_view const*;
+
+        auto begin() const -> std::uint32_t const*;
+        auto end()   const -> std::uint32_t const*;
+
+    private:
+
+        // Note:  This type is copied bytewise into the table allocator, so it must remain
+        // trivially copyable.
+        metadata::binding_flags _flags;
+        core::size_type         _count;
+        member_view const*      _next;
+    };
+
+    CXXREFLECT_STATIC_ASSERT(sizeof(member_view) % std::alignment_of<std::uint32_t>::value == 0);
+
+    template <member_kind MemberTag>
+    class member_view_iterator_constructor
+    {
+    public:
+
+        auto operator()(member_table_layer const* layer, std::uint32_t const* index) const ->
+            member_table_entry_facade<MemberTag> const*;
+    };
+
+    /// Generator for member view iterator types; see `member_table_iterator_generator`
+    template <member_kind MemberTag>
+    class member_view_iterator_generator
+    {
+    public:
+
+        typedef core::instantiating_iterator<
+            std::uint32_t const*,
+            member_table_entry_facade<MemberTag> const*,
+            member_table_layer const*,
+            member_view_iterator_constructor<MemberTag>
+        > type;
+
+        typedef core::iterator_range<type> range_type;
+
+        /// The type of the function that filters the entries of the table; it returns `true` if
+        /// the entry is to be excluded.  See `type::filter_method` and its siblings.
+        typedef bool (*filter_type)(metadata::binding_flags,
+                                    reflection::type const&,
+                                    member_table_entry_facade<MemberTag> const* const&);
+    };
+
+
+
+
+
     class membership_context;
 
     template <member_kind MemberTag>
@@ -447,8 +756,9 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
         friend membership_context;
 
-        core::atomic<core::const_byte_iterator> _first;
-        core::atomic<core::const_byte_iterator> _last;
+        core::atomic<member_table_layer const*> _table;
+        core::atomic<member_name_index  const*> _name_index;
+        core::atomic<member_view        const*> _views;
     };
 
     class membership_context
@@ -466,13 +776,7 @@ namespace cxxreflect { namespace reflection { namespace detail {
             fields     = (core::size_type)1 << (core::size_type)member_kind::field,
             interfaces = (core::size_type)1 << (core::size_type)member_kind::interface_,
             methods    = (core::size_type)1 << (core::size_type)member_kind::method,
-            properties = (core::size_type)1 << (core::size_type)member_kind::property,
-
-            events_are_instantiated     = (core::size_type)events     << (core::size_type)8,
-            fields_are_instantiated     = (core::size_type)fields     << (core::size_type)8,
-            interfaces_are_instantiated = (core::size_type)interfaces << (core::size_type)8,
-            methods_are_instantiated    = (core::size_type)methods    << (core::size_type)8,
-            properties_are_instantiated = (core::size_type)properties << (core::size_type)8
+            properties = (core::size_type)1 << (core::size_type)member_kind::property
         };
 
         typedef core::flags<state> state_flags;
@@ -485,20 +789,40 @@ namespace cxxreflect { namespace reflection { namespace detail {
         auto get_table() const
             -> core::optional<typename member_table_iterator_generator<MemberTag>::range_type>;
 
+        /// Gets the top layer of the table; a null layer represents an empty table
         template <member_kind MemberTag>
-        auto get_range() const
-            -> core::optional<core::const_byte_range>;
+        auto get_layer() const
+            -> core::optional<member_table_layer const*>;
 
         template <member_kind MemberTag>
-        auto set_table(core::const_byte_range table_range, bool is_instantiated)
+        auto set_table(member_table_layer const* table)
             -> typename member_table_iterator_generator<MemberTag>::range_type;
 
-        static auto primary_state_flag_for     (member_kind kind) -> state;
-        static auto instantiated_state_flag_for(member_kind kind) -> state;
+        static auto primary_state_flag_for(member_kind kind) -> state;
+
+        /// Gets the interface closure of the type, or `nullptr` if it has not yet been built
+        auto get_interface_closure() const -> interface_closure const*;
+        auto set_interface_closure(interface_closure const* closure) -> void;
+
+        /// Gets the name index of the table, or `nullptr` if it has not yet been built
+        template <member_kind MemberTag>
+        auto get_name_index() const -> member_name_index const*;
+
+        template <member_kind MemberTag>
+        auto set_name_index(member_name_index const* index) -> void;
+
+        /// Gets the newest view of the table, or `nullptr` if no views have been built
+        template <member_kind MemberTag>
+        auto get_views() const -> member_view const*;
+
+        /// Makes `view` the newest view of the table; `view` must link to the current newest view
+        template <member_kind MemberTag>
+        auto insert_view(member_view const* view) -> void;
 
     private:
 
-        core::atomic<state> _state;
+        core::atomic<state>                     _state;
+        core::atomic<interface_closure const*>  _interface_closure;
     };
 
     CXXREFLECT_GENERATE_SCOPED_ENUM_OPERATORS(membership_context::state)
@@ -520,6 +844,27 @@ namespace cxxreflect { namespace reflection { namespace detail {
         auto get_methods()    const -> method_table_range;
         auto get_properties() const -> property_table_range;
 
+        auto get_interface_closure() const -> interface_closure const&;
+
+        /// Gets the entries of a table that have the given `name`, in table order; this builds the
+        /// table and its name index if they have not yet been built.
+        auto find_events    (core::string_reference const& name) const -> event_name_range;
+        auto find_fields    (core::string_reference const& name) const -> field_name_range;
+        auto find_methods   (core::string_reference const& name) const -> method_name_range;
+        auto find_properties(core::string_reference const& name) const -> property_name_range;
+
+        /// Gets the entries of a table that are not excluded by `filter` for the given `flags`
+        ///
+        /// The view is built and cached the first time it is requested for a set of flags, so the
+        /// `filter` must depend only on the flags, the entry, and the identity of the reflected
+        /// type (every type that shares this membership is the same type), and the same `filter`
+        /// must be used for every request for a kind of member.
+        template <member_kind MemberTag>
+        auto get_view(metadata::binding_flags                                           flags,
+                      reflection::type                                           const& reflected_type,
+                      typename member_view_iterator_generator<MemberTag>::filter_type filter) const
+            -> typename member_view_iterator_generator<MemberTag>::range_type;
+
         auto context(core::internal_key) const -> membership_context&;
 
         auto is_initialized() const -> bool;
@@ -529,6 +874,10 @@ namespace cxxreflect { namespace reflection { namespace detail {
         template <member_kind MemberTag>
         auto get_table() const -> typename member_table_iterator_generator<MemberTag>::range_type;
 
+        template <member_kind MemberTag>
+        auto find_by_name(core::string_reference const& name) const
+            -> typename member_name_iterator_generator<MemberTag>::range_type;
+
         core::checked_pointer<membership_storage> mutable _storage;
         core::checked_pointer<membership_context> mutable _context;
     };
@@ -537,39 +886,166 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
 
 
+    /// Reports the number of member tables owned by a `membership_storage` and the memory they use
+    class membership_statistics
+    {
+    public:
+
+        membership_statistics();
+        membership_statistics(core::size_type layer_count,
+                              core::size_type entry_count,
+                              core::size_type table_bytes,
+                              core::size_type signature_bytes);
+
+        auto layer_count()     const -> core::size_type;
+        auto entry_count()     const -> core::size_type;
+        auto table_bytes()     const -> core::size_type;
+        auto signature_bytes() const -> core::size_type;
+
+    private:
+
+        core::value_initialized<core::size_type> _layer_count;
+        core::value_initialized<core::size_type> _entry_count;
+        core::value_initialized<core::size_type> _table_bytes;
+        core::value_initialized<core::size_type> _signature_bytes;
+    };
+
+
+
+
+
+    /// Owns the membership contexts and member tables for all of the types in a loader
+    ///
+    /// A signature is first looked up by the identity of its blob, so a repeated lookup neither
+    /// resolves nor hashes the signature.  When a blob is first seen, its membership context is
+    /// found by canonical type id, so structurally equal signatures (e.g., the same generic
+    /// instantiation referenced from two modules) share one membership context and one set of
+    /// tables.  See `canonical_type_storage`.  Canonicalizing a signature resolves the types that
+    /// it references; if that fails (e.g. because the assembly that defines a generic argument
+    /// cannot be found), the members of the type can still be enumerated, so the blob gets its own
+    /// membership context instead.  Type definitions are always keyed by canonical type id, which
+    /// is computed without resolution.
+    ///
+    /// Both indices are `concurrent_index`es, so lookups do not take a lock and the indices grow
+    /// with the number of types whose members are used.  Nodes are fully constructed before they
+    /// are inserted into an index and are never removed.  If a lock-free lookup misses, the index
+    /// searches again under its lock before inserting.
+    ///
+    /// Each node also has a construction latch.  Tables are built with the latch for their type
+    /// held, so two threads cannot build tables for the same type concurrently, but building the
+    /// tables for one type does not block readers or builders of unrelated types.  The latch is
+    /// recursive because building one kind of table for a type may require another kind of table
+    /// for the same type (e.g., the property table requires the method table).  Table builders
+    /// only ever acquire the latches of a type's base types and interfaces while holding its latch,
+    /// so latches are always acquired in hierarchy order.
     class membership_storage
     {
     public:
 
         typedef core::linear_array_allocator<core::byte, (1 << 16)> allocator_type;
         typedef metadata::type_def_or_signature                     key_type;
-        typedef std::map<key_type, membership_context>              index_type;
 
         membership_storage();
+        ~membership_storage();
 
         auto get_membership(key_type const& key) -> membership_handle;
 
         auto allocate_signature(core::const_byte_range transient_range, core::internal_key) -> core::const_byte_range;
         auto allocate_table    (core::const_byte_range transient_range, core::internal_key) -> core::const_byte_range;
 
+        /// Copies `transient_layer` and its packed `entries` into the table allocator
+        ///
+        /// The indices and instantiations to which the layer refers must already have been
+        /// allocated by `allocate_table`.
+        auto allocate_layer(member_table_layer const& transient_layer,
+                            core::const_byte_range    entries,
+                            core::internal_key) -> member_table_layer const*;
+
+        auto statistics() const -> membership_statistics;
+
         template <member_kind MemberTag>
         auto create_table(membership_context& context, core::internal_key) -> void;
 
+        /// Builds the interface closure of the type whose membership is `context`; this builds the
+        /// interface table of the type if it has not yet been built.
+        auto create_interface_closure(membership_context& context, core::internal_key) -> void;
+
+        /// Builds the name index of the `MemberTag` table of the type whose membership is `context`;
+        /// this builds the table if it has not yet been built.
+        template <member_kind MemberTag>
+        auto create_name_index(membership_context& context, core::internal_key) -> void;
+
+        /// Allocates a view of the `MemberTag` table of the type whose membership is `context` that
+        /// contains the entries at `indices`, unless a view for `flags` already exists, and returns
+        /// the view for `flags`.
+        template <member_kind MemberTag>
+        auto create_view(membership_context                & context,
+                         metadata::binding_flags              flags,
+                         std::vector<std::uint32_t>    const& indices,
+                         core::internal_key) -> member_view const*;
+
+        /// Acquires the construction latch for the type whose membership is `context`
+        ///
+        /// The `context` must have been obtained from this storage object.  The latch must be held
+        /// while the tables of the type are built.
+        auto lock_construction(membership_context& context, core::internal_key) -> core::recursive_mutex_lock;
+
     private:
 
+        class index_node
+        {
+        public:
+
+            explicit index_node(key_type const& key);
+
+            key_type                  const _key;
+            membership_context              _context;
+            core::recursive_mutex           _latch;
+
+        private:
+
+            index_node(index_node const&);
+            auto operator=(index_node const&) -> index_node&;
+        };
+
+        /// Hashes a canonical type id; ids are dense, so consecutive ids map to consecutive buckets
+        class id_hash
+        {
+        public:
+
+            auto operator()(canonical_type_id const& id) const -> core::size_type;
+        };
+
+        typedef concurrent_index<canonical_type_id,         index_node*, id_hash>               node_index;
+        typedef concurrent_index<core::const_byte_iterator, index_node*, metadata_pointer_hash> identity_index;
+        typedef std::vector<std::unique_ptr<index_node>>                                        node_sequence;
+
         membership_storage(membership_storage const&);
         auto operator=(membership_storage const&) -> membership_storage&;
 
+        /// Gets the node for canonical type id `id`, creating it for `key` if there is none
+        auto get_node(canonical_type_id id, key_type const& key) -> index_node*;
+
         static auto allocate_range(allocator_type& allocator, core::const_byte_range transient_range) -> core::const_byte_range;
 
-        static auto key_from_context(membership_context& key) -> key_type const&;
+        static auto node_from_context(membership_context& context) -> index_node&;
 
-        core::recursive_mutex _sync;
-        index_type            _index;
+        node_index            _index;            // Finds nodes by canonical type id
+        node_sequence         _nodes;            // Owns the nodes in _index; modified under its lock
+        identity_index        _identity_index;   // Finds nodes by the identity of a signature blob
+        node_sequence         _identity_nodes;   // Owns the nodes of blobs without a canonical type id;
+                                                 // modified under the lock of _identity_index
 
         // Note:  We use two allocators to ensure that table allocations are correctly aligned.
-        allocator_type        _signature_allocator;
-        allocator_type        _table_allocator;
+        core::recursive_mutex mutable _allocator_sync;
+        allocator_type                _signature_allocator;
+        allocator_type                _table_allocator;
+
+        // Statistics, updated under the allocator lock:
+        core::size_type               _layer_count;
+        core::size_type               _entry_count;
+        core::size_type               _table_bytes;
+        core::size_type               _signature_bytes;
     };
 
 } } }
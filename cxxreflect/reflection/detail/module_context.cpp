@@ -4,6 +4,7 @@
 //     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
 
 #include "cxxreflect/reflection/precompiled_headers.hpp"
+#include "cxxreflect/reflection/detail/assembly_context.hpp"
 #include "cxxreflect/reflection/detail/loader_context.hpp"
 #include "cxxreflect/reflection/detail/module_context.hpp"
 #include "cxxreflect/reflection/module.hpp"
@@ -12,6 +13,46 @@
 
 
 
+namespace cxxreflect { namespace reflection { namespace detail { namespace {
+
+    /// Calls `resolve` for each reference in the `Token` table of `scope`, returning the number of
+    /// references that could not be resolved.  Resolution failures are reported via `runtime_error`
+    /// (e.g. when an assembly cannot be located) or `metadata_error`; these are counted rather than
+    /// propagated.  An `assertion_error` indicates a bug or an unimplemented reference form in the
+    /// loader, so it is propagated to the caller.
+    template <typename Token, typename Resolver>
+    auto preresolve_references(metadata::database const& scope, bool const parallel, Resolver const resolve)
+        -> core::size_type
+    {
+        metadata::table_id const table(metadata::table_id_for_mask<Token::mask>::value);
+
+        core::size_type       unresolved_count(0);
+        core::recursive_mutex unresolved_count_sync;
+
+        core::for_each_partition(scope.tables()[table].row_count(), [&](core::size_type const first, core::size_type const last)
+        {
+            core::size_type partition_unresolved_count(0);
+            for (core::size_type i(first); i != last; ++i)
+            {
+                try
+                {
+                    resolve(Token(&scope, table, i));
+                }
+                catch (core::runtime_error const&)
+                {
+                    ++partition_unresolved_count;
+                }
+            }
+
+            auto const lock(unresolved_count_sync.lock());
+            unresolved_count += partition_unresolved_count;
+        }, parallel);
+
+        return unresolved_count;
+    }
+
+} } } }
+
 namespace cxxreflect { namespace reflection { namespace detail {
 
     auto module_type_def_index_iterator_constructor::operator()(metadata::database const*                    const scope,
@@ -126,16 +167,159 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
 
 
+    auto module_method_semantics_index_iterator_constructor::operator()(metadata::database                    const* const scope,
+                                                                        std::vector<core::size_type>::const_iterator const it) const
+        -> metadata::method_def_token
+    {
+        return metadata::method_def_token(scope, *it);
+    }
+
+    module_method_semantics_index::module_method_semantics_index(metadata::database const* const scope)
+        : _scope(scope),
+          _properties(scope->tables()[metadata::table_id::property  ].row_count()),
+          _events    (scope->tables()[metadata::table_id::event     ].row_count()),
+          _methods   (scope->tables()[metadata::table_id::method_def].row_count())
+    {
+        core::assert_not_null(scope);
+
+        // The MethodSemantics table is sorted by owner, so the rows of each owner are contiguous
+        // and the other accessors of each owner form a contiguous range of _other_accessors:
+        core::for_all(scope->table<metadata::table_id::method_semantics>(), [&](metadata::method_semantics_row const& r)
+        {
+            metadata::has_semantics_token    const owner(r.parent());
+            metadata::method_def_token       const accessor(r.method());
+            metadata::method_semantics_flags const semantics(r.semantics());
+
+            owner_entry& entry(owner.table() == metadata::table_id::property
+                ? _properties[owner.index()]
+                : _events[owner.index()]);
+
+            if (semantics.is_set(metadata::method_semantics_attribute::other))
+            {
+                if (entry.first_other == entry.last_other)
+                    entry.first_other = _other_accessors.size();
+
+                _other_accessors.push_back(accessor.value());
+                entry.last_other = _other_accessors.size();
+            }
+            else
+            {
+                // A row with semantics we do not recognize does not make its method an accessor;
+                // we skip it rather than rejecting the whole module:
+                owner_entry::slot const slot_index(compute_slot(semantics.enumerator()));
+                if (slot_index == owner_entry::slot_count)
+                    return;
+
+                core::size_type& slot(entry.accessors[slot_index]);
+                if (slot == 0)
+                    slot = accessor.value();
+            }
+
+            accessor_entry& method(_methods[accessor.index()]);
+            if (method.first == 0)
+                method = accessor_entry(owner.value(), semantics);
+        });
+    }
+
+    auto module_method_semantics_index::find_accessor(metadata::has_semantics_token        const& owner,
+                                                      metadata::method_semantics_attribute const  semantics) const
+        -> metadata::method_def_token
+    {
+        owner_entry::slot const slot_index(compute_slot(semantics));
+        if (slot_index == owner_entry::slot_count)
+            return metadata::method_def_token();
+
+        core::size_type const accessor(get_owner_entry(owner).accessors[slot_index]);
+        return accessor != 0 ? metadata::method_def_token(_scope.get(), accessor) : metadata::method_def_token();
+    }
+
+    auto module_method_semantics_index::find_other_accessors(metadata::has_semantics_token const& owner) const -> method_range
+    {
+        owner_entry const& entry(get_owner_entry(owner));
+
+        return method_range(
+            method_iterator(_scope.get(), _other_accessors.begin() + entry.first_other),
+            method_iterator(_scope.get(), _other_accessors.begin() + entry.last_other));
+    }
+
+    auto module_method_semantics_index::find_owner(metadata::method_def_token const& accessor) const
+        -> metadata::has_semantics_token
+    {
+        core::assert_initialized(accessor);
+        core::assert_true([&]{ return accessor.scope() == *_scope; });
+
+        core::size_type const owner(_methods[accessor.index()].first);
+        return owner != 0 ? metadata::has_semantics_token(_scope.get(), owner) : metadata::has_semantics_token();
+    }
+
+    auto module_method_semantics_index::find_semantics(metadata::method_def_token const& accessor) const
+        -> metadata::method_semantics_flags
+    {
+        core::assert_initialized(accessor);
+        core::assert_true([&]{ return accessor.scope() == *_scope; });
+
+        return _methods[accessor.index()].second;
+    }
+
+    auto module_method_semantics_index::compute_slot(metadata::method_semantics_attribute const semantics)
+        -> owner_entry::slot
+    {
+        switch (semantics)
+        {
+        case metadata::method_semantics_attribute::getter:
+        case metadata::method_semantics_attribute::add_on:
+            return owner_entry::primary_slot;
+
+        case metadata::method_semantics_attribute::setter:
+        case metadata::method_semantics_attribute::remove_on:
+            return owner_entry::secondary_slot;
+
+        case metadata::method_semantics_attribute::fire:
+            return owner_entry::raiser_slot;
+
+        default:
+            return owner_entry::slot_count;
+        }
+    }
+
+    auto module_method_semantics_index::get_owner_entry(metadata::has_semantics_token const& owner) const
+        -> owner_entry const&
+    {
+        core::assert_initialized(owner);
+        core::assert_true([&]{ return owner.scope() == *_scope; });
+
+        return owner.table() == metadata::table_id::property
+            ? _properties[owner.index()]
+            : _events[owner.index()];
+    }
+
+
+
+
+
     module_context::module_context(assembly_context const* assembly, module_location const& location)
         : _assembly(assembly),
           _location(location),
           _database(create_database(location)),
+          _canonical_id_base(assembly->loader().reserve_canonical_type_ids(
+              _database.tables()[metadata::table_id::type_def].row_count())),
 
           _type_def_index    (&_database),
           _assembly_ref_cache(&_database),
           _module_ref_cache  (&_database),
           _type_ref_cache    (&_database),
-          _member_ref_cache  (&_database)
+          _member_ref_cache  (&_database),
+
+          _ancestry_cache              (&_database),
+          _parameter_table_cache       (&_database),
+          _enum_value_table_cache      (&_database),
+          _attribute_layout_cache      (&_database),
+          _attribute_constructor_cache (&_database),
+          _method_semantics_index_cache(&_database),
+          _classifications(core::make_unique_array<atomic_classification>(
+              _database.tables()[metadata::table_id::type_def].row_count())),
+          _interface_ids(core::make_unique_array<atomic_interface_id>(
+              _database.tables()[metadata::table_id::type_def].row_count()))
     {
         core::assert_not_null(assembly);
         core::assert_initialized(_location);
@@ -182,6 +366,155 @@ namespace cxxreflect { namespace reflection { namespace detail {
         return _member_ref_cache;
     }
 
+    auto module_context::method_semantics_index() const -> module_method_semantics_index const&
+    {
+        // Building the index only reads this module's database, so it is built under the lock;
+        // that way, concurrent first uses do not each sweep the MethodSemantics table:
+        metadata::module_token const module(&_database, metadata::table_id::module, 0);
+        return _method_semantics_index_cache.get(module, [&]
+        {
+            return core::make_unique<module_method_semantics_index>(&_database);
+        });
+    }
+
+    auto module_context::ancestry(metadata::type_def_token const& type) const -> type_def_ancestry const&
+    {
+        core::assert_initialized(type);
+        core::assert_true([&]{ return type.scope() == _database; });
+
+        // Building the ancestry resolves base types, which may require other assemblies to be
+        // loaded, so it is built before the lock is acquired:
+        return _ancestry_cache.get(type, [&]
+        {
+            return core::make_unique<type_def_ancestry>(type);
+        });
+    }
+
+    auto module_context::parameter_table(metadata::method_def_token const& method) const -> method_parameter_table const&
+    {
+        core::assert_initialized(method);
+        core::assert_true([&]{ return method.scope() == _database; });
+
+        // Building the table only reads this module's database, so it is built under the lock:
+        return _parameter_table_cache.get(method, [&]
+        {
+            return core::make_unique<method_parameter_table>(method);
+        });
+    }
+
+    auto module_context::enum_values(metadata::type_def_token const& enumeration) const -> enum_value_table const&
+    {
+        core::assert_initialized(enumeration);
+        core::assert_true([&]{ return enumeration.scope() == _database; });
+
+        // Building the table only reads this module's database, so it is built under the lock:
+        return _enum_value_table_cache.get(enumeration, [&]
+        {
+            return core::make_unique<enum_value_table>(enumeration);
+        });
+    }
+
+    auto module_context::attribute_layout(metadata::custom_attribute_token const& attribute) const
+        -> custom_attribute_layout const&
+    {
+        core::assert_initialized(attribute);
+        core::assert_true([&]{ return attribute.scope() == _database; });
+
+        // Decoding the layout may resolve enumeration types in other assemblies, so it is decoded
+        // before the lock is acquired:
+        return _attribute_layout_cache.get(attribute, [&]
+        {
+            return core::make_unique<custom_attribute_layout>(attribute);
+        });
+    }
+
+    auto module_context::attribute_constructor(metadata::custom_attribute_token const& attribute) const
+        -> custom_attribute_constructor const&
+    {
+        core::assert_initialized(attribute);
+        core::assert_true([&]{ return attribute.scope() == _database; });
+
+        // Resolving the constructor builds the member table of the attribute type, which may load
+        // other assemblies, so it is resolved before the lock is acquired:
+        return _attribute_constructor_cache.get(attribute, [&]
+        {
+            return core::make_unique<custom_attribute_constructor>(attribute);
+        });
+    }
+
+    auto module_context::classification(metadata::type_def_token const& type, bool const resolve_base_types) const
+        -> type_def_classification
+    {
+        core::assert_initialized(type);
+        core::assert_true([&]{ return type.scope() == _database; });
+
+        atomic_classification& cached_result(_classifications[type.index()]);
+
+        type_def_classification const cached_classification((type_def_classification::attribute_flags(cached_result.load())));
+        if (resolve_base_types ? cached_classification.is_base_types_initialized() : cached_classification.is_initialized())
+            return cached_classification;
+
+        // The classification of a type never changes, so if two threads race to compute it, it does
+        // not matter which of them stores it.  At worst, a thread that did not resolve base types
+        // overwrites a word that has base type classifications, which are then computed again.
+        type_def_classification const new_classification(type_def_classification::compute(type, resolve_base_types));
+        cached_result.store(new_classification.flags().enumerator());
+        return new_classification;
+    }
+
+    auto module_context::interface_id(metadata::type_def_token const& type) const -> core::size_type
+    {
+        core::assert_initialized(type);
+        core::assert_true([&]{ return type.scope() == _database; });
+
+        atomic_interface_id& cached_id(_interface_ids[type.index()]);
+
+        core::size_type const existing_id(cached_id.load());
+        if (existing_id != 0)
+            return existing_id - 1;
+
+        // Unlike a classification, an id must be allocated only once, so we allocate under the
+        // lock and check again in case another thread allocated an id while we were waiting:
+        auto const lock(_interface_id_sync.lock());
+
+        core::size_type const locked_existing_id(cached_id.load());
+        if (locked_existing_id != 0)
+            return locked_existing_id - 1;
+
+        core::size_type const new_id(loader_context::from(_database).allocate_interface_id());
+        cached_id.store(new_id + 1);
+        return new_id;
+    }
+
+    auto module_context::canonical_id(metadata::type_def_token const& type) const -> canonical_type_id
+    {
+        core::assert_initialized(type);
+        core::assert_true([&]{ return type.scope() == _database; });
+
+        return canonical_type_id(_canonical_id_base + type.index());
+    }
+
+    auto module_context::preresolve(bool const parallel) const -> module_preresolution_result
+    {
+        loader_context const& loader(loader_context::from(_database));
+
+        // Member reference resolution resolves the parent type reference of each member, so we
+        // resolve all of the type references first to avoid contending on them in the second pass:
+        core::size_type const unresolved_type_ref_count(preresolve_references<metadata::type_ref_token>(
+            _database, parallel,
+            [&](metadata::type_ref_token const& t) { loader.resolve_type_ref(t); }));
+
+        core::size_type const unresolved_member_ref_count(preresolve_references<metadata::member_ref_token>(
+            _database, parallel,
+            [&](metadata::member_ref_token const& t) { loader.resolve_member_ref(t); }));
+
+        return module_preresolution_result(
+            _database.tables()[metadata::table_id::type_ref].row_count(),
+            unresolved_type_ref_count,
+            _database.tables()[metadata::table_id::member_ref].row_count(),
+            unresolved_member_ref_count);
+    }
+
     auto module_context::from(metadata::database const& scope) -> module_context const&
     {
         module_context const* const owner(dynamic_cast<module_context const*>(&scope.owner()));
@@ -6,7 +6,12 @@
 #ifndef CXXREFLECT_REFLECTION_DETAIL_MODULE_CONTEXT_HPP_
 #define CXXREFLECT_REFLECTION_DETAIL_MODULE_CONTEXT_HPP_
 
+#include "cxxreflect/reflection/detail/canonical_type.hpp"
+#include "cxxreflect/reflection/detail/custom_attribute_decoder.hpp"
 #include "cxxreflect/reflection/detail/forward_declarations.hpp"
+#include "cxxreflect/reflection/detail/parameter_data.hpp"
+#include "cxxreflect/reflection/detail/type_hierarchy.hpp"
+#include "cxxreflect/reflection/enum_value_table.hpp"
 #include "cxxreflect/reflection/module_locator.hpp"
 
 
@@ -98,6 +103,104 @@ namespace cxxreflect { namespace reflection { namespace detail {
         index_type                                      _index;
     };
 
+
+
+
+
+    class module_method_semantics_index_iterator_constructor
+    {
+    public:
+
+        auto operator()(metadata::database const* const scope, std::vector<core::size_type>::const_iterator const it) const
+            -> metadata::method_def_token;
+    };
+
+
+
+
+
+    /// An index that maps properties and events to their accessors, and accessors to their owners
+    ///
+    /// The MethodSemantics table is sorted by owner, so finding the accessor of a property or event
+    /// with particular semantics requires a binary search and a scan of the owner's rows, and
+    /// finding the owner of an accessor requires a scan of the entire table.  This index is built
+    /// in a single pass over the MethodSemantics table and stores, for each property and event in
+    /// the module, its getter/adder, setter/remover, and raiser, and for each method that is an
+    /// accessor, its owner and semantics.  All lookups are constant time.  The index is built
+    /// lazily, once per module; see `module_context::method_semantics_index()`.
+    class module_method_semantics_index
+    {
+    public:
+
+        typedef core::instantiating_iterator<
+            std::vector<core::size_type>::const_iterator,
+            metadata::method_def_token,
+            metadata::database const*,
+            module_method_semantics_index_iterator_constructor
+        > method_iterator;
+
+        typedef core::iterator_range<method_iterator> method_range;
+
+        /// Builds the index for the module whose database is `scope`; this has N time complexity,
+        /// where N is the number of rows in the MethodSemantics table.
+        explicit module_method_semantics_index(metadata::database const* scope);
+
+        /// Finds the accessor of `owner` with `semantics`, which should be `getter`, `setter`,
+        /// `add_on`, `remove_on`, or `fire`; returns a null token if `owner` has no such accessor.
+        /// MethodSemantics rows with any other single semantics value are ignored by the index.
+        auto find_accessor(metadata::has_semantics_token const& owner,
+                           metadata::method_semantics_attribute semantics) const -> metadata::method_def_token;
+
+        /// Finds the accessors of `owner` with `other` semantics, in MethodSemantics table order
+        auto find_other_accessors(metadata::has_semantics_token const& owner) const -> method_range;
+
+        /// Finds the property or event that owns `accessor`; returns a null token if `accessor` is
+        /// not an accessor.  If a method is an accessor of more than one owner (which is legal but
+        /// unusual), the first owner in MethodSemantics table order is returned.
+        auto find_owner(metadata::method_def_token const& accessor) const -> metadata::has_semantics_token;
+
+        /// Gets the semantics of `accessor` with respect to its owner (see `find_owner()`), or an
+        /// empty set of flags if `accessor` is not an accessor
+        auto find_semantics(metadata::method_def_token const& accessor) const -> metadata::method_semantics_flags;
+
+    private:
+
+        module_method_semantics_index(module_method_semantics_index const&);
+        auto operator=(module_method_semantics_index const&) -> module_method_semantics_index&;
+
+        /// The accessors of a single property or event.  The token values of the getter or adder,
+        /// the setter or remover, and the raiser are stored by slot; a value of zero indicates that
+        /// there is no accessor in the slot.  Other accessors are the [first_other, last_other)
+        /// range of `_other_accessors`.
+        struct owner_entry
+        {
+            enum slot { primary_slot, secondary_slot, raiser_slot, slot_count };
+
+            core::size_type accessors[slot_count];
+            core::size_type first_other;
+            core::size_type last_other;
+        };
+
+        /// The owner of a single method and the semantics of the method with respect to the owner;
+        /// an owner value of zero indicates that the method is not an accessor.
+        typedef std::pair<core::size_type, metadata::method_semantics_flags> accessor_entry;
+
+        /// Gets the slot for an accessor with `semantics`, or `slot_count` if there is none
+        static auto compute_slot(metadata::method_semantics_attribute semantics) -> owner_entry::slot;
+
+        auto get_owner_entry(metadata::has_semantics_token const& owner) const -> owner_entry const&;
+
+        core::checked_pointer<metadata::database const> _scope;
+        std::vector<owner_entry>                        _properties;
+        std::vector<owner_entry>                        _events;
+        std::vector<core::size_type>                    _other_accessors;
+        std::vector<accessor_entry>                     _methods;
+    };
+
+
+
+
+
     template <typename T>
     class initializable_pointer
     {
@@ -275,6 +378,126 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
 
 
+    /// Selects how a `module_lazy_cache` builds a value that is not yet cached
+    enum class lazy_build_policy
+    {
+        /// Building the value only reads the module's database, so the value is built under the
+        /// cache lock; that way, concurrent first uses do not each build the value.
+        build_under_lock,
+
+        /// Building the value may resolve types in other modules, which may require assemblies to
+        /// be loaded, so the value is built before the cache lock is acquired.  If another thread
+        /// publishes a value for the key first, the value that we built is discarded.
+        build_then_publish
+    };
+
+    /// A per-token cache of values that are built on first use and owned by the cache
+    ///
+    /// A lookup of a cached value does not take a lock.  A missing value is built by the `build`
+    /// function passed to `get`, which returns a `std::unique_ptr<Value>`, in the manner selected by
+    /// the `Policy`.  In either case, the cache is checked again under the lock before a value is
+    /// published, so exactly one value is ever published for each key.
+    template <typename Key, typename Value, lazy_build_policy Policy>
+    class module_lazy_cache
+    {
+    public:
+
+        typedef Key   key_type;
+        typedef Value value_type;
+
+        explicit module_lazy_cache(metadata::database const* const scope)
+            : _cache(scope)
+        {
+        }
+
+        template <typename Build>
+        auto get(key_type const& key, Build build) const -> value_type const&
+        {
+            value_type const* const cached_result(_cache.get(key));
+            if (cached_result != nullptr)
+                return *cached_result;
+
+            return Policy == lazy_build_policy::build_under_lock
+                ? build_under_lock(key, build)
+                : build_then_publish(key, build);
+        }
+
+    private:
+
+        typedef std::unique_ptr<value_type> unique_value;
+
+        module_lazy_cache(module_lazy_cache const&);
+        auto operator=(module_lazy_cache const&) -> module_lazy_cache&;
+
+        template <typename Build>
+        auto build_under_lock(key_type const& key, Build build) const -> value_type const&
+        {
+            auto const lock(_sync.lock());
+
+            value_type const* const locked_cached_result(_cache.get(key));
+            if (locked_cached_result != nullptr)
+                return *locked_cached_result;
+
+            return publish(key, build());
+        }
+
+        template <typename Build>
+        auto build_then_publish(key_type const& key, Build build) const -> value_type const&
+        {
+            unique_value new_value(build());
+
+            auto const lock(_sync.lock());
+
+            value_type const* const locked_cached_result(_cache.get(key));
+            if (locked_cached_result != nullptr)
+                return *locked_cached_result;
+
+            return publish(key, std::move(new_value));
+        }
+
+        /// Takes ownership of `new_value` and caches it for `key`; the caller must hold the lock
+        auto publish(key_type const& key, unique_value new_value) const -> value_type const&
+        {
+            _values.push_back(std::move(new_value));
+            _cache.set(key, _values.back().get());
+            return *_values.back();
+        }
+
+        module_resolution_cache<key_type, value_type const*> mutable _cache;
+        std::vector<unique_value>                            mutable _values;
+        core::recursive_mutex                                mutable _sync;
+    };
+
+    typedef module_lazy_cache<
+        metadata::type_def_token, type_def_ancestry, lazy_build_policy::build_then_publish
+    > module_ancestry_cache;
+
+    typedef module_lazy_cache<
+        metadata::method_def_token, method_parameter_table, lazy_build_policy::build_under_lock
+    > module_parameter_table_cache;
+
+    typedef module_lazy_cache<
+        metadata::type_def_token, enum_value_table, lazy_build_policy::build_under_lock
+    > module_enum_value_table_cache;
+
+    typedef module_lazy_cache<
+        metadata::custom_attribute_token, custom_attribute_layout, lazy_build_policy::build_then_publish
+    > module_attribute_layout_cache;
+
+    typedef module_lazy_cache<
+        metadata::custom_attribute_token, custom_attribute_constructor, lazy_build_policy::build_then_publish
+    > module_attribute_constructor_cache;
+
+    // The method semantics index is built once per module, so it is keyed by the module's only
+    // Module row:
+    typedef module_lazy_cache<
+        metadata::module_token, module_method_semantics_index, lazy_build_policy::build_under_lock
+    > module_method_semantics_index_cache;
+
+
+
+
+
     /// Represents a module, a single metadata file
     ///
     /// A module consists of a single metadata file, along with related meta-information.  Each
@@ -297,6 +520,49 @@ namespace cxxreflect { namespace reflection { namespace detail {
         auto module_ref_cache()   const -> module_module_ref_cache  &;
         auto type_ref_cache()     const -> module_type_ref_cache    &;
         auto member_ref_cache()   const -> module_member_ref_cache  &;
+
+        /// Gets the ancestry of `type`, building it if it has not yet been built.  The `type` must
+        /// be a type defined in this module.
+        auto ancestry(metadata::type_def_token const& type) const -> type_def_ancestry const&;
+
+        /// Gets the parameter descriptors of `method`, building them if they have not yet been
+        /// built.  The `method` must be a method defined in this module.
+        auto parameter_table(metadata::method_def_token const& method) const -> method_parameter_table const&;
+
+        /// Gets the named values of `enumeration`, building the table if it has not yet been built.
+        /// The `enumeration` must be an enumeration defined in this module.
+        auto enum_values(metadata::type_def_token const& enumeration) const -> enum_value_table const&;
+
+        /// Gets the layout of the arguments of `attribute`, decoding it if it has not yet been
+        /// decoded.  The `attribute` must be a custom attribute defined in this module.
+        auto attribute_layout(metadata::custom_attribute_token const& attribute) const -> custom_attribute_layout const&;
+
+        /// Gets the method semantics index for this module, building it if it has not yet been built
+        auto method_semantics_index() const -> module_method_semantics_index const&;
+
+        /// Gets the resolved constructor of `attribute`, resolving it if it has not yet been
+        /// resolved.  The `attribute` must be a custom attribute defined in this module.
+        auto attribute_constructor(metadata::custom_attribute_token const& attribute) const
+            -> custom_attribute_constructor const&;
+
+        /// Gets the classification of `type`, computing it if it has not yet been computed.  The
+        /// `type` must be a type defined in this module.  See `type_def_classification`.
+        auto classification(metadata::type_def_token const& type, bool resolve_base_types) const
+            -> type_def_classification;
+
+        /// Gets the dense interface id of `type`, allocating one from the loader if `type` does not
+        /// yet have one.  The `type` must be an interface defined in this module.  Ids are unique
+        /// within a loader; see `interface_closure`.
+        auto interface_id(metadata::type_def_token const& type) const -> core::size_type;
+
+        /// Gets the canonical id of `type`, which must be a type defined in this module.  The ids of
+        /// the types defined in a module are reserved when the module is loaded; see
+        /// `canonical_type_storage`.
+        auto canonical_id(metadata::type_def_token const& type) const -> canonical_type_id;
+
+        /// Resolves every type reference and member reference in the module, populating the type
+        /// reference and member reference caches.  See `module::preresolve()`.
+        auto preresolve(bool parallel) const -> module_preresolution_result;
         
         static auto from(metadata::database const& scope) -> module_context const&;
 
@@ -314,12 +580,30 @@ namespace cxxreflect { namespace reflection { namespace detail {
         core::checked_pointer<assembly_context const> _assembly;
         module_location                               _location;
         metadata::database                            _database;
+        core::size_type                               _canonical_id_base;
 
         module_type_def_index                         _type_def_index;
         module_assembly_ref_cache             mutable _assembly_ref_cache;
         module_module_ref_cache               mutable _module_ref_cache;
         module_type_ref_cache                 mutable _type_ref_cache;
         module_member_ref_cache               mutable _member_ref_cache;
+
+        module_ancestry_cache                         _ancestry_cache;
+        module_parameter_table_cache                  _parameter_table_cache;
+        module_enum_value_table_cache                 _enum_value_table_cache;
+        module_attribute_layout_cache                 _attribute_layout_cache;
+        module_attribute_constructor_cache            _attribute_constructor_cache;
+        module_method_semantics_index_cache           _method_semantics_index_cache;
+
+        typedef core::atomic<type_def_classification::attribute> atomic_classification;
+
+        std::unique_ptr<atomic_classification[]>      _classifications;
+
+        typedef core::atomic<core::size_type> atomic_interface_id;
+
+        // Interface ids are stored biased by one so that zero can represent "no id":
+        std::unique_ptr<atomic_interface_id[]>        _interface_ids;
+        core::recursive_mutex                 mutable _interface_id_sync;
     };
 
 } } }
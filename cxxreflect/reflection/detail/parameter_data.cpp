@@ -9,23 +9,145 @@
 
 namespace cxxreflect { namespace reflection { namespace detail {
 
+    method_parameter_descriptor::method_parameter_descriptor()
+    {
+    }
+
+    method_parameter_descriptor::method_parameter_descriptor(core::size_type const sequence,
+                                                             core::size_type const signature_offset)
+        : _sequence(sequence), _signature_offset(signature_offset)
+    {
+    }
+
+    auto method_parameter_descriptor::sequence() const -> core::size_type
+    {
+        return _sequence.get();
+    }
+
+    auto method_parameter_descriptor::signature_offset() const -> core::size_type
+    {
+        return _signature_offset.get();
+    }
+
+    auto method_parameter_descriptor::token() const -> metadata::param_token const&
+    {
+        return _token;
+    }
+
+    auto method_parameter_descriptor::flags() const -> metadata::parameter_flags
+    {
+        return _flags;
+    }
+
+    auto method_parameter_descriptor::has_default() const -> bool
+    {
+        return _flags.is_set(metadata::parameter_attribute::has_default);
+    }
+
+    auto method_parameter_descriptor::attach(metadata::param_row const& row) -> void
+    {
+        core::assert_initialized(row);
+        core::assert_true([&]{ return row.sequence() == _sequence.get(); });
+
+        _token = row.token();
+        _flags = row.flags();
+    }
+
+
+
+
+
+    method_parameter_table::method_parameter_table(metadata::method_def_token const& method)
+    {
+        core::assert_initialized(method);
+
+        metadata::method_def_row   const method_row(row_from(method));
+        metadata::method_signature const signature(method_row.signature().as<metadata::method_signature>());
+
+        // First, compute the position of each parameter in the signature.  Every parameter has a
+        // descriptor, whether or not it has a Param row:
+        _return_parameter = method_parameter_descriptor(0, core::distance(
+            signature.begin_bytes(),
+            signature.return_type().begin_bytes()));
+
+        _parameters.reserve(signature.parameter_count());
+        core::for_all(signature.parameters(), [&](metadata::type_signature const& parameter)
+        {
+            _parameters.push_back(method_parameter_descriptor(
+                _parameters.size() + 1,
+                core::distance(signature.begin_bytes(), parameter.begin_bytes())));
+        });
+
+        // Then, attach each Param row to the parameter it describes.  Param rows are ordered by
+        // sequence but may be sparse; a row whose sequence is out of range is invalid and ignored:
+        typedef metadata::token_with_arithmetic<metadata::param_token>::type incrementable_param_token;
+
+        incrementable_param_token const last_parameter(method_row.last_parameter());
+        for (incrementable_param_token it(method_row.first_parameter()); it != last_parameter; ++it)
+        {
+            metadata::param_row const row(row_from(it));
+
+            core::size_type const sequence(row.sequence());
+            if (sequence == 0)
+            {
+                _return_parameter.attach(row);
+            }
+            else if (sequence <= _parameters.size())
+            {
+                _parameters[sequence - 1].attach(row);
+            }
+        }
+    }
+
+    auto method_parameter_table::parameter_count() const -> core::size_type
+    {
+        return _parameters.size();
+    }
+
+    auto method_parameter_table::begin() const -> method_parameter_descriptor const*
+    {
+        return _parameters.data();
+    }
+
+    auto method_parameter_table::end() const -> method_parameter_descriptor const*
+    {
+        return _parameters.data() + _parameters.size();
+    }
+
+    auto method_parameter_table::parameter(core::size_type const position) const -> method_parameter_descriptor const&
+    {
+        if (position >= _parameters.size())
+            throw core::logic_error(L"attempted to get parameter for out-of-range position");
+
+        return _parameters[position];
+    }
+
+    auto method_parameter_table::return_parameter() const -> method_parameter_descriptor const&
+    {
+        return _return_parameter;
+    }
+
+
+
+
+
     parameter_data::parameter_data()
     {
     }
 
-    parameter_data::parameter_data(metadata::param_token                          const& token,
-                                   metadata::method_signature::parameter_iterator const& signature,
+    parameter_data::parameter_data(method_parameter_descriptor                    const* const descriptor,
+                                   metadata::method_signature::parameter_iterator const&       signature,
                                    core::internal_key)
-        : _token(token), _signature(signature)
+        : _descriptor(descriptor), _signature(signature)
     {
-        core::assert_initialized(token);
+        core::assert_not_null(descriptor);
     }
 
-    auto parameter_data::token() const -> metadata::param_token const&
+    auto parameter_data::descriptor() const -> method_parameter_descriptor const&
     {
         core::assert_initialized(*this);
 
-        return _token;
+        return *_descriptor;
     }
 
     auto parameter_data::signature() const -> metadata::type_signature const&
@@ -37,14 +159,14 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
     auto parameter_data::is_initialized() const -> bool
     {
-        return _token.is_initialized();
+        return _descriptor.is_initialized();
     }
 
     auto parameter_data::operator++() -> parameter_data&
     {
         core::assert_initialized(*this);
 
-        _token = metadata::param_token(&_token.scope(), _token.value() + 1);
+        ++_descriptor.get();
         ++_signature;
         return *this;
     }
@@ -61,7 +183,7 @@ namespace cxxreflect { namespace reflection { namespace detail {
         core::assert_initialized(lhs);
         core::assert_initialized(rhs);
 
-        return lhs._token == rhs._token;
+        return lhs._descriptor.get() == rhs._descriptor.get();
     }
 
     auto operator<(parameter_data const& lhs, parameter_data const& rhs) -> bool
@@ -69,7 +191,7 @@ namespace cxxreflect { namespace reflection { namespace detail {
         core::assert_initialized(lhs);
         core::assert_initialized(rhs);
 
-        return lhs._token < rhs._token;
+        return lhs._descriptor.get() < rhs._descriptor.get();
     }
 
 } } }
@@ -14,6 +14,82 @@
 
 namespace cxxreflect { namespace reflection { namespace detail {
 
+    /// Describes a single parameter (or the return value) of a method definition
+    ///
+    /// A descriptor joins a parameter's position in the method signature with its Param row, if it
+    /// has one.  Param rows are optional:  a parameter need not have a Param row, and the return
+    /// value has a Param row (with sequence zero) only if it has attributes or a name.
+    class method_parameter_descriptor
+    {
+    public:
+
+        method_parameter_descriptor();
+        method_parameter_descriptor(core::size_type sequence, core::size_type signature_offset);
+
+        /// The sequence number of the parameter; the return value has sequence zero and parameters
+        /// are numbered from one, in signature order
+        auto sequence() const -> core::size_type;
+
+        /// The offset of the parameter's type signature from the beginning of the method signature
+        auto signature_offset() const -> core::size_type;
+
+        /// The Param row of the parameter, or a null token if the parameter has no Param row
+        auto token()       const -> metadata::param_token const&;
+        auto flags()       const -> metadata::parameter_flags;
+        auto has_default() const -> bool;
+
+        /// Attaches the Param row `row` to this descriptor; called only while building the table
+        auto attach(metadata::param_row const& row) -> void;
+
+    private:
+
+        core::value_initialized<core::size_type> _sequence;
+        core::value_initialized<core::size_type> _signature_offset;
+        metadata::param_token                    _token;
+        metadata::parameter_flags                _flags;
+    };
+
+    /// The parameter descriptors of a single method definition
+    ///
+    /// Enumerating the parameters of a method requires walking the Param rows of the method and the
+    /// parameters of its signature in lockstep, skipping the return value's Param row and allowing
+    /// for parameters that have no Param row.  The table performs that join once and stores one
+    /// descriptor per parameter, indexed by position, so enumerating parameters is an array walk
+    /// and finding a parameter by position is constant time.  Tables are built lazily and are
+    /// owned by the `module_context` that defines the method; see
+    /// `module_context::parameter_table()`.
+    class method_parameter_table
+    {
+    public:
+
+        typedef std::vector<method_parameter_descriptor> descriptor_sequence;
+
+        explicit method_parameter_table(metadata::method_def_token const& method);
+
+        auto parameter_count() const -> core::size_type;
+
+        auto begin() const -> method_parameter_descriptor const*;
+        auto end()   const -> method_parameter_descriptor const*;
+
+        auto parameter(core::size_type position) const -> method_parameter_descriptor const&;
+
+        /// The descriptor of the return value; its token is null if the return value has no Param
+        /// row
+        auto return_parameter() const -> method_parameter_descriptor const&;
+
+    private:
+
+        method_parameter_table(method_parameter_table const&);
+        auto operator=(method_parameter_table const&) -> method_parameter_table&;
+
+        descriptor_sequence         _parameters;
+        method_parameter_descriptor _return_parameter;
+    };
+
+
+
+
+
     class parameter_data
     {
     public:
@@ -22,12 +98,12 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
         // Note:  This constructor takes an InternalKey only so that it matches other constructors
         // of types with which the parameter iterator is instantiated.
-        parameter_data(metadata::param_token                          const& token,
+        parameter_data(method_parameter_descriptor                    const* descriptor,
                        metadata::method_signature::parameter_iterator const& signature,
                        core::internal_key);
 
-        auto token()     const -> metadata::param_token    const&;
-        auto signature() const -> metadata::type_signature const&;
+        auto descriptor() const -> method_parameter_descriptor const&;
+        auto signature()  const -> metadata::type_signature    const&;
 
         auto is_initialized() const -> bool;
 
@@ -41,8 +117,8 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
     private:
 
-        metadata::param_token                          _token;
-        metadata::method_signature::parameter_iterator _signature;
+        core::checked_pointer<method_parameter_descriptor const> _descriptor;
+        metadata::method_signature::parameter_iterator           _signature;
     };
 
 } } }
@@ -23,57 +23,239 @@ namespace cxxreflect { namespace reflection { namespace detail { namespace {
         if (!source_type.is_initialized() || !system_type.is_initialized())
             return false;
 
-        metadata::type_def_token current(source_type);
-        if (!include_self)
-        {
-            metadata::type_def_ref_spec_token const extends(row_from(current).extends());
-            if (!extends.is_initialized())
-                return false;
+        return is_derived_from(source_type, system_type, include_self);
+    }
 
-            metadata::type_def_or_signature const resolved_extends(resolve_type(extends));
-            if (!resolved_extends.is_token())
-                return false;
+    auto resolve_system_type(metadata::database     const& source_scope,
+                             metadata::element_type const  target_system_type) -> metadata::type_def_token
+    {
+        return loader_context::from(source_scope).resolve_fundamental_type(target_system_type);
+    }
 
-            current = resolved_extends.as_token();
-        }
+    auto resolve_system_type(metadata::database     const& source_scope,
+                             core::string_reference const& target_simple_name) -> metadata::type_def_token
+    {
+        loader_context const& root(loader_context::from(source_scope));
+
+        return root.system_module().type_def_index().find(root.system_namespace(), target_simple_name);
+    }
+
+} } } }
 
-        // TODO Cycle detection
-        while (current.is_initialized())
+namespace cxxreflect { namespace reflection { namespace detail {
+
+    type_def_ancestry::type_def_ancestry(metadata::type_def_token const& type)
+    {
+        core::assert_initialized(type);
+
+        // We walk the base types from the type to its root, then reverse the chain so that each
+        // ancestor is stored at its depth.  Valid type hierarchies are shallow, so a linear search
+        // of the chain is an inexpensive way to detect cycles in invalid metadata.
+        metadata::type_def_token current(type);
+        for (;;)
         {
-            if (current == system_type)
-                return true;
+            _ancestors.push_back(current);
 
             metadata::type_def_ref_spec_token const extends(row_from(current).extends());
             if (!extends.is_initialized())
-                return false;
+                break;
 
-            metadata::type_def_or_signature const resolved_extends(resolve_type(extends));
-            if (!resolved_extends.is_token())
-                return false;
+            current = resolve_primary_type(compute_type(extends));
+            if (!current.is_initialized())
+                break;
 
-            current = resolved_extends.as_token();
+            if (std::find(begin(_ancestors), end(_ancestors), current) != end(_ancestors))
+                throw core::metadata_error(L"type hierarchy contains a cycle");
         }
 
-        return false;
+        std::reverse(begin(_ancestors), end(_ancestors));
     }
 
-    auto resolve_system_type(metadata::database     const& source_scope,
-                             metadata::element_type const  target_system_type) -> metadata::type_def_token
+    auto type_def_ancestry::depth() const -> core::size_type
     {
-        return loader_context::from(source_scope).resolve_fundamental_type(target_system_type);
+        return core::convert_integer(_ancestors.size() - 1);
     }
 
-    auto resolve_system_type(metadata::database     const& source_scope,
-                             core::string_reference const& target_simple_name) -> metadata::type_def_token
+    auto type_def_ancestry::ancestor(core::size_type const depth) const -> metadata::type_def_token const&
     {
-        loader_context const& root(loader_context::from(source_scope));
+        core::assert_true([&]{ return depth < _ancestors.size(); });
 
-        return root.system_module().type_def_index().find(root.system_namespace(), target_simple_name);
+        return _ancestors[depth];
     }
 
-} } } }
+    auto type_def_ancestry::is_derived_from(type_def_ancestry const& other, bool const include_self) const -> bool
+    {
+        core::size_type const other_depth(other.depth());
+        if (other_depth > depth() || (other_depth == depth() && !include_self))
+            return false;
 
-namespace cxxreflect { namespace reflection { namespace detail {
+        return _ancestors[other_depth] == other._ancestors[other_depth];
+    }
+
+    auto get_ancestry(metadata::type_def_token const& source_type) -> type_def_ancestry const&
+    {
+        core::assert_initialized(source_type);
+
+        return module_context::from(source_type.scope()).ancestry(source_type);
+    }
+
+    auto is_derived_from(metadata::type_def_token const& source_type,
+                         metadata::type_def_token const& target_type,
+                         bool                     const  include_self) -> bool
+    {
+        core::assert_initialized(source_type);
+        core::assert_initialized(target_type);
+
+        return get_ancestry(source_type).is_derived_from(get_ancestry(target_type), include_self);
+    }
+
+    type_def_classification::type_def_classification()
+    {
+    }
+
+    type_def_classification::type_def_classification(attribute_flags const flags)
+        : _flags(flags)
+    {
+    }
+
+    auto type_def_classification::compute(metadata::type_def_token const& type, bool const resolve_base_types)
+        -> type_def_classification
+    {
+        core::assert_initialized(type);
+
+        metadata::type_def_row const row(row_from(type));
+
+        attribute_flags result(attribute::initialized);
+        result.set(static_cast<std::uint32_t>(core::as_integer(compute_primitive_kind(type))) << 24);
+
+        if (row.flags().with_mask(metadata::type_attribute::visibility_mask) > metadata::type_attribute::public_)
+            result.set(attribute::nested);
+
+        if (!metadata::find_generic_params(type).empty())
+            result.set(attribute::generic_type_definition);
+
+        bool const is_interface(row.flags().with_mask(metadata::type_attribute::class_semantics_mask)
+            == metadata::type_attribute::interface_);
+
+        if (is_interface)
+            result.set(attribute::interface_);
+
+        if (!resolve_base_types)
+            return type_def_classification(result);
+
+        result.set(attribute::base_types_initialized);
+
+        // An interface has no base type, so none of the base type classifications apply to it:
+        if (is_interface)
+            return type_def_classification(result);
+
+        if (is_derived_from_system_type(type, L"Attribute", false))
+            result.set(attribute::attribute_);
+
+        if (is_derived_from_system_type(type, L"__ComObject", true))
+            result.set(attribute::com_object);
+
+        if (is_derived_from_system_type(type, L"ContextBoundObject", true))
+            result.set(attribute::contextful);
+
+        if (is_derived_from_system_type(type, L"MulticastDelegate", true))
+            result.set(attribute::delegate);
+
+        if (is_derived_from_system_type(type, L"Enum", false))
+            result.set(attribute::enum_);
+
+        if (is_derived_from_system_type(type, L"MarshalByRefObject", true))
+            result.set(attribute::marshal_by_ref);
+
+        if (is_derived_from_system_type(type, metadata::element_type::value_type, true) && !is_system_type(type, L"Enum"))
+            result.set(attribute::value_type);
+
+        return type_def_classification(result);
+    }
+
+    auto type_def_classification::flags() const -> attribute_flags
+    {
+        return _flags;
+    }
+
+    auto type_def_classification::is_set(attribute const mask) const -> bool
+    {
+        return _flags.is_set(mask);
+    }
+
+    auto type_def_classification::primitive_kind() const -> metadata::element_type
+    {
+        return static_cast<metadata::element_type>(_flags.with_mask(attribute::primitive_kind_mask).integer() >> 24);
+    }
+
+    auto type_def_classification::is_initialized() const -> bool
+    {
+        return _flags.is_set(attribute::initialized);
+    }
+
+    auto type_def_classification::is_base_types_initialized() const -> bool
+    {
+        return _flags.is_set(attribute::base_types_initialized);
+    }
+
+    auto type_def_classification::compute_primitive_kind(metadata::type_def_token const& type) -> metadata::element_type
+    {
+        if (!is_system_database(type.scope()))
+            return metadata::element_type::end;
+
+        metadata::type_def_row const row(row_from(type));
+        if (row.namespace_name() != loader_context::from(type.scope()).system_namespace())
+            return metadata::element_type::end;
+
+        core::string_reference const& name(row.name());
+        if (name.size() < 4)
+            return metadata::element_type::end;
+
+        switch (name[0])
+        {
+        case L'B':
+            if (name == L"Boolean") { return metadata::element_type::boolean; }
+            if (name == L"Byte")    { return metadata::element_type::u1;      }
+            break;
+
+        case L'C':
+            if (name == L"Char")    { return metadata::element_type::character; }
+            break;
+
+        case L'D':
+            if (name == L"Double")  { return metadata::element_type::r8; }
+            break;
+
+        case L'I':
+            if (name == L"Int16")   { return metadata::element_type::i2; }
+            if (name == L"Int32")   { return metadata::element_type::i4; }
+            if (name == L"Int64")   { return metadata::element_type::i8; }
+            if (name == L"IntPtr")  { return metadata::element_type::i;  }
+            break;
+
+        case L'S':
+            if (name == L"SByte")   { return metadata::element_type::i1; }
+            if (name == L"Single")  { return metadata::element_type::r4; }
+            break;
+
+        case L'U':
+            if (name == L"UInt16")  { return metadata::element_type::u2; }
+            if (name == L"UInt32")  { return metadata::element_type::u4; }
+            if (name == L"UInt64")  { return metadata::element_type::u8; }
+            if (name == L"UIntPtr") { return metadata::element_type::u;  }
+            break;
+        }
+
+        return metadata::element_type::end;
+    }
+
+    auto get_classification(metadata::type_def_token const& source_type, bool const resolve_base_types)
+        -> type_def_classification
+    {
+        core::assert_initialized(source_type);
+
+        return module_context::from(source_type.scope()).classification(source_type, resolve_base_types);
+    }
 
     auto is_system_assembly(assembly_context const& source_assembly) -> bool
     {
@@ -14,6 +14,127 @@
 
 namespace cxxreflect { namespace reflection { namespace detail {
 
+    /// The chain of base types of a type definition, from its root type down to the type itself
+    ///
+    /// Classification queries (e.g. `is_value_type` and `is_enum`) and subclass tests all need to
+    /// know whether a type derives from some other type.  Walking the `extends` chain requires us
+    /// to resolve each base type, which is expensive when done on every query.  This "display"
+    /// stores every ancestor of a type, indexed by depth (the root type has depth zero and the type
+    /// itself is at `depth()`), so if the display of a type B is known, whether a type D derives
+    /// from B is a single comparison:  D derives from B if and only if the ancestor of D at the
+    /// depth of B is B.
+    ///
+    /// When a base type is a generic type instantiation, the display records its generic type
+    /// definition.  The displays are built lazily and are owned by the `module_context` that
+    /// defines the type; see `module_context::ancestry()`.
+    class type_def_ancestry
+    {
+    public:
+
+        /// Builds the display for `type` by resolving each of its base types.  Throws a
+        /// `metadata_error` if the base types of `type` form a cycle.
+        explicit type_def_ancestry(metadata::type_def_token const& type);
+
+        /// Gets the number of base types of the type
+        auto depth() const -> core::size_type;
+
+        /// Gets the ancestor of the type at `depth`, which must not be greater than `depth()`
+        auto ancestor(core::size_type depth) const -> metadata::type_def_token const&;
+
+        /// Tests whether the type derives from the type described by `other`.  If `include_self` is
+        /// `true`, a type is considered to be derived from itself.
+        auto is_derived_from(type_def_ancestry const& other, bool include_self) const -> bool;
+
+    private:
+
+        type_def_ancestry(type_def_ancestry const&);
+        auto operator=(type_def_ancestry const&) -> type_def_ancestry&;
+
+        std::vector<metadata::type_def_token> _ancestors;
+    };
+
+    /// Gets the cached ancestry of `source_type`, building it if it has not yet been built
+    auto get_ancestry(metadata::type_def_token const& source_type) -> type_def_ancestry const&;
+
+    /// Tests whether `source_type` derives from `target_type`.  If `include_self` is `true`, a type
+    /// is considered to be derived from itself.  Once the ancestries of both types are cached, this
+    /// has constant time complexity.
+    auto is_derived_from(metadata::type_def_token const& source_type,
+                         metadata::type_def_token const& target_type,
+                         bool                            include_self) -> bool;
+
+
+
+
+
+    /// The classification of a type definition, packed into a single 32-bit word
+    ///
+    /// Many type queries (e.g. `is_value_type`, `is_enum`, and `is_primitive`) require us to walk
+    /// the base type chain of a type or to compare its name with the names of system types.  The
+    /// answers never change, so each module computes them once per type definition and caches the
+    /// packed word; see `module_context::classification()`.  The primitive kind (the element type
+    /// of a primitive type, or `element_type::end` for other types) is stored in the high byte.
+    ///
+    /// The classifications that depend on the base types of a type are computed only on request,
+    /// because resolving base types may require other assemblies to be loaded.  Queries that need
+    /// only the type's own metadata (e.g. `is_nested` and `is_interface`) never resolve anything.
+    class type_def_classification
+    {
+    public:
+
+        enum class attribute : std::uint32_t
+        {
+            initialized             = 0x00000001,
+            base_types_initialized  = 0x00000002,
+
+            attribute_              = 0x00000004,
+            com_object              = 0x00000008,
+            contextful              = 0x00000010,
+            delegate                = 0x00000020,
+            enum_                   = 0x00000040,
+            generic_type_definition = 0x00000080,
+            interface_              = 0x00000100,
+            marshal_by_ref          = 0x00000200,
+            nested                  = 0x00000400,
+            value_type              = 0x00000800,
+
+            primitive_kind_mask     = 0xff000000
+        };
+
+        typedef core::flags<attribute> attribute_flags;
+
+        type_def_classification();
+        explicit type_def_classification(attribute_flags flags);
+
+        /// Computes the classification of `type`.  The classifications that depend on the base
+        /// types of `type` are computed only if `resolve_base_types` is `true`.
+        static auto compute(metadata::type_def_token const& type, bool resolve_base_types) -> type_def_classification;
+
+        auto flags()                const -> attribute_flags;
+        auto is_set(attribute mask) const -> bool;
+        auto primitive_kind()       const -> metadata::element_type;
+
+        auto is_initialized()            const -> bool;
+        auto is_base_types_initialized() const -> bool;
+
+    private:
+
+        static auto compute_primitive_kind(metadata::type_def_token const& type) -> metadata::element_type;
+
+        attribute_flags _flags;
+    };
+
+    CXXREFLECT_GENERATE_SCOPED_ENUM_OPERATORS(type_def_classification::attribute)
+
+    /// Gets the cached classification of `source_type`, computing it if it has not yet been computed.
+    /// The classifications that depend on base types are available only if `resolve_base_types`.
+    auto get_classification(metadata::type_def_token const& source_type, bool resolve_base_types)
+        -> type_def_classification;
+
+
+
+
+
     auto is_system_assembly(assembly_context const& source_assembly) -> bool;
     auto is_system_module(module_context const& source_module) -> bool;
     auto is_system_database(metadata::database const& source_database) -> bool;
@@ -330,4 +330,103 @@ namespace cxxreflect { namespace reflection { namespace detail {
         return m == mode::simple_name ? mode::simple_name : mode::full_name;
     }
 
+
+
+
+
+    type_name_cache::name_entry::name_entry(metadata::database const* const scope,
+                                            type_name_kind            const kind,
+                                            core::string_reference    const name,
+                                            name_entry const*         const next)
+        : _scope(scope), _kind(kind), _name(name), _next(next)
+    {
+    }
+
+    type_name_cache::type_name_cache()
+        : _slots(initial_slot_count)
+    {
+    }
+
+    auto type_name_cache::get_name(metadata::type_def_or_signature const& t, type_name_kind const kind) const
+        -> core::string_reference
+    {
+        core::assert_initialized(t);
+
+        slot& names(get_slot(t));
+
+        name_entry const* const existing(find_name(names.load(), &t.scope(), kind));
+        if (existing != nullptr)
+            return existing->_name;
+
+        core::string const name(type_name_builder::build_type_name(t, kind));
+
+        auto const lock(_sync.lock());
+
+        // Another thread may have built the name while we were building it:
+        name_entry const* const raced(find_name(names.load(), &t.scope(), kind));
+        if (raced != nullptr)
+            return raced->_name;
+
+        _entries.push_back(std::unique_ptr<name_entry>(new name_entry(&t.scope(), kind, store_name(name), names.load())));
+        names.store(_entries.back().get());
+        return _entries.back()->_name;
+    }
+
+    auto type_name_cache::get_slot(metadata::type_def_or_signature const& t) const -> slot&
+    {
+        core::const_byte_iterator const identity(compute_identity(t));
+
+        slot* const existing(_slots.find(identity));
+        if (existing != nullptr)
+            return *existing;
+
+        return *_slots.find_or_insert(identity, [&]() -> slot*
+        {
+            _slot_storage.push_back(core::make_unique<slot>());
+            return _slot_storage.back().get();
+        });
+    }
+
+    auto type_name_cache::compute_identity(metadata::type_def_or_signature const& t) -> core::const_byte_iterator
+    {
+        if (t.is_blob())
+            return t.as_blob().begin();
+
+        return t.scope().tables()[metadata::table_id::type_def][t.as_token().index()];
+    }
+
+    auto type_name_cache::find_name(name_entry const*         const first,
+                                    metadata::database const* const scope,
+                                    type_name_kind            const kind) -> name_entry const*
+    {
+        for (name_entry const* it(first); it != nullptr; it = it->_next)
+        {
+            if (it->_scope == scope && it->_kind == kind)
+                return it;
+        }
+
+        return nullptr;
+    }
+
+    auto type_name_cache::store_name(core::string const& name) const -> core::string_reference
+    {
+        core::size_type const required(core::convert_integer(name.size() + 1));
+
+        core::character* first(nullptr);
+        if (required <= block_size)
+        {
+            first = begin(_buffer.allocate(required));
+        }
+        else
+        {
+            _large_names.push_back(std::unique_ptr<core::character[]>(new core::character[required]));
+            first = _large_names.back().get();
+        }
+
+        core::range_checked_copy(begin(name), end(name), first, first + required);
+        first[name.size()] = L'\0';
+
+        return core::string_reference(first, first + name.size());
+    }
+
 } } }
@@ -6,6 +6,7 @@
 #ifndef CXXREFLECT_REFLECTION_DETAIL_TYPE_NAME_BUILDER_HPP_
 #define CXXREFLECT_REFLECTION_DETAIL_TYPE_NAME_BUILDER_HPP_
 
+#include "cxxreflect/reflection/detail/concurrent_index.hpp"
 #include "cxxreflect/reflection/detail/forward_declarations.hpp"
 
 
@@ -18,12 +19,7 @@ namespace cxxreflect { namespace reflection { namespace detail {
     {
     public:
         
-        enum class mode
-        {
-            simple_name,
-            full_name,
-            assembly_qualified_name
-        };
+        typedef type_name_kind mode;
 
         static auto build_type_name(metadata::type_def_ref_or_signature const& t, mode m) -> core::string;
 
@@ -58,6 +54,91 @@ namespace cxxreflect { namespace reflection { namespace detail {
         core::string _buffer;
     };
 
+
+
+
+
+    /// Caches the names of types, by the identity of their type definitions and signatures
+    ///
+    /// Building the name of a type walks its signature, and generic instance names recurse through
+    /// every generic argument, so each form of the name of a type is built at most once per loader.
+    /// The names are stored in an arena and live as long as the cache.
+    ///
+    /// A name is keyed by the identity of its type:  the row of a type definition or the first byte
+    /// of a signature blob.  Formatting a name never requires that the type be resolved, so the key
+    /// must not either; in particular, canonical type ids cannot be used, because a signature whose
+    /// type references cannot be resolved has no canonical type id, yet it has a name.  The cost is
+    /// that two equal signatures in different blobs have their names built separately.
+    ///
+    /// The slots are found through a `concurrent_index`, so a lookup of a cached name takes no
+    /// lock.  Each slot holds a list of the names built for its type, keyed by kind and by the scope
+    /// of the type, because the assembly qualification of a name is computed from the scope in
+    /// which the type is used.  The list is filled the same way as the module caches:  a name is
+    /// built outside of the lock (building a name may load assemblies), then published under the
+    /// lock if no other thread has published it.
+    class type_name_cache
+    {
+    public:
+
+        type_name_cache();
+
+        auto get_name(metadata::type_def_or_signature const& t, type_name_kind kind) const -> core::string_reference;
+
+    private:
+
+        enum : core::size_type
+        {
+            block_size         = 1 << 16,
+            initial_slot_count = 1 << 10
+        };
+
+        class name_entry
+        {
+        public:
+
+            name_entry(metadata::database const* scope,
+                       type_name_kind            kind,
+                       core::string_reference    name,
+                       name_entry const*         next);
+
+            metadata::database const* _scope;
+            type_name_kind            _kind;
+            core::string_reference    _name;
+            name_entry const*         _next;
+        };
+
+        typedef core::atomic<name_entry const*>                                          slot;
+        typedef concurrent_index<core::const_byte_iterator, slot*, metadata_pointer_hash> slot_index;
+        typedef std::vector<std::unique_ptr<slot>>                                        slot_sequence;
+        typedef core::linear_array_allocator<core::character, block_size>                allocator;
+        typedef std::vector<std::unique_ptr<core::character[]>>                          large_name_sequence;
+        typedef std::vector<std::unique_ptr<name_entry>>                                 name_entry_sequence;
+
+        type_name_cache(type_name_cache const&);
+        auto operator=(type_name_cache const&) -> type_name_cache&;
+
+        /// Gets the slot for `t`, creating it if required
+        auto get_slot(metadata::type_def_or_signature const& t) const -> slot&;
+
+        /// Gets the identity of `t`:  the first byte of its TypeDef row or of its signature blob
+        static auto compute_identity(metadata::type_def_or_signature const& t) -> core::const_byte_iterator;
+
+        /// Finds the name of kind `kind` in the list starting at `first`, for a type in `scope`
+        static auto find_name(name_entry const*         first,
+                              metadata::database const* scope,
+                              type_name_kind            kind) -> name_entry const*;
+
+        /// Copies `name` into the arena; the caller must hold the lock
+        auto store_name(core::string const& name) const -> core::string_reference;
+
+        allocator               mutable _buffer;       // Stores the names that fit in an arena block
+        large_name_sequence     mutable _large_names;  // Stores the names that do not
+        name_entry_sequence     mutable _entries;      // Owns the name lists in the slots
+        slot_index              mutable _slots;        // Finds the slot of a type by its identity
+        slot_sequence           mutable _slot_storage; // Owns the slots; modified under the lock of _slots
+        core::recursive_mutex   mutable _sync;         // Serializes insertions into the name lists
+    };
+
 } } }
 
 #endif
@@ -8,6 +8,7 @@
 #include "cxxreflect/reflection/detail/type_policy_array.hpp"
 #include "cxxreflect/reflection/detail/type_policy_by_ref.hpp"
 #include "cxxreflect/reflection/detail/type_policy_definition.hpp"
+#include "cxxreflect/reflection/detail/type_policy_dispatch.hpp"
 #include "cxxreflect/reflection/detail/type_policy_generic_instantiation.hpp"
 #include "cxxreflect/reflection/detail/type_policy_generic_variable.hpp"
 #include "cxxreflect/reflection/detail/type_policy_pointer.hpp"
@@ -21,21 +22,33 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
     auto type_policy::get_for(unresolved_type_context const& t) -> type_policy const&
     {
-        static array_type_policy                 const array_instance;
-        static by_ref_type_policy                const by_ref_instance;
-        static definition_type_policy            const definition_instance;
-        static generic_instantiation_type_policy const generic_instantitaion_instance;
-        static generic_variable_type_policy      const generic_variable_instance;
-        static pointer_type_policy               const pointer_instance;
-        static reference_type_policy             const reference_instance;
-        static specialization_type_policy        const specialization_instance;
+        return get_for(get_kind_for(t));
+    }
 
+    auto type_policy::get_for(type_policy_kind const kind) -> type_policy const&
+    {
+        switch (kind)
+        {
+        case type_policy_kind::array:                 return type_policy_dispatch::instance<array_type_policy                >();
+        case type_policy_kind::by_ref:                return type_policy_dispatch::instance<by_ref_type_policy               >();
+        case type_policy_kind::definition:            return type_policy_dispatch::instance<definition_type_policy           >();
+        case type_policy_kind::generic_instantiation: return type_policy_dispatch::instance<generic_instantiation_type_policy>();
+        case type_policy_kind::generic_variable:      return type_policy_dispatch::instance<generic_variable_type_policy     >();
+        case type_policy_kind::pointer:               return type_policy_dispatch::instance<pointer_type_policy              >();
+        case type_policy_kind::reference:             return type_policy_dispatch::instance<reference_type_policy            >();
+        case type_policy_kind::specialization:        return type_policy_dispatch::instance<specialization_type_policy       >();
+        default:                                      core::assert_unreachable();
+        }
+    }
+
+    auto type_policy::get_kind_for(unresolved_type_context const& t) -> type_policy_kind
+    {
         if (t.is_token())
         {
             switch (t.as_token().table())
             {
-            case metadata::table_id::type_def: return definition_instance;
-            case metadata::table_id::type_ref: return reference_instance;
+            case metadata::table_id::type_def: return type_policy_kind::definition;
+            case metadata::table_id::type_ref: return type_policy_kind::reference;
             default:                           core::assert_unreachable();
             }
         }
@@ -44,21 +57,21 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
         // The ByRef check must come first:
         if (signature.is_by_ref())
-            return by_ref_instance;
+            return type_policy_kind::by_ref;
 
         if (signature.is_simple_array() || signature.is_general_array())
-            return array_instance;
+            return type_policy_kind::array;
 
         if (signature.is_generic_instance())
-            return generic_instantitaion_instance;
+            return type_policy_kind::generic_instantiation;
 
         if (signature.is_pointer())
-            return pointer_instance;
+            return type_policy_kind::pointer;
 
         if (signature.is_class_variable() || signature.is_method_variable())
-            return generic_variable_instance;
+            return type_policy_kind::generic_variable;
 
-        return specialization_instance; // Oh :'(
+        return type_policy_kind::specialization; // Oh :'(
     }
 
 
@@ -15,6 +15,22 @@
 
 namespace cxxreflect { namespace reflection { namespace detail {
 
+    /// Identifies the concrete type policy for a type
+    ///
+    /// Type handles store this tag instead of a pointer to their policy, so that calls can be
+    /// dispatched without virtual calls; see `type_policy_dispatch`.
+    enum class type_policy_kind : std::uint8_t
+    {
+        array,
+        by_ref,
+        definition,
+        generic_instantiation,
+        generic_variable,
+        pointer,
+        reference,
+        specialization
+    };
+
     class type_policy
     {
     public:
@@ -23,6 +39,9 @@ namespace cxxreflect { namespace reflection { namespace detail {
         typedef metadata::type_def_ref_or_signature unresolved_type_context;
 
         static auto get_for(unresolved_type_context const&) -> type_policy const&;
+        static auto get_for(type_policy_kind) -> type_policy const&;
+
+        static auto get_kind_for(unresolved_type_context const&) -> type_policy_kind;
 
         // These functions can test properties of an unresolved type.  A TypeRef always refers to
         // some TypeSpec, so properties that can only appear in a signature are never true for a
@@ -6,6 +6,7 @@
 #ifndef CXXREFLECT_REFLECTION_DETAIL_TYPE_POLICY_ARRAY_HPP_
 #define CXXREFLECT_REFLECTION_DETAIL_TYPE_POLICY_ARRAY_HPP_
 
+#include "cxxreflect/reflection/detail/loader_context.hpp"
 #include "cxxreflect/reflection/detail/type_policy_specialization.hpp"
 
 namespace cxxreflect { namespace reflection { namespace detail {
@@ -31,8 +32,107 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
         virtual auto layout    (resolved_type_context const&) const -> type_layout     override;
         virtual auto visibility(resolved_type_context const&) const -> type_visibility override;
+
+    private:
+
+        static auto assert_array(unresolved_type_context const&) -> void;
     };
 
+
+
+
+
+    inline auto array_type_policy::assert_array(unresolved_type_context const& t) -> void
+    {
+        core::assert_true([&]
+        {
+            return t.as_blob().as<metadata::type_signature>().is_general_array()
+                || t.as_blob().as<metadata::type_signature>().is_simple_array();
+        });
+    }
+
+    inline auto array_type_policy::is_array(unresolved_type_context const& t) const -> bool
+    {
+        assert_array(t);
+
+        return true;
+    }
+
+    inline auto array_type_policy::is_nested(unresolved_type_context const& t) const -> bool
+    {
+        assert_array(t);
+
+        return false;
+    }
+
+
+
+
+
+    inline auto array_type_policy::base_type(resolved_type_context const& t) const -> unresolved_type_context
+    {
+        assert_array(t);
+
+        loader_context const& root(loader_context::from(t.scope()));
+        return root.resolve_fundamental_type(metadata::element_type::array);
+    }
+
+    inline auto array_type_policy::is_abstract(resolved_type_context const& t) const -> bool
+    {
+        assert_array(t);
+        
+        return false;
+    }
+
+    inline auto array_type_policy::is_interface(resolved_type_context const& t) const -> bool
+    {
+        assert_array(t);
+
+        return false;
+    }
+
+    inline auto array_type_policy::is_marshal_by_ref(resolved_type_context const& t) const -> bool
+    {
+        assert_array(t);
+
+        return false;
+    }
+
+    inline auto array_type_policy::is_sealed(resolved_type_context const& t) const -> bool
+    {
+        assert_array(t);
+
+        return true;
+    }
+
+    inline auto array_type_policy::is_serializable(resolved_type_context const& t) const -> bool
+    {
+        assert_array(t);
+
+        return true;
+    }
+
+    inline auto array_type_policy::is_value_type(resolved_type_context const& t) const -> bool
+    {
+        assert_array(t);
+
+        return false;
+    }
+
+    inline auto array_type_policy::layout(resolved_type_context const& t) const -> type_layout
+    {
+        assert_array(t);
+
+        return type_layout::auto_layout;
+    }
+
+    inline auto array_type_policy::visibility(resolved_type_context const& t) const -> type_visibility
+    {
+        assert_array(t);
+
+        return type_visibility::public_;
+    }
+
 } } }
 
 #endif
@@ -36,8 +36,137 @@ namespace cxxreflect { namespace reflection { namespace detail {
         virtual auto layout        (resolved_type_context const&) const -> type_layout        override;
         virtual auto string_format (resolved_type_context const&) const -> type_string_format override;
         virtual auto visibility    (resolved_type_context const&) const -> type_visibility    override;
+
+    private:
+
+        static auto assert_by_ref(unresolved_type_context const&) -> void;
     };
 
+
+
+
+
+    inline auto by_ref_type_policy::assert_by_ref(unresolved_type_context const& t) -> void
+    {
+        core::assert_true([&]{ return t.as_blob().as<metadata::type_signature>().is_by_ref(); });
+    }
+
+    inline auto by_ref_type_policy::is_by_ref(unresolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return true;
+    }
+
+    inline auto by_ref_type_policy::is_nested(unresolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return false;
+    }
+
+
+
+
+
+    inline auto by_ref_type_policy::attributes(resolved_type_context const& t) const -> metadata::type_flags
+    {
+        assert_by_ref(t);
+
+        return metadata::type_flags();
+    }
+
+    inline auto by_ref_type_policy::base_type(resolved_type_context const& t) const -> unresolved_type_context
+    {
+        assert_by_ref(t);
+
+        return unresolved_type_context();
+    }
+
+    inline auto by_ref_type_policy::is_abstract(resolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return false;
+    }
+
+    inline auto by_ref_type_policy::is_enum(resolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return false;
+    }
+
+    inline auto by_ref_type_policy::is_import(resolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return false;
+    }
+
+    inline auto by_ref_type_policy::is_interface(resolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return false;
+    }
+
+    inline auto by_ref_type_policy::is_marshal_by_ref(resolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return false;
+    }
+
+    inline auto by_ref_type_policy::is_sealed(resolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return false;
+    }
+
+    inline auto by_ref_type_policy::is_serializable(resolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return false;
+    }
+
+    inline auto by_ref_type_policy::is_special_name(resolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return false;
+    }
+
+    inline auto by_ref_type_policy::is_value_type(resolved_type_context const& t) const -> bool
+    {
+        assert_by_ref(t);
+
+        return false;
+    }
+
+    inline auto by_ref_type_policy::layout(resolved_type_context const& t) const -> type_layout
+    {
+        assert_by_ref(t);
+
+        return type_layout::auto_layout;
+    }
+
+    inline auto by_ref_type_policy::string_format(resolved_type_context const& t) const -> type_string_format
+    {
+        assert_by_ref(t);
+
+        return type_string_format::ansi_string_format;
+    }
+
+    inline auto by_ref_type_policy::visibility(resolved_type_context const& t) const -> type_visibility
+    {
+        assert_by_ref(t);
+
+        return type_visibility::not_public;
+    }
+
 } } }
 
 #endif
@@ -6,7 +6,11 @@
 #ifndef CXXREFLECT_REFLECTION_DETAIL_TYPE_POLICY_DEFINITION_HPP_
 #define CXXREFLECT_REFLECTION_DETAIL_TYPE_POLICY_DEFINITION_HPP_
 
+#include "cxxreflect/reflection/detail/loader_context.hpp"
+#include "cxxreflect/reflection/detail/module_context.hpp"
+#include "cxxreflect/reflection/detail/type_hierarchy.hpp"
 #include "cxxreflect/reflection/detail/type_policy.hpp"
+#include "cxxreflect/reflection/detail/type_resolution.hpp"
 
 namespace cxxreflect { namespace reflection { namespace detail {
 
@@ -52,8 +56,309 @@ namespace cxxreflect { namespace reflection { namespace detail {
         virtual auto metadata_token(resolved_type_context const&) const -> core::size_type    override;
         virtual auto string_format (resolved_type_context const&) const -> type_string_format override;
         virtual auto visibility    (resolved_type_context const&) const -> type_visibility    override;
+
+    private:
+
+        static auto assert_definition  (unresolved_type_context const&)                          -> void;
+        static auto definition_from    (unresolved_type_context const&)                          -> metadata::type_def_token;
+        static auto classification_from(unresolved_type_context const&, bool resolve_base_types) -> type_def_classification;
     };
 
+
+
+
+
+    inline auto definition_type_policy::assert_definition(unresolved_type_context const& t) -> void
+    {
+        core::assert_true([&]{ return t.is_token() && t.as_token().is<metadata::type_def_token>(); });
+    }
+
+    inline auto definition_type_policy::definition_from(unresolved_type_context const& t) -> metadata::type_def_token
+    {
+        return t.as_token().as<metadata::type_def_token>();
+    }
+
+    inline auto definition_type_policy::classification_from(unresolved_type_context const& t, bool const resolve_base_types)
+        -> type_def_classification
+    {
+        return get_classification(definition_from(t), resolve_base_types);
+    }
+
+    inline auto definition_type_policy::is_array(unresolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return false;
+    }
+
+    inline auto definition_type_policy::is_by_ref(unresolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return false;
+    }
+
+    inline auto definition_type_policy::is_generic_type_instantiation(unresolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return false;
+    }
+
+    inline auto definition_type_policy::is_nested(unresolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return classification_from(t, false).is_set(type_def_classification::attribute::nested);
+    }
+
+    inline auto definition_type_policy::is_pointer(unresolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return false;
+    }
+
+    inline auto definition_type_policy::is_primitive(unresolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return classification_from(t, false).primitive_kind() != metadata::element_type::end;
+    }
+
+    inline auto definition_type_policy::namespace_name(unresolved_type_context const& t) const -> core::string_reference
+    {
+        assert_definition(t);
+
+        return row_from(definition_from(t)).namespace_name();
+    }
+
+    inline auto definition_type_policy::primary_name(unresolved_type_context const& t) const -> core::string_reference
+    {
+        assert_definition(t);
+
+        return row_from(definition_from(t)).name();
+    }
+
+
+    inline auto definition_type_policy::declaring_type(unresolved_type_context const& t) const -> unresolved_type_context
+    {
+        assert_definition(t);
+
+        if (!is_nested(t))
+            return unresolved_type_context();
+
+        metadata::database const& scope(t.scope());
+        auto const it(std::lower_bound(
+            scope.begin<metadata::table_id::nested_class>(),
+            scope.end<metadata::table_id::nested_class>(),
+            definition_from(t),
+            [](metadata::nested_class_row const& row, metadata::type_def_token const& token)
+        {
+            return row.nested_class() < token;
+        }));
+
+        if (it == scope.end<metadata::table_id::nested_class>())
+            throw core::metadata_error(L"type was identified as nested but had no associated nested class row");
+
+        return it->enclosing_class();
+    }
+
+
+
+
+
+    inline auto definition_type_policy::attributes(resolved_type_context const& t) const -> metadata::type_flags
+    {
+        assert_definition(t);
+
+        return row_from(definition_from(t)).flags();
+    }
+
+    inline auto definition_type_policy::base_type(resolved_type_context const& t) const -> unresolved_type_context
+    {
+        assert_definition(t);
+
+        metadata::type_def_ref_spec_token const extends(row_from(definition_from(t)).extends());
+        if (!extends.is_initialized())
+            return unresolved_type_context();
+
+        return compute_type(extends);
+    }
+
+
+    inline auto definition_type_policy::is_abstract(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return row_from(definition_from(t)).flags().is_set(metadata::type_attribute::abstract_);
+    }
+
+    inline auto definition_type_policy::is_com_object(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return classification_from(t, true).is_set(type_def_classification::attribute::com_object);
+    }
+
+    inline auto definition_type_policy::is_contextful(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return classification_from(t, true).is_set(type_def_classification::attribute::contextful);
+    }
+
+    inline auto definition_type_policy::is_enum(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return classification_from(t, true).is_set(type_def_classification::attribute::enum_);
+    }
+
+    inline auto definition_type_policy::is_generic_parameter(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return false;
+    }
+
+    inline auto definition_type_policy::is_generic_type(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return is_generic_type_definition(t);
+    }
+
+    inline auto definition_type_policy::is_generic_type_definition(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return classification_from(t, false).is_set(type_def_classification::attribute::generic_type_definition);
+    }
+
+    inline auto definition_type_policy::is_import(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return row_from(definition_from(t)).flags().is_set(metadata::type_attribute::import);
+    }
+
+    inline auto definition_type_policy::is_interface(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return classification_from(t, false).is_set(type_def_classification::attribute::interface_);
+    }
+
+    inline auto definition_type_policy::is_marshal_by_ref(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return classification_from(t, true).is_set(type_def_classification::attribute::marshal_by_ref);
+    }
+
+    inline auto definition_type_policy::is_sealed(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return row_from(definition_from(t)).flags().is_set(metadata::type_attribute::sealed);
+    }
+
+    inline auto definition_type_policy::is_serializable(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        if (row_from(definition_from(t)).flags().is_set(metadata::type_attribute::serializable))
+            return true;
+
+        type_def_classification const classification(classification_from(t, true));
+        return classification.is_set(type_def_classification::attribute::enum_)
+            || classification.is_set(type_def_classification::attribute::delegate);
+    }
+
+    inline auto definition_type_policy::is_special_name(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return row_from(definition_from(t)).flags().is_set(metadata::type_attribute::special_name);
+    }
+
+    inline auto definition_type_policy::is_value_type(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        return classification_from(t, true).is_set(type_def_classification::attribute::value_type);
+    }
+
+    inline auto definition_type_policy::is_visible(resolved_type_context const& t) const -> bool
+    {
+        assert_definition(t);
+
+        if (is_nested(t) && !is_visible(declaring_type(t).as_token().as<metadata::type_def_token>()))
+            return false;
+
+        switch (row_from(definition_from(t)).flags().with_mask(metadata::type_attribute::visibility_mask).enumerator())
+        {
+        case metadata::type_attribute::public_:
+        case metadata::type_attribute::nested_public:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    inline auto definition_type_policy::layout(resolved_type_context const& t) const -> type_layout
+    {
+        assert_definition(t);
+
+        switch (row_from(definition_from(t)).flags().with_mask(metadata::type_attribute::layout_mask).enumerator())
+        {
+        case metadata::type_attribute::auto_layout:       return type_layout::auto_layout;
+        case metadata::type_attribute::explicit_layout:   return type_layout::explicit_layout;
+        case metadata::type_attribute::sequential_layout: return type_layout::sequential_layout;
+        default:                                          return type_layout::unknown;
+        }
+    }
+
+    inline auto definition_type_policy::metadata_token(resolved_type_context const& t) const -> core::size_type
+    {
+        assert_definition(t);
+
+        return definition_from(t).value();
+    }
+
+    inline auto definition_type_policy::string_format(resolved_type_context const& t) const -> type_string_format
+    {
+        assert_definition(t);
+
+        switch (row_from(definition_from(t)).flags().with_mask(metadata::type_attribute::string_format_mask).enumerator())
+        {
+        case metadata::type_attribute::ansi_class:    return type_string_format::ansi_string_format;
+        case metadata::type_attribute::auto_class:    return type_string_format::auto_string_format;
+        case metadata::type_attribute::unicode_class: return type_string_format::unicode_string_format;
+        default:                                      return type_string_format::unknown;
+        }
+    }
+
+    inline auto definition_type_policy::visibility(resolved_type_context const& t) const -> type_visibility
+    {
+        assert_definition(t);
+
+        switch (row_from(definition_from(t)).flags().with_mask(metadata::type_attribute::visibility_mask).enumerator())
+        {
+        case metadata::type_attribute::not_public:                 return type_visibility::not_public;
+        case metadata::type_attribute::public_:                    return type_visibility::public_;
+        case metadata::type_attribute::nested_public:              return type_visibility::nested_public;
+        case metadata::type_attribute::nested_private:             return type_visibility::nested_private;
+        case metadata::type_attribute::nested_family:              return type_visibility::nested_family;
+        case metadata::type_attribute::nested_assembly:            return type_visibility::nested_assembly;
+        case metadata::type_attribute::nested_family_and_assembly: return type_visibility::nested_family_and_assembly;
+        case metadata::type_attribute::nested_family_or_assembly:  return type_visibility::nested_family_or_assembly;
+        default:                                                   return type_visibility::unknown;
+        }
+    }
+
 } } }
 
 #endif
@@ -0,0 +1,116 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#ifndef CXXREFLECT_REFLECTION_DETAIL_TYPE_POLICY_DISPATCH_HPP_
+#define CXXREFLECT_REFLECTION_DETAIL_TYPE_POLICY_DISPATCH_HPP_
+
+#include "cxxreflect/reflection/detail/type_policy.hpp"
+#include "cxxreflect/reflection/detail/type_policy_array.hpp"
+#include "cxxreflect/reflection/detail/type_policy_by_ref.hpp"
+#include "cxxreflect/reflection/detail/type_policy_definition.hpp"
+#include "cxxreflect/reflection/detail/type_policy_generic_instantiation.hpp"
+#include "cxxreflect/reflection/detail/type_policy_generic_variable.hpp"
+#include "cxxreflect/reflection/detail/type_policy_pointer.hpp"
+#include "cxxreflect/reflection/detail/type_policy_reference.hpp"
+#include "cxxreflect/reflection/detail/type_policy_specialization.hpp"
+
+
+
+
+
+namespace cxxreflect { namespace reflection { namespace detail {
+
+    /// Dispatches type policy calls by policy kind, without virtual calls
+    ///
+    /// Every query on a type handle is answered by the type's policy.  A call through a reference
+    /// to `type_policy` is a virtual call, which the optimizer cannot inline, and type queries are
+    /// made in our tightest loops.  Type handles therefore store their `type_policy_kind`, and each
+    /// of these functions switches on the kind and makes a qualified (i.e., nonvirtual) call to the
+    /// concrete policy's implementation.  The policies' member functions are defined inline in
+    /// their headers, so each qualified call can be inlined into the switch.  Type definitions are
+    /// by far the most common kind of type, so the definition case is tested first.
+    class type_policy_dispatch
+    {
+    public:
+
+        typedef type_policy::resolved_type_context   resolved_type_context;
+        typedef type_policy::unresolved_type_context unresolved_type_context;
+
+        /// Gets the (stateless) policy object of type `Policy`
+        template <typename Policy>
+        static auto instance() -> Policy const&
+        {
+            static Policy const value;
+            return value;
+        }
+
+        #define CXXREFLECT_GENERATE(name, context_type, result_type)                                              \
+            static auto name(type_policy_kind const kind, context_type const& t) -> result_type                   \
+            {                                                                                                     \
+                switch (kind)                                                                                     \
+                {                                                                                                 \
+                case type_policy_kind::definition:                                                                \
+                    return instance<definition_type_policy>().definition_type_policy::name(t);                   \
+                case type_policy_kind::array:                                                                     \
+                    return instance<array_type_policy>().array_type_policy::name(t);                             \
+                case type_policy_kind::by_ref:                                                                    \
+                    return instance<by_ref_type_policy>().by_ref_type_policy::name(t);                           \
+                case type_policy_kind::generic_instantiation:                                                     \
+                    return instance<generic_instantiation_type_policy>().generic_instantiation_type_policy::name(t); \
+                case type_policy_kind::generic_variable:                                                          \
+                    return instance<generic_variable_type_policy>().generic_variable_type_policy::name(t);       \
+                case type_policy_kind::pointer:                                                                   \
+                    return instance<pointer_type_policy>().pointer_type_policy::name(t);                         \
+                case type_policy_kind::reference:                                                                 \
+                    return instance<reference_type_policy>().reference_type_policy::name(t);                     \
+                case type_policy_kind::specialization:                                                            \
+                    return instance<specialization_type_policy>().specialization_type_policy::name(t);           \
+                default:                                                                                          \
+                    core::assert_unreachable();                                                                   \
+                }                                                                                                 \
+            }
+
+        CXXREFLECT_GENERATE(is_array,                      unresolved_type_context, bool                   )
+        CXXREFLECT_GENERATE(is_by_ref,                     unresolved_type_context, bool                   )
+        CXXREFLECT_GENERATE(is_generic_type_instantiation, unresolved_type_context, bool                   )
+        CXXREFLECT_GENERATE(is_nested,                     unresolved_type_context, bool                   )
+        CXXREFLECT_GENERATE(is_pointer,                    unresolved_type_context, bool                   )
+        CXXREFLECT_GENERATE(is_primitive,                  unresolved_type_context, bool                   )
+
+        CXXREFLECT_GENERATE(namespace_name,                unresolved_type_context, core::string_reference )
+        CXXREFLECT_GENERATE(primary_name,                  unresolved_type_context, core::string_reference )
+
+        CXXREFLECT_GENERATE(declaring_type,                unresolved_type_context, unresolved_type_context)
+
+        CXXREFLECT_GENERATE(attributes,                    resolved_type_context,   metadata::type_flags   )
+        CXXREFLECT_GENERATE(base_type,                     resolved_type_context,   unresolved_type_context)
+
+        CXXREFLECT_GENERATE(is_abstract,                   resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_com_object,                 resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_contextful,                 resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_enum,                       resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_generic_parameter,          resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_generic_type,               resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_generic_type_definition,    resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_import,                     resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_interface,                  resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_marshal_by_ref,             resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_sealed,                     resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_serializable,               resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_special_name,               resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_value_type,                 resolved_type_context,   bool                   )
+        CXXREFLECT_GENERATE(is_visible,                    resolved_type_context,   bool                   )
+
+        CXXREFLECT_GENERATE(layout,                        resolved_type_context,   type_layout            )
+        CXXREFLECT_GENERATE(metadata_token,                resolved_type_context,   core::size_type        )
+        CXXREFLECT_GENERATE(string_format,                 resolved_type_context,   type_string_format     )
+        CXXREFLECT_GENERATE(visibility,                    resolved_type_context,   type_visibility        )
+
+        #undef CXXREFLECT_GENERATE
+    };
+
+} } }
+
+#endif
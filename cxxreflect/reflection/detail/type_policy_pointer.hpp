@@ -40,8 +40,158 @@ namespace cxxreflect { namespace reflection { namespace detail {
         virtual auto layout       (resolved_type_context const&) const -> type_layout        override;
         virtual auto string_format(resolved_type_context const&) const -> type_string_format override;
         virtual auto visibility   (resolved_type_context const&) const -> type_visibility    override;
+
+    private:
+
+        static auto assert_pointer(unresolved_type_context const&) -> void;
     };
 
+
+
+
+
+    inline auto pointer_type_policy::assert_pointer(unresolved_type_context const& t) -> void
+    {
+        core::assert_true([&]{ return t.as_blob().as<metadata::type_signature>().is_pointer(); });
+    }
+
+    inline auto pointer_type_policy::is_nested(unresolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_pointer(unresolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return true;
+    }
+
+    inline auto pointer_type_policy::declaring_type(unresolved_type_context const& t) const -> unresolved_type_context
+    {
+        assert_pointer(t);
+
+        return unresolved_type_context();
+    }
+
+
+
+
+
+    inline auto pointer_type_policy::attributes(resolved_type_context const& t) const -> metadata::type_flags
+    {
+        assert_pointer(t);
+
+        return metadata::type_flags();
+    }
+
+    inline auto pointer_type_policy::base_type(resolved_type_context const& t) const -> unresolved_type_context
+    {
+        assert_pointer(t);
+
+        return unresolved_type_context();
+    }
+
+    inline auto pointer_type_policy::is_abstract(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_com_object(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_contextful(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_enum(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_import(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_interface(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_marshal_by_ref(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_sealed(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_serializable(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_special_name(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::is_value_type(resolved_type_context const& t) const -> bool
+    {
+        assert_pointer(t);
+
+        return false;
+    }
+
+    inline auto pointer_type_policy::layout(resolved_type_context const& t) const -> type_layout
+    {
+        assert_pointer(t);
+
+        return type_layout::auto_layout;
+    }
+
+    inline auto pointer_type_policy::string_format(resolved_type_context const& t) const -> type_string_format
+    {
+        assert_pointer(t);
+
+        return type_string_format::ansi_string_format;
+    }
+
+    inline auto pointer_type_policy::visibility(resolved_type_context const& t) const -> type_visibility
+    {
+        assert_pointer(t);
+
+        return type_visibility::not_public;
+    }
+
 } } }
 
 #endif
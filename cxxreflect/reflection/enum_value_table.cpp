@@ -0,0 +1,231 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "cxxreflect/reflection/precompiled_headers.hpp"
+#include "cxxreflect/reflection/detail/module_context.hpp"
+#include "cxxreflect/reflection/enum_value_table.hpp"
+#include "cxxreflect/reflection/type.hpp"
+
+namespace cxxreflect { namespace reflection { namespace {
+
+    template <typename T>
+    auto sign_extend(T const value) -> std::uint64_t
+    {
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(value));
+    }
+
+    /// Reads the value of an enumeration constant, extended to 64 bits as described by `enum_value`
+    auto read_extended_value(constant const& value) -> std::uint64_t
+    {
+        switch (value.get_kind())
+        {
+        case constant::kind::boolean:   return value.as_boolean() ? 1 : 0;
+        case constant::kind::character: return static_cast<std::uint16_t>(value.as_character());
+        case constant::kind::int8:      return sign_extend(value.as_int8());
+        case constant::kind::uint8:     return value.as_uint8();
+        case constant::kind::int16:     return sign_extend(value.as_int16());
+        case constant::kind::uint16:    return value.as_uint16();
+        case constant::kind::int32:     return sign_extend(value.as_int32());
+        case constant::kind::uint32:    return value.as_uint32();
+        case constant::kind::int64:     return sign_extend(value.as_int64());
+        case constant::kind::uint64:    return value.as_uint64();
+        default: throw core::runtime_error(L"invalid enumeration constant encountered");
+        }
+    }
+
+} } }
+
+namespace cxxreflect { namespace reflection {
+
+    enum_value::enum_value()
+    {
+    }
+
+    enum_value::enum_value(core::string_reference const& name, std::uint64_t const value, core::size_type const metadata_token)
+        : _name(name), _value(value), _metadata_token(metadata_token)
+    {
+    }
+
+    auto enum_value::name() const -> core::string_reference
+    {
+        core::assert_initialized(*this);
+        return _name;
+    }
+
+    auto enum_value::signed_value() const -> std::int64_t
+    {
+        core::assert_initialized(*this);
+        return static_cast<std::int64_t>(_value.get());
+    }
+
+    auto enum_value::unsigned_value() const -> std::uint64_t
+    {
+        core::assert_initialized(*this);
+        return _value.get();
+    }
+
+    auto enum_value::metadata_token() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return _metadata_token.get();
+    }
+
+    auto enum_value::is_initialized() const -> bool
+    {
+        return _metadata_token.get() != 0;
+    }
+
+    auto enum_value::operator!() const -> bool
+    {
+        return !is_initialized();
+    }
+
+
+
+
+
+    enum_value_table::enum_value_table(metadata::type_def_token const& enumeration)
+    {
+        core::assert_initialized(enumeration);
+
+        // The named values of an enumeration are its static literal fields; the only other field
+        // of an enumeration is its instance value__ field:
+        core::for_all(metadata::find_fields(enumeration), [&](metadata::field_row const& f)
+        {
+            if (!f.flags().is_set(metadata::field_attribute::static_) ||
+                !f.flags().is_set(metadata::field_attribute::literal))
+                return;
+
+            metadata::constant_row const constant_row(metadata::find_constant(f.token()));
+            if (!constant_row.is_initialized())
+                return;
+
+            constant const value(constant_row.token(), core::internal_key());
+            if (_underlying_kind.get() == constant::kind::unknown)
+                _underlying_kind.get() = value.get_kind();
+
+            _values_in_declaration_order.push_back(enum_value(f.name(), read_extended_value(value), f.token().value()));
+        });
+
+        _values         = _values_in_declaration_order;
+        _values_by_name = _values_in_declaration_order;
+
+        std::stable_sort(_values.begin(), _values.end(), [](enum_value const& lhs, enum_value const& rhs)
+        {
+            return lhs.unsigned_value() < rhs.unsigned_value();
+        });
+
+        std::stable_sort(_values_by_name.begin(), _values_by_name.end(), [](enum_value const& lhs, enum_value const& rhs)
+        {
+            return lhs.name() < rhs.name();
+        });
+    }
+
+    auto enum_value_table::underlying_kind() const -> constant::kind
+    {
+        return _underlying_kind.get();
+    }
+
+    auto enum_value_table::is_signed() const -> bool
+    {
+        switch (_underlying_kind.get())
+        {
+        case constant::kind::int8:
+        case constant::kind::int16:
+        case constant::kind::int32:
+        case constant::kind::int64:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    auto enum_value_table::values_in_declaration_order() const -> value_range
+    {
+        return value_range(_values_in_declaration_order.begin(), _values_in_declaration_order.end());
+    }
+
+    auto enum_value_table::values() const -> value_range
+    {
+        return value_range(_values.begin(), _values.end());
+    }
+
+    auto enum_value_table::values_by_name() const -> value_range
+    {
+        return value_range(_values_by_name.begin(), _values_by_name.end());
+    }
+
+    auto enum_value_table::find(std::uint64_t const value) const -> enum_value
+    {
+        auto const it(std::lower_bound(_values.begin(), _values.end(), value, [](enum_value const& lhs, std::uint64_t const rhs)
+        {
+            return lhs.unsigned_value() < rhs;
+        }));
+
+        if (it == _values.end() || it->unsigned_value() != value)
+            return enum_value();
+
+        return *it;
+    }
+
+    auto enum_value_table::find(core::string_reference const& name) const -> enum_value
+    {
+        auto const it(std::lower_bound(_values_by_name.begin(), _values_by_name.end(), name,
+            [](enum_value const& lhs, core::string_reference const& rhs) { return lhs.name() < rhs; }));
+
+        if (it == _values_by_name.end() || it->name() != name)
+            return enum_value();
+
+        return *it;
+    }
+
+    auto enum_value_table::decompose(std::uint64_t const value) const -> value_sequence
+    {
+        value_sequence result;
+
+        if (value == 0)
+        {
+            enum_value const zero(find(0));
+            if (zero.is_initialized())
+                result.push_back(zero);
+
+            return result;
+        }
+
+        std::uint64_t remaining(value);
+        std::for_each(_values.rbegin(), _values.rend(), [&](enum_value const& v)
+        {
+            if (v.unsigned_value() != 0 && (remaining & v.unsigned_value()) == v.unsigned_value())
+            {
+                remaining &= ~v.unsigned_value();
+                result.push_back(v);
+            }
+        });
+
+        if (remaining != 0)
+            return value_sequence();
+
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+
+
+
+
+    auto enum_values(type const& enumeration) -> enum_value_table const&
+    {
+        core::assert_initialized(enumeration);
+
+        metadata::type_def_or_signature const& token(enumeration.context(core::internal_key()));
+        if (!enumeration.is_enum() || !token.is_token())
+            throw core::runtime_error(L"type is not an enumeration definition");
+
+        metadata::type_def_token const definition(token.as_token());
+        return detail::module_context::from(definition.scope()).enum_values(definition);
+    }
+
+} }
@@ -0,0 +1,119 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#ifndef CXXREFLECT_REFLECTION_ENUM_VALUE_TABLE_HPP_
+#define CXXREFLECT_REFLECTION_ENUM_VALUE_TABLE_HPP_
+
+#include "cxxreflect/reflection/detail/forward_declarations.hpp"
+#include "cxxreflect/reflection/constant.hpp"
+
+namespace cxxreflect { namespace reflection {
+
+    /// A named value of an enumeration
+    ///
+    /// Values are stored as 64-bit integers regardless of the underlying type of the enumeration.
+    /// Values of enumerations with signed underlying types are sign-extended, so `signed_value()`
+    /// always yields the declared value; values of enumerations with unsigned underlying types are
+    /// zero-extended, so `unsigned_value()` always yields the declared value.
+    class enum_value
+    {
+    public:
+
+        enum_value();
+        enum_value(core::string_reference const& name, std::uint64_t value, core::size_type metadata_token);
+
+        auto name()           const -> core::string_reference;
+        auto signed_value()   const -> std::int64_t;
+        auto unsigned_value() const -> std::uint64_t;
+
+        /// Gets the metadata token of the field that defines the value
+        auto metadata_token() const -> core::size_type;
+
+        auto is_initialized() const -> bool;
+        auto operator!()      const -> bool;
+
+        CXXREFLECT_GENERATE_SAFE_BOOL_CONVERSION(enum_value)
+
+    private:
+
+        core::string_reference                   _name;
+        core::value_initialized<std::uint64_t>   _value;
+        core::value_initialized<core::size_type> _metadata_token;
+    };
+
+
+
+
+
+    /// The named values of an enumeration, in declaration order, sorted by value, and by name
+    ///
+    /// The table is built in a single pass over the literal fields of the enumeration and is
+    /// cached by the module that defines the enumeration, so it is built at most once per type;
+    /// see `enum_values()`.  Value-to-name and name-to-value lookups are both O(log N).  Values
+    /// passed to the lookup functions must be extended to 64 bits in the same way as the values in
+    /// the table (see `enum_value`).
+    ///
+    /// Values are ordered by their unsigned (extended) representation regardless of the underlying
+    /// type, as they are by `System.Enum`, so negative values of signed enumerations sort last.
+    class enum_value_table
+    {
+    public:
+
+        typedef std::vector<enum_value>              value_sequence;
+        typedef value_sequence::const_iterator       value_iterator;
+        typedef core::iterator_range<value_iterator> value_range;
+
+        /// Builds the table for `enumeration`, which must be an enumeration type definition
+        explicit enum_value_table(metadata::type_def_token const& enumeration);
+
+        /// Gets the kind of the constants of the enumeration (e.g. `int32`), which is the kind of
+        /// its underlying type, or `unknown` if the enumeration has no values
+        auto underlying_kind() const -> constant::kind;
+        auto is_signed()       const -> bool;
+
+        /// Gets the values in the order in which their fields are declared
+        auto values_in_declaration_order() const -> value_range;
+
+        /// Gets the values sorted by unsigned value; values that are equal are in declaration order
+        auto values() const -> value_range;
+
+        /// Gets the values sorted by name
+        auto values_by_name() const -> value_range;
+
+        /// Finds the first declared value equal to `value`; returns an uninitialized `enum_value`
+        /// if there is no such value
+        auto find(std::uint64_t value) const -> enum_value;
+
+        /// Finds the value named `name`; returns an uninitialized `enum_value` if there is no such
+        /// value
+        auto find(core::string_reference const& name) const -> enum_value;
+
+        /// Decomposes a flags value into named values, in the manner of `System.Enum.ToString()`
+        ///
+        /// Named values are considered from largest to smallest unsigned value, and each nonzero
+        /// value whose bits are all set in the remaining bits of `value` is selected and its bits
+        /// are cleared.  The selected values are returned in ascending order.  If any bits of
+        /// `value` remain, `value` cannot be decomposed and an empty sequence is returned.  A zero
+        /// `value` decomposes to the value named zero, if there is one.
+        auto decompose(std::uint64_t value) const -> value_sequence;
+
+    private:
+
+        enum_value_table(enum_value_table const&);
+        auto operator=(enum_value_table const&) -> enum_value_table&;
+
+        core::value_initialized<constant::kind> _underlying_kind;
+        value_sequence                          _values_in_declaration_order;
+        value_sequence                          _values;
+        value_sequence                          _values_by_name;
+    };
+
+    /// Gets the table of named values of `enumeration`, building it if it has not yet been built.
+    /// Throws a `runtime_error` if `enumeration` is not an enumeration type definition.
+    auto enum_values(type const& enumeration) -> enum_value_table const&;
+
+} }
+
+#endif
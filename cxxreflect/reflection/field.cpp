@@ -11,6 +11,54 @@
 #include "cxxreflect/reflection/module.hpp"
 #include "cxxreflect/reflection/type.hpp"
 
+namespace cxxreflect { namespace reflection { namespace {
+
+    /// Computes the size of the initial data of a field whose type is `signature`
+    auto compute_initial_value_size(metadata::type_signature const& signature) -> core::size_type
+    {
+        if (signature.is_primitive())
+        {
+            switch (signature.primitive_type())
+            {
+            case metadata::element_type::boolean:
+            case metadata::element_type::i1:
+            case metadata::element_type::u1:
+                return 1;
+
+            case metadata::element_type::character:
+            case metadata::element_type::i2:
+            case metadata::element_type::u2:
+                return 2;
+
+            case metadata::element_type::i4:
+            case metadata::element_type::u4:
+            case metadata::element_type::r4:
+                return 4;
+
+            case metadata::element_type::i8:
+            case metadata::element_type::u8:
+            case metadata::element_type::r8:
+                return 8;
+
+            default:
+                break;
+            }
+        }
+        else if (signature.is_value_type() && signature.class_type().is<metadata::type_def_token>())
+        {
+            // Compilers define a value type with an explicit size for each blob of initial data:
+            metadata::class_layout_row const layout(metadata::find_class_layout(
+                signature.class_type().as<metadata::type_def_token>()));
+
+            if (layout.is_initialized() && layout.class_size() != 0)
+                return layout.class_size();
+        }
+
+        throw core::runtime_error(L"unable to determine the size of the initial value of the field");
+    }
+
+} } }
+
 namespace cxxreflect { namespace reflection {
 
     field::field()
@@ -151,6 +199,22 @@ namespace cxxreflect { namespace reflection {
         return constant(metadata::find_constant(_context->member_token()).token(), core::internal_key());
     }
 
+    auto field::initial_value() const -> core::const_byte_range
+    {
+        core::assert_initialized(*this);
+
+        metadata::field_rva_row const rva(metadata::find_field_rva(_context->member_token()));
+        if (!rva.is_initialized())
+            return core::const_byte_range();
+
+        core::size_type        const size(compute_initial_value_size(_context->member_signature().type()));
+        core::const_byte_range const data(_context->member_token().scope().map_rva(core::convert_integer(rva.rva())));
+        if (data.size() < size)
+            throw core::metadata_error(L"initial value of field extends beyond the end of its PE section");
+
+        return core::const_byte_range(data.begin(), data.begin() + size);
+    }
+
     auto field::name() const -> core::string_reference
     {
         core::assert_initialized(*this);
@@ -39,6 +39,13 @@ namespace cxxreflect { namespace reflection {
         auto metadata_token() const -> core::size_type;
         auto constant_value() const -> constant;
 
+        /// Gets the initial data of a field that has an RVA (ECMA 335-2010 II.16.3), as a view of
+        /// the PE file that contains the field.  A field without an RVA has no initial data and an
+        /// uninitialized range is returned.  The size of the data is the size of the field's type,
+        /// which must be a fixed-size primitive type or a value type defined in the same module
+        /// with an explicit class size; otherwise a `runtime_error` is thrown.
+        auto initial_value() const -> core::const_byte_range;
+
         auto name() const -> core::string_reference;
 
         auto custom_attributes() const -> detail::custom_attribute_range;
@@ -4,19 +4,149 @@
 //     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
 
 #include "cxxreflect/reflection/precompiled_headers.hpp"
+#include "cxxreflect/reflection/detail/assembly_context.hpp"
 #include "cxxreflect/reflection/detail/loader_context.hpp"
+#include "cxxreflect/reflection/detail/module_context.hpp"
 #include "cxxreflect/reflection/detail/type_hierarchy.hpp"
 #include "cxxreflect/reflection/assembly.hpp"
 #include "cxxreflect/reflection/loader.hpp"
 #include "cxxreflect/reflection/loader_configuration.hpp"
 #include "cxxreflect/reflection/type.hpp"
 
+#include <chrono>
 
 
 
 
+
+namespace cxxreflect { namespace reflection { namespace {
+
+    typedef std::chrono::high_resolution_clock realization_clock;
+
+    auto elapsed_milliseconds(realization_clock::time_point const start) -> core::size_type
+    {
+        return static_cast<core::size_type>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(realization_clock::now() - start).count());
+    }
+
+    /// Builds the member tables of `type` that are selected by `options`.  Returns `false` if any
+    /// of the tables could not be built.
+    auto realize_type(detail::loader_context const& loader,
+                      metadata::type_def_token const& type,
+                      realization_options      const  options) -> bool
+    {
+        try
+        {
+            detail::membership_handle const membership(loader.get_membership(type));
+
+            if (options.is_set(realization_option::interfaces))
+                membership.get_interfaces();
+
+            if (options.is_set(realization_option::fields))
+                membership.get_fields();
+
+            if (options.is_set(realization_option::methods))
+                membership.get_methods();
+
+            if (options.is_set(realization_option::properties))
+                membership.get_properties();
+
+            if (options.is_set(realization_option::events))
+                membership.get_events();
+
+            return true;
+        }
+        catch (core::runtime_error const&)
+        {
+            return false;
+        }
+    }
+
+} } }
+
 namespace cxxreflect { namespace reflection {
 
+    realization_statistics::realization_statistics()
+    {
+    }
+
+    realization_statistics::realization_statistics(core::size_type const assembly_count,
+                                                   core::size_type const type_count,
+                                                   core::size_type const failed_type_count,
+                                                   core::size_type const level_count,
+                                                   core::size_type const ordering_milliseconds,
+                                                   core::size_type const build_milliseconds,
+                                                   core::size_type const layer_count,
+                                                   core::size_type const entry_count,
+                                                   core::size_type const table_bytes,
+                                                   core::size_type const signature_bytes)
+        : _assembly_count(assembly_count),
+          _type_count(type_count),
+          _failed_type_count(failed_type_count),
+          _level_count(level_count),
+          _ordering_milliseconds(ordering_milliseconds),
+          _build_milliseconds(build_milliseconds),
+          _layer_count(layer_count),
+          _entry_count(entry_count),
+          _table_bytes(table_bytes),
+          _signature_bytes(signature_bytes)
+    {
+    }
+
+    auto realization_statistics::assembly_count() const -> core::size_type
+    {
+        return _assembly_count.get();
+    }
+
+    auto realization_statistics::type_count() const -> core::size_type
+    {
+        return _type_count.get();
+    }
+
+    auto realization_statistics::failed_type_count() const -> core::size_type
+    {
+        return _failed_type_count.get();
+    }
+
+    auto realization_statistics::level_count() const -> core::size_type
+    {
+        return _level_count.get();
+    }
+
+    auto realization_statistics::ordering_milliseconds() const -> core::size_type
+    {
+        return _ordering_milliseconds.get();
+    }
+
+    auto realization_statistics::build_milliseconds() const -> core::size_type
+    {
+        return _build_milliseconds.get();
+    }
+
+    auto realization_statistics::layer_count() const -> core::size_type
+    {
+        return _layer_count.get();
+    }
+
+    auto realization_statistics::entry_count() const -> core::size_type
+    {
+        return _entry_count.get();
+    }
+
+    auto realization_statistics::table_bytes() const -> core::size_type
+    {
+        return _table_bytes.get();
+    }
+
+    auto realization_statistics::signature_bytes() const -> core::size_type
+    {
+        return _signature_bytes.get();
+    }
+
+
+
+
+
     loader::loader()
     {
     }
@@ -51,6 +181,100 @@ namespace cxxreflect { namespace reflection {
         return _context->locator();
     }
 
+    auto loader::realize_all(std::vector<assembly> const& assemblies, realization_options const options) const
+        -> realization_statistics
+    {
+        core::assert_initialized(*this);
+
+        // Each type is built by a single worker, which takes the handful of types in its batch from
+        // one level.  Building a type's tables takes microseconds, so a batch amortizes the cost of
+        // claiming it without leaving too little work to balance at the end of a level:
+        core::size_type const grain_size(16);
+
+        detail::membership_statistics const initial_membership(_context->get_membership_statistics());
+
+        // First, order the types into levels by their depth in the type hierarchy.  Computing the
+        // depth resolves the base types of each type, and the ancestries are cached for the build:
+        realization_clock::time_point const ordering_start(realization_clock::now());
+
+        std::vector<std::vector<metadata::type_def_token>> levels;
+        core::size_type type_count(0);
+        core::size_type failed_type_count(0);
+
+        core::for_all(assemblies, [&](assembly const& a)
+        {
+            core::assert_initialized(a);
+            core::assert_true([&]{ return &a.context(core::internal_key()).loader() == _context.get(); });
+
+            core::for_all(a.context(core::internal_key()).modules(), [&](detail::unique_module_context const& m)
+            {
+                core::for_all(m->type_def_index(), [&](metadata::type_def_token const& type)
+                {
+                    ++type_count;
+
+                    try
+                    {
+                        core::size_type const depth(detail::get_ancestry(type).depth());
+                        if (levels.size() <= depth)
+                            levels.resize(depth + 1);
+
+                        levels[depth].push_back(type);
+                    }
+                    catch (core::runtime_error const&)
+                    {
+                        ++failed_type_count;
+                    }
+                });
+            });
+        });
+
+        core::size_type const ordering_milliseconds(elapsed_milliseconds(ordering_start));
+
+        // Then build the levels in order.  The failure count is shared by the workers of a level, so
+        // each batch counts its failures locally and adds them under the lock:
+        realization_clock::time_point const build_start(realization_clock::now());
+
+        core::recursive_mutex failure_sync;
+        core::for_all(levels, [&](std::vector<metadata::type_def_token> const& level)
+        {
+            core::for_each_dynamic_partition(
+                core::convert_integer(level.size()),
+                grain_size,
+                [&](core::size_type const first, core::size_type const last)
+            {
+                core::size_type batch_failure_count(0);
+                for (core::size_type i(first); i != last; ++i)
+                {
+                    if (!realize_type(*_context, level[i], options))
+                        ++batch_failure_count;
+                }
+
+                if (batch_failure_count == 0)
+                    return;
+
+                auto const lock(failure_sync.lock());
+                failed_type_count += batch_failure_count;
+            },
+            options.is_set(realization_option::parallel));
+        });
+
+        core::size_type const build_milliseconds(elapsed_milliseconds(build_start));
+
+        detail::membership_statistics const final_membership(_context->get_membership_statistics());
+
+        return realization_statistics(
+            core::convert_integer(assemblies.size()),
+            type_count,
+            failed_type_count,
+            core::convert_integer(levels.size()),
+            ordering_milliseconds,
+            build_milliseconds,
+            final_membership.layer_count()     - initial_membership.layer_count(),
+            final_membership.entry_count()     - initial_membership.entry_count(),
+            final_membership.table_bytes()     - initial_membership.table_bytes(),
+            final_membership.signature_bytes() - initial_membership.signature_bytes());
+    }
+
     auto loader::context(core::internal_key) const -> detail::loader_context const&
     {
         core::assert_initialized(*this);
@@ -14,6 +14,91 @@
 
 namespace cxxreflect { namespace reflection {
 
+    /// Options that control which member tables `loader::realize_all()` builds, and how
+    enum class realization_option : core::size_type
+    {
+        events     = 0x01,
+        fields     = 0x02,
+        interfaces = 0x04,
+        methods    = 0x08,
+        properties = 0x10,
+
+        all_tables = 0x1f,
+
+        /// Build the tables of independent types concurrently, if the threading model allows
+        parallel   = 0x100,
+
+        default_options = all_tables | parallel
+    };
+
+    typedef core::flags<realization_option> realization_options;
+
+    CXXREFLECT_GENERATE_SCOPED_ENUM_OPERATORS(realization_option)
+
+
+
+
+
+    /// Reports the work done by a call to `loader::realize_all()`
+    ///
+    /// The membership counts are the growth of the loader's member tables during the call, so they
+    /// do not include tables that had already been built (e.g., by an earlier call).
+    class realization_statistics
+    {
+    public:
+
+        realization_statistics();
+        realization_statistics(core::size_type assembly_count,
+                               core::size_type type_count,
+                               core::size_type failed_type_count,
+                               core::size_type level_count,
+                               core::size_type ordering_milliseconds,
+                               core::size_type build_milliseconds,
+                               core::size_type layer_count,
+                               core::size_type entry_count,
+                               core::size_type table_bytes,
+                               core::size_type signature_bytes);
+
+        /// The number of assemblies and the number of type definitions in them
+        auto assembly_count()        const -> core::size_type;
+        auto type_count()            const -> core::size_type;
+
+        /// The number of types whose base types or members could not be resolved; these types
+        /// are skipped (or partially built) and the rest of the realization continues
+        auto failed_type_count()     const -> core::size_type;
+
+        /// The number of levels in the topological order (one more than the greatest depth of a
+        /// type in the type hierarchy)
+        auto level_count()           const -> core::size_type;
+
+        /// The time spent ordering the types and the time spent building their tables
+        auto ordering_milliseconds() const -> core::size_type;
+        auto build_milliseconds()    const -> core::size_type;
+
+        /// The number of member table layers, entries, and bytes allocated by the realization
+        auto layer_count()           const -> core::size_type;
+        auto entry_count()           const -> core::size_type;
+        auto table_bytes()           const -> core::size_type;
+        auto signature_bytes()       const -> core::size_type;
+
+    private:
+
+        core::value_initialized<core::size_type> _assembly_count;
+        core::value_initialized<core::size_type> _type_count;
+        core::value_initialized<core::size_type> _failed_type_count;
+        core::value_initialized<core::size_type> _level_count;
+        core::value_initialized<core::size_type> _ordering_milliseconds;
+        core::value_initialized<core::size_type> _build_milliseconds;
+        core::value_initialized<core::size_type> _layer_count;
+        core::value_initialized<core::size_type> _entry_count;
+        core::value_initialized<core::size_type> _table_bytes;
+        core::value_initialized<core::size_type> _signature_bytes;
+    };
+
+
+
+
+
     class loader
     {
     public:
@@ -27,6 +112,21 @@ namespace cxxreflect { namespace reflection {
 
         auto locator() const -> module_locator const&;
 
+        /// Builds the member tables of every type defined in `assemblies`
+        ///
+        /// The tables of a type are built from the tables of its base type, so the types are first
+        /// ordered into levels by their depth in the type hierarchy, and the levels are built in
+        /// order:  by the time a type's tables are built, the tables of its base type are complete.
+        /// The types within a level do not depend on each other; if the `parallel` option is set,
+        /// they are built concurrently by workers that claim small batches of types as they go, so
+        /// a worker that draws a few expensive types does not hold up the rest of the level.
+        ///
+        /// The assemblies must have been loaded by this loader.  Types whose tables cannot be built
+        /// (e.g., because a base type cannot be resolved) are counted in the result and skipped.
+        auto realize_all(std::vector<assembly> const& assemblies,
+                         realization_options          options = realization_option::default_options) const
+            -> realization_statistics;
+
         auto context(core::internal_key) const -> detail::loader_context const&;
 
         auto is_initialized() const -> bool;
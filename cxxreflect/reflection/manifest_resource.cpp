@@ -0,0 +1,131 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "cxxreflect/reflection/precompiled_headers.hpp"
+#include "cxxreflect/reflection/assembly.hpp"
+#include "cxxreflect/reflection/file.hpp"
+#include "cxxreflect/reflection/manifest_resource.hpp"
+
+namespace cxxreflect { namespace reflection {
+
+    manifest_resource::manifest_resource()
+    {
+    }
+
+    manifest_resource::manifest_resource(assembly const& a, metadata::manifest_resource_token const r, core::internal_key)
+        : _assembly(&a.context(core::internal_key())), _resource(r)
+    {
+        core::assert_initialized(a);
+        core::assert_initialized(r);
+    }
+
+    auto manifest_resource::attributes() const -> metadata::manifest_resource_flags
+    {
+        core::assert_initialized(*this);
+
+        return row().flags();
+    }
+
+    auto manifest_resource::name() const -> core::string_reference
+    {
+        core::assert_initialized(*this);
+
+        return row().name();
+    }
+
+    auto manifest_resource::declaring_assembly() const -> assembly
+    {
+        core::assert_initialized(*this);
+
+        return assembly(_assembly.get(), core::internal_key());
+    }
+
+    auto manifest_resource::is_public() const -> bool
+    {
+        core::assert_initialized(*this);
+
+        return row().flags().with_mask(metadata::manifest_resource_attribute::visibility_mask)
+            == metadata::manifest_resource_attribute::public_;
+    }
+
+    auto manifest_resource::is_private() const -> bool
+    {
+        core::assert_initialized(*this);
+
+        return row().flags().with_mask(metadata::manifest_resource_attribute::visibility_mask)
+            == metadata::manifest_resource_attribute::private_;
+    }
+
+    auto manifest_resource::is_embedded() const -> bool
+    {
+        core::assert_initialized(*this);
+
+        // An embedded resource has a null implementation:
+        return !row().implementation().is_initialized();
+    }
+
+    auto manifest_resource::containing_file() const -> file
+    {
+        core::assert_initialized(*this);
+
+        metadata::implementation_token const implementation(row().implementation());
+        if (!implementation.is_initialized() || !implementation.is<metadata::file_token>())
+            return file();
+
+        return file(declaring_assembly(), implementation.as<metadata::file_token>(), core::internal_key());
+    }
+
+    auto manifest_resource::data() const -> core::const_byte_range
+    {
+        core::assert_initialized(*this);
+
+        if (!is_embedded())
+            throw core::runtime_error(L"attempted to get the data of a resource that is not embedded");
+
+        return _resource.scope().embedded_resource(row().offset());
+    }
+
+    auto manifest_resource::open() const -> core::const_byte_cursor
+    {
+        core::assert_initialized(*this);
+
+        core::const_byte_range const range(data());
+        return core::const_byte_cursor(range.begin(), range.end());
+    }
+
+    auto manifest_resource::is_initialized() const -> bool
+    {
+        return _assembly.is_initialized() && _resource.is_initialized();
+    }
+
+    auto manifest_resource::operator!() const -> bool
+    {
+        return !is_initialized();
+    }
+
+    auto operator==(manifest_resource const& lhs, manifest_resource const& rhs) -> bool
+    {
+        core::assert_initialized(lhs);
+        core::assert_initialized(rhs);
+
+        return lhs._resource == rhs._resource;
+    }
+
+    auto operator<(manifest_resource const& lhs, manifest_resource const& rhs) -> bool
+    {
+        core::assert_initialized(lhs);
+        core::assert_initialized(rhs);
+
+        return lhs._resource < rhs._resource;
+    }
+
+    auto manifest_resource::row() const -> metadata::manifest_resource_row
+    {
+        core::assert_initialized(*this);
+
+        return row_from(_resource);
+    }
+
+} }
@@ -0,0 +1,65 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#ifndef CXXREFLECT_REFLECTION_MANIFEST_RESOURCE_HPP_
+#define CXXREFLECT_REFLECTION_MANIFEST_RESOURCE_HPP_
+
+#include "cxxreflect/reflection/detail/forward_declarations.hpp"
+
+namespace cxxreflect { namespace reflection {
+
+    /// A resource listed in the manifest of an assembly (ECMA 335-2010 II.6.2.2)
+    ///
+    /// A resource is either embedded in the manifest module or stored in another file of the
+    /// assembly.  The data of an embedded resource is a view of the PE file of the manifest
+    /// module; it is never copied.
+    class manifest_resource
+    {
+    public:
+
+        manifest_resource();
+        manifest_resource(assembly const& a, metadata::manifest_resource_token r, core::internal_key);
+
+        auto attributes()         const -> metadata::manifest_resource_flags;
+        auto name()               const -> core::string_reference;
+        auto declaring_assembly() const -> assembly;
+
+        auto is_public()   const -> bool;
+        auto is_private()  const -> bool;
+        auto is_embedded() const -> bool;
+
+        /// Gets the file that contains a resource that is not embedded; an embedded resource, or a
+        /// resource that is in another assembly, has no containing file
+        auto containing_file() const -> file;
+
+        /// Gets the data of an embedded resource.  Throws a `runtime_error` if the resource is not
+        /// embedded, and a `metadata_error` if the resource extends beyond the resources of the
+        /// manifest module.
+        auto data() const -> core::const_byte_range;
+
+        /// Gets a cursor over the data of an embedded resource, for reading a large resource in
+        /// pieces.  The cursor is a view of the same bytes returned by `data()`.
+        auto open() const -> core::const_byte_cursor;
+
+        auto is_initialized() const -> bool;
+        auto operator!()      const -> bool;
+
+        friend auto operator==(manifest_resource const&, manifest_resource const&) -> bool;
+        friend auto operator< (manifest_resource const&, manifest_resource const&) -> bool;
+
+        CXXREFLECT_GENERATE_COMPARISON_OPERATORS(manifest_resource)
+        CXXREFLECT_GENERATE_SAFE_BOOL_CONVERSION(manifest_resource)
+
+    private:
+
+        auto row() const -> metadata::manifest_resource_row;
+
+        core::checked_pointer<detail::assembly_context const> _assembly;
+        metadata::manifest_resource_token                     _resource;
+    };
+
+} }
+
+#endif
@@ -5,11 +5,13 @@
 
 #include "cxxreflect/reflection/precompiled_headers.hpp"
 #include "cxxreflect/reflection/detail/loader_context.hpp"
+#include "cxxreflect/reflection/detail/module_context.hpp"
 #include "cxxreflect/reflection/detail/parameter_data.hpp"
 #include "cxxreflect/reflection/custom_attribute.hpp"
 #include "cxxreflect/reflection/method.hpp"
 #include "cxxreflect/reflection/module.hpp"
 #include "cxxreflect/reflection/parameter.hpp"
+#include "cxxreflect/reflection/property.hpp"
 #include "cxxreflect/reflection/type.hpp"
 
 namespace cxxreflect { namespace reflection {
@@ -214,23 +216,15 @@ namespace cxxreflect { namespace reflection {
     {
         core::assert_initialized(*this);
 
-        typedef metadata::token_with_arithmetic<metadata::param_token>::type incrementable_param_token;
-
-        metadata::method_def_row  const md_row(row_from(_context->member_token()));
-        incrementable_param_token first_parameter(md_row.first_parameter());
-        incrementable_param_token const last_parameter(md_row.last_parameter());
-
-        // If this method owns at least one param_row, we must test the first param_row's sequence
-        // number.  A param row with a sequence number '0' is not a real parameter; it is used to
-        // attach metadata to the return type.
-        if (first_parameter != last_parameter && row_from(first_parameter).sequence() == 0)
-            ++first_parameter;
+        detail::method_parameter_table const& table(parameter_table());
+        if (table.parameter_count() == 0)
+            return parameter_range();
 
         auto const signatures(_context->member_signature().parameters());
 
         return parameter_range(
-            parameter_iterator(*this, detail::parameter_data(first_parameter, begin(signatures), core::internal_key())),
-            parameter_iterator(*this, detail::parameter_data(last_parameter, end(signatures), core::internal_key())));
+            parameter_iterator(*this, detail::parameter_data(table.begin(), begin(signatures), core::internal_key())),
+            parameter_iterator(*this, detail::parameter_data(table.end(),   end(signatures),   core::internal_key())));
     }
 
     auto method::parameter_count() const -> core::size_type
@@ -240,22 +234,45 @@ namespace cxxreflect { namespace reflection {
         return _context->member_signature().parameter_count();
     }
 
-    auto method::return_parameter() const -> parameter
+    auto method::get_parameter(core::size_type const position) const -> parameter
     {
         core::assert_initialized(*this);
 
-        metadata::method_def_row const md_row(row_from(_context->member_token()));
-        metadata::param_token const first_parameter(md_row.first_parameter());
-        metadata::param_token const last_parameter(md_row.last_parameter());
+        detail::method_parameter_descriptor const& descriptor(parameter_table().parameter(position));
+
+        // If the method's signature is not instantiated, it is the signature from which the table
+        // was built, so we can use the recorded offset.  Otherwise, the instantiated signature has
+        // a different layout and we must walk it to find the parameter:
+        metadata::method_signature const signature(_context->member_signature());
+        if (!_context->has_instantiated_signature())
+        {
+            return parameter(
+                *this,
+                &descriptor,
+                metadata::type_signature(
+                    &signature.scope(),
+                    signature.begin_bytes() + descriptor.signature_offset(),
+                    signature.end_bytes()),
+                core::internal_key());
+        }
+
+        auto signature_it(begin(signature.parameters()));
+        std::advance(signature_it, position);
+        return parameter(*this, &descriptor, *signature_it, core::internal_key());
+    }
 
-        // This is the same check that we use in begin_parameters:  We only return a return
-        // parameter if one exists in metadata.
-        if (first_parameter == last_parameter || row_from(first_parameter).sequence() != 0)
+    auto method::return_parameter() const -> parameter
+    {
+        core::assert_initialized(*this);
+
+        // We only return a return parameter if one exists in metadata:
+        detail::method_parameter_descriptor const& descriptor(parameter_table().return_parameter());
+        if (!descriptor.token().is_initialized())
             return parameter();
 
         return parameter(
             *this,
-            first_parameter,
+            &descriptor,
             _context->member_signature().return_type(),
             core::internal_key());
     }
@@ -267,6 +284,46 @@ namespace cxxreflect { namespace reflection {
         return type(metadata::blob(_context->member_signature().return_type()), core::internal_key());
     }
 
+    auto method::associated_property() const -> property
+    {
+        core::assert_initialized(*this);
+
+        metadata::method_def_token const method_token(_context->member_token());
+
+        metadata::has_semantics_token const owner(detail::module_context::from(method_token.scope())
+            .method_semantics_index()
+            .find_owner(method_token));
+
+        if (!owner.is_initialized() || owner.table() != metadata::table_id::property)
+            return property();
+
+        metadata::property_token const property_token(owner.as<metadata::property_token>());
+
+        metadata::binding_flags const flags(is_static()
+            ? metadata::binding_attribute::all_static
+            : metadata::binding_attribute::all_instance);
+
+        auto const properties(reflected_type().properties(flags));
+        auto const it(core::find_if(properties, [&](property const& p)
+        {
+            return p.context(core::internal_key()).member_token() == property_token;
+        }));
+
+        return it != end(properties) ? *it : property();
+    }
+
+    auto method::get_method_body() const -> metadata::method_body
+    {
+        core::assert_initialized(*this);
+        return metadata::method_body(_context->member_token());
+    }
+
+    auto method::parameter_table() const -> detail::method_parameter_table const&
+    {
+        metadata::method_def_token const method_token(_context->member_token());
+        return detail::module_context::from(method_token.scope()).parameter_table(method_token);
+    }
+
     auto operator==(method const& lhs, method const& rhs) -> bool
     {
         core::assert_initialized(lhs);
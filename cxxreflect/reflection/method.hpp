@@ -60,13 +60,24 @@ namespace cxxreflect { namespace reflection {
         auto parameters()        const -> parameter_range;
         auto parameter_count()   const -> core::size_type;
 
+        /// Gets the parameter at the zero-based `position`; throws a `logic_error` if `position`
+        /// is out of range
+        auto get_parameter(core::size_type position) const -> parameter;
+
         auto return_parameter() const -> parameter;
         auto return_type()      const -> type;
 
+        /// Gets the property for which this method is an accessor, or an uninitialized property if
+        /// this method is not a property accessor
+        auto associated_property() const -> property;
+
+        /// Gets the body of this method, which is read in place from the module that defines the
+        /// method; the body is uninitialized if the method has no body (e.g. if it is abstract)
+        auto get_method_body() const -> metadata::method_body;
+
         // GetBaseDefinition          -- Non-constructor only
         // GetGenericArguments
         // GetGenericMethodDefinition -- Non-constructor only
-        // GetMethodBody
         // GetMethodImplementationFlags
         
         // IsDefined
@@ -95,7 +106,8 @@ namespace cxxreflect { namespace reflection {
 
     private:
 
-        auto row() const -> metadata::method_def_row;
+        auto row()             const -> metadata::method_def_row;
+        auto parameter_table() const -> detail::method_parameter_table const&;
 
         metadata::type_def_or_signature                         _reflected_type;
         core::checked_pointer<detail::method_table_entry const> _context;
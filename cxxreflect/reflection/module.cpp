@@ -5,16 +5,103 @@
 
 #include "cxxreflect/reflection/precompiled_headers.hpp"
 #include "cxxreflect/reflection/detail/assembly_context.hpp"
+#include "cxxreflect/reflection/detail/loader_context.hpp"
 #include "cxxreflect/reflection/detail/module_context.hpp"
 #include "cxxreflect/reflection/assembly.hpp"
 #include "cxxreflect/reflection/loader.hpp"
 #include "cxxreflect/reflection/module.hpp"
+#include "cxxreflect/reflection/module_visitor.hpp"
 #include "cxxreflect/reflection/type.hpp"
 
 
 
 
 
+namespace cxxreflect { namespace reflection { namespace {
+
+    auto visit_custom_attributes(module_visitor& visitor, metadata::has_custom_attribute_token const& parent) -> void
+    {
+        if (!visitor.elements().is_set(module_visitor_element::custom_attributes))
+            return;
+
+        core::for_all(metadata::find_custom_attributes(parent), [&](metadata::custom_attribute_row const& attribute)
+        {
+            visitor.visit_custom_attribute(attribute);
+        });
+    }
+
+    auto visit_method(module_visitor& visitor, metadata::method_def_row const& method) -> void
+    {
+        if (!visitor.begin_method(method))
+            return;
+
+        visit_custom_attributes(visitor, method.token());
+
+        if (visitor.elements().is_set(module_visitor_element::parameters))
+        {
+            metadata::database const& scope(method.token().scope());
+            metadata::param_row_range const parameters(
+                metadata::param_row_iterator(&scope, method.first_parameter().index()),
+                metadata::param_row_iterator(&scope, method.last_parameter().index()));
+
+            core::for_all(parameters, [&](metadata::param_row const& parameter)
+            {
+                visitor.visit_parameter(parameter);
+                visit_custom_attributes(visitor, parameter.token());
+            });
+        }
+
+        visitor.end_method(method);
+    }
+
+    auto visit_type(module_visitor& visitor, metadata::type_def_row const& type) -> void
+    {
+        if (!visitor.begin_type(type))
+            return;
+
+        visit_custom_attributes(visitor, type.token());
+
+        module_visitor_elements const elements(visitor.elements());
+        if (elements.is_set(module_visitor_element::fields))
+        {
+            core::for_all(metadata::find_fields(type.token()), [&](metadata::field_row const& field)
+            {
+                visitor.visit_field(field);
+                visit_custom_attributes(visitor, field.token());
+            });
+        }
+
+        if (elements.is_set(module_visitor_element::methods))
+        {
+            core::for_all(metadata::find_method_defs(type.token()), [&](metadata::method_def_row const& method)
+            {
+                visit_method(visitor, method);
+            });
+        }
+
+        if (elements.is_set(module_visitor_element::properties))
+        {
+            core::for_all(metadata::find_properties(type.token()), [&](metadata::property_row const& property)
+            {
+                visitor.visit_property(property);
+                visit_custom_attributes(visitor, property.token());
+            });
+        }
+
+        if (elements.is_set(module_visitor_element::events))
+        {
+            core::for_all(metadata::find_events(type.token()), [&](metadata::event_row const& event)
+            {
+                visitor.visit_event(event);
+                visit_custom_attributes(visitor, event.token());
+            });
+        }
+
+        visitor.end_type(type);
+    }
+
+} } }
+
 namespace cxxreflect { namespace reflection { namespace detail {
 
     auto module_type_iterator_constructor::operator()(std::nullptr_t, detail::module_type_def_index_iterator const it) const
@@ -27,6 +114,45 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
 namespace cxxreflect { namespace reflection {
 
+    module_preresolution_result::module_preresolution_result()
+    {
+    }
+
+    module_preresolution_result::module_preresolution_result(core::size_type const type_ref_count,
+                                                             core::size_type const unresolved_type_ref_count,
+                                                             core::size_type const member_ref_count,
+                                                             core::size_type const unresolved_member_ref_count)
+        : _type_ref_count(type_ref_count),
+          _unresolved_type_ref_count(unresolved_type_ref_count),
+          _member_ref_count(member_ref_count),
+          _unresolved_member_ref_count(unresolved_member_ref_count)
+    {
+    }
+
+    auto module_preresolution_result::type_ref_count() const -> core::size_type
+    {
+        return _type_ref_count.get();
+    }
+
+    auto module_preresolution_result::unresolved_type_ref_count() const -> core::size_type
+    {
+        return _unresolved_type_ref_count.get();
+    }
+
+    auto module_preresolution_result::member_ref_count() const -> core::size_type
+    {
+        return _member_ref_count.get();
+    }
+
+    auto module_preresolution_result::unresolved_member_ref_count() const -> core::size_type
+    {
+        return _unresolved_member_ref_count.get();
+    }
+
+
+
+
+
     module::module()
     {
     }
@@ -91,6 +217,46 @@ namespace cxxreflect { namespace reflection {
         return type(t, core::internal_key());
     }
 
+    auto module::preresolve(bool const parallel) const -> module_preresolution_result
+    {
+        core::assert_initialized(*this);
+        return _context->preresolve(parallel);
+    }
+
+    auto module::visit(module_visitor& visitor, bool const parallel) const -> void
+    {
+        core::assert_initialized(*this);
+
+        core::for_each_partition(type_def_count(), [&](core::size_type const first, core::size_type const last)
+        {
+            visit(visitor, first, last);
+        }, parallel);
+    }
+
+    auto module::visit(module_visitor& visitor, core::size_type const first, core::size_type const last) const -> void
+    {
+        core::assert_initialized(*this);
+        core::assert_true([&]{ return first <= last && last <= type_def_count(); });
+
+        metadata::database const& scope(_context->database());
+        detail::loader_context const& loader(_context->assembly().loader());
+
+        for (core::size_type index(first); index != last; ++index)
+        {
+            metadata::type_def_token const type(&scope, metadata::table_id::type_def, index);
+            if (loader.is_filtered_type(type))
+                continue;
+
+            visit_type(visitor, row_from(type));
+        }
+    }
+
+    auto module::type_def_count() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+        return _context->database().tables()[metadata::table_id::type_def].row_count();
+    }
+
     auto module::context(core::internal_key) const -> detail::module_context const&
     {
         core::assert_initialized(*this);
@@ -25,6 +25,37 @@ namespace cxxreflect { namespace reflection { namespace detail {
 
 namespace cxxreflect { namespace reflection {
 
+    /// The result of a `module::preresolve()` operation
+    ///
+    /// Reports the number of type and member references in the module and how many of them could
+    /// not be resolved (e.g. because the referenced assembly could not be located).
+    class module_preresolution_result
+    {
+    public:
+
+        module_preresolution_result();
+        module_preresolution_result(core::size_type type_ref_count,
+                                    core::size_type unresolved_type_ref_count,
+                                    core::size_type member_ref_count,
+                                    core::size_type unresolved_member_ref_count);
+
+        auto type_ref_count()              const -> core::size_type;
+        auto unresolved_type_ref_count()   const -> core::size_type;
+        auto member_ref_count()            const -> core::size_type;
+        auto unresolved_member_ref_count() const -> core::size_type;
+
+    private:
+
+        core::value_initialized<core::size_type> _type_ref_count;
+        core::value_initialized<core::size_type> _unresolved_type_ref_count;
+        core::value_initialized<core::size_type> _member_ref_count;
+        core::value_initialized<core::size_type> _unresolved_member_ref_count;
+    };
+
+
+
+
+
     class module
     {
     public:
@@ -48,6 +79,29 @@ namespace cxxreflect { namespace reflection {
         auto find_type(core::string_reference const& namespace_name,
                        core::string_reference const& simple_name) const -> type;
 
+        /// Eagerly resolves every type reference and member reference in this module
+        ///
+        /// References are normally resolved lazily, the first time they are used.  This populates
+        /// the module's resolution caches up front so that later operations do not pay the cost
+        /// of resolution.  If `parallel` is `true`, the reference tables are partitioned across
+        /// worker threads.  References that cannot be resolved are counted, not reported as errors;
+        /// a reference of a form that the loader does not support raises an `assertion_error`.
+        auto preresolve(bool parallel = true) const -> module_preresolution_result;
+
+        /// Visits the metadata of the type definitions in this module; see `module_visitor`
+        ///
+        /// If `parallel` is `true`, the TypeDef table is partitioned across worker threads and the
+        /// visitor may be called concurrently for different types.
+        auto visit(module_visitor& visitor, bool parallel = false) const -> void;
+
+        /// Visits the type definitions whose TypeDef row indices are in the range [first, last)
+        ///
+        /// This allows a caller to split a traversal across threads itself, for example to give each
+        /// thread its own visitor.  The row indices of the module's types are [0, type_def_count()).
+        auto visit(module_visitor& visitor, core::size_type first, core::size_type last) const -> void;
+
+        auto type_def_count() const -> core::size_type;
+
         auto context(core::internal_key) const -> detail::module_context const&;
 
         auto is_initialized() const -> bool;
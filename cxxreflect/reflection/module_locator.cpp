@@ -182,21 +182,62 @@ namespace cxxreflect { namespace reflection {
         core::assert_true([&]{ return !sequence.empty(); });
     }
 
+    search_path_module_locator::search_path_module_locator(search_path_module_locator const& other)
+    {
+        auto const lock(other._sync.lock());
+
+        _sequence   = other._sequence;
+        _index      = other._index;
+        _is_indexed = other._is_indexed;
+        _assemblies = other._assemblies;
+    }
+
+    auto search_path_module_locator::operator=(search_path_module_locator other) -> search_path_module_locator&
+    {
+        // Since we've copied the argument into this function, there's no need to synchronize here;
+        // we have the sole reference to the object.
+        std::swap(other._sequence,   _sequence);
+        std::swap(other._index,      _index);
+        std::swap(other._is_indexed, _is_indexed);
+        std::swap(other._assemblies, _assemblies);
+
+        return *this;
+    }
+
     auto search_path_module_locator::locate_assembly(assembly_name const& target_assembly) const
         -> module_location
     {
+        auto const lock(_sync.lock());
+
+        core::string const simple_name(core::to_lowercase(target_assembly.simple_name()));
+
+        // Resolution-heavy workloads locate the same assemblies (and fail to locate the same
+        // assemblies) many times, so we remember every result:
+        auto const cached(_assemblies.find(simple_name));
+        if (cached != _assemblies.end())
+            return cached->second.empty() ? module_location() : module_location(cached->second.c_str());
+
+        realize_index();
+
+        // The directories are searched in order, and within each directory a .dll is preferred to
+        // an .exe, just as if we probed for each file:
+        core::string path;
+
         std::array<core::const_character_iterator, 2> const extensions = { L".dll", L".exe" };
-        for (auto dir_it(begin(_sequence)); dir_it != end(_sequence); ++dir_it)
+        for (core::size_type i(0); i != _sequence.size() && path.empty(); ++i)
         {
             for (auto ext_it(begin(extensions)); ext_it != end(extensions); ++ext_it)
             {
-                core::string path(*dir_it + L"\\" + target_assembly.simple_name() + *ext_it);
-                if (core::externals::file_exists(path.c_str()))
-                    return module_location(path.c_str());
+                if (_index[i].find(simple_name + *ext_it) == _index[i].end())
+                    continue;
+
+                path = _sequence[i] + L"\\" + target_assembly.simple_name() + *ext_it;
+                break;
             }
         }
 
-        return module_location();
+        _assemblies.insert(std::make_pair(simple_name, path));
+        return path.empty() ? module_location() : module_location(path.c_str());
     }
 
     auto search_path_module_locator::locate_namespace(core::string_reference const& namespace_name) const
@@ -224,4 +265,39 @@ namespace cxxreflect { namespace reflection {
         return module_location();
     }
 
+    auto search_path_module_locator::refresh() const -> void
+    {
+        auto const lock(_sync.lock());
+
+        _index.clear();
+        _is_indexed.get() = false;
+        _assemblies.clear();
+    }
+
+    auto search_path_module_locator::realize_index() const -> void
+    {
+        auto const lock(_sync.lock());
+
+        if (_is_indexed.get())
+            return;
+
+        directory_index index;
+        index.reserve(_sequence.size());
+        core::for_all(_sequence, [&](core::string const& directory)
+        {
+            std::vector<core::string> const files(core::externals::enumerate_files(directory.c_str()));
+
+            file_name_set names;
+            std::transform(begin(files), end(files), std::inserter(names, end(names)), [](core::string const& file_name)
+            {
+                return core::to_lowercase(file_name);
+            });
+
+            index.push_back(std::move(names));
+        });
+
+        _index = std::move(index);
+        _is_indexed.get() = true;
+    }
+
 } }
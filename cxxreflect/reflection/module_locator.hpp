@@ -159,14 +159,26 @@ namespace cxxreflect { namespace reflection {
 
 
 
+    /// A module locator that searches a sequence of directories for assemblies
+    ///
+    /// Each directory is enumerated once, when the first assembly is located, into an index of
+    /// lowercase file names, so locating an assembly does not touch the file system.  The result of
+    /// each lookup, including a failed lookup, is cached by lowercase simple name.  Files added to
+    /// or removed from the directories afterwards are not seen until `refresh()` is called.
     class search_path_module_locator
     {
     public:
 
-        typedef std::vector<core::string> search_path_sequence;
+        typedef std::vector<core::string>             search_path_sequence;
+        typedef std::set<core::string>                file_name_set;
+        typedef std::vector<file_name_set>            directory_index;
+        typedef std::map<core::string, core::string>  path_map;
 
         search_path_module_locator(search_path_sequence const& sequence);
 
+        search_path_module_locator(search_path_module_locator const&);
+        auto operator=(search_path_module_locator) -> search_path_module_locator&;
+
         auto locate_assembly(assembly_name const& target_assembly) const -> module_location;
 
         auto locate_namespace(core::string_reference const& namespace_name) const -> module_location;
@@ -174,9 +186,23 @@ namespace cxxreflect { namespace reflection {
         auto locate_module(assembly_name          const& requesting_assembly,
                            core::string_reference const& module_name) const -> module_location;
 
+        /// Discards the directory index and the cached lookups; the directories are enumerated
+        /// again when the next assembly is located
+        auto refresh() const -> void;
+
     private:
 
-        search_path_sequence _sequence;
+        auto realize_index() const -> void;
+
+        search_path_sequence                  _sequence;
+
+        directory_index               mutable _index;
+        core::value_initialized<bool> mutable _is_indexed;
+
+        // Maps a lowercase simple name to the path of the assembly; a failed lookup maps to an
+        // empty path
+        path_map                      mutable _assemblies;
+        core::recursive_mutex         mutable _sync;
     };
 
 } }
@@ -0,0 +1,67 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "cxxreflect/reflection/precompiled_headers.hpp"
+#include "cxxreflect/reflection/module_visitor.hpp"
+
+
+
+
+
+namespace cxxreflect { namespace reflection {
+
+    module_visitor::module_visitor(module_visitor_elements const elements)
+        : _elements(elements)
+    {
+    }
+
+    module_visitor::~module_visitor()
+    {
+    }
+
+    auto module_visitor::elements() const -> module_visitor_elements
+    {
+        return _elements;
+    }
+
+    auto module_visitor::begin_type(metadata::type_def_row const&) -> bool
+    {
+        return true;
+    }
+
+    auto module_visitor::end_type(metadata::type_def_row const&) -> void
+    {
+    }
+
+    auto module_visitor::begin_method(metadata::method_def_row const&) -> bool
+    {
+        return true;
+    }
+
+    auto module_visitor::end_method(metadata::method_def_row const&) -> void
+    {
+    }
+
+    auto module_visitor::visit_field(metadata::field_row const&) -> void
+    {
+    }
+
+    auto module_visitor::visit_parameter(metadata::param_row const&) -> void
+    {
+    }
+
+    auto module_visitor::visit_property(metadata::property_row const&) -> void
+    {
+    }
+
+    auto module_visitor::visit_event(metadata::event_row const&) -> void
+    {
+    }
+
+    auto module_visitor::visit_custom_attribute(metadata::custom_attribute_row const&) -> void
+    {
+    }
+
+} }
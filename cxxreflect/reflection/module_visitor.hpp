@@ -0,0 +1,93 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#ifndef CXXREFLECT_REFLECTION_MODULE_VISITOR_HPP_
+#define CXXREFLECT_REFLECTION_MODULE_VISITOR_HPP_
+
+#include "cxxreflect/reflection/detail/forward_declarations.hpp"
+
+
+
+
+
+namespace cxxreflect { namespace reflection {
+
+    /// The kinds of elements that a `module_visitor` visits within each type definition
+    enum class module_visitor_element : core::size_type
+    {
+        fields            = 0x01,
+        methods           = 0x02,
+        parameters        = 0x04,
+        properties        = 0x08,
+        events            = 0x10,
+        custom_attributes = 0x20,
+
+        all               = 0x3f
+    };
+
+    typedef core::flags<module_visitor_element> module_visitor_elements;
+
+    CXXREFLECT_GENERATE_SCOPED_ENUM_OPERATORS(module_visitor_element)
+
+
+
+
+
+    /// A push-based visitor over the metadata of a module
+    ///
+    /// Enumerating a module through the handle types (`type`, `method`, `parameter`, and so on)
+    /// constructs a handle and an iterator range at every step, and many handle operations resolve
+    /// or instantiate signatures.  Tools that need to see every element of a module (writers,
+    /// indexers, and the like) usually only need the raw metadata.  A visitor is called with the
+    /// metadata rows of each element instead; rows are lightweight views over the database that
+    /// require no allocation.
+    ///
+    /// The type definitions of a module are visited in table order; types that are filtered by the
+    /// loader configuration are skipped.  For each type, `begin_type` is called, then the elements
+    /// of the type are visited in table order:  fields, methods (and within each method, its
+    /// parameters), properties, and events.  The custom attributes of each element are visited
+    /// immediately after the element.  The `end_type` and `end_method` callbacks are called if and
+    /// only if the corresponding `begin_` callback returned `true`; returning `false` skips the
+    /// contents of the type or method.  Only the kinds of elements requested by the visitor (see
+    /// `elements()`) are visited; skipping a kind of element skips the table lookups it requires.
+    ///
+    /// A module may be traversed in parallel (see `module::visit()`).  In that case, callbacks for
+    /// different types may be made concurrently on different threads, so the visitor must be
+    /// thread-safe; all of the callbacks for one type are made on one thread, in order.
+    class module_visitor
+    {
+    public:
+
+        virtual ~module_visitor();
+
+        auto elements() const -> module_visitor_elements;
+
+        virtual auto begin_type(metadata::type_def_row const& type) -> bool;
+        virtual auto end_type  (metadata::type_def_row const& type) -> void;
+
+        virtual auto begin_method(metadata::method_def_row const& method) -> bool;
+        virtual auto end_method  (metadata::method_def_row const& method) -> void;
+
+        virtual auto visit_field           (metadata::field_row            const& field    ) -> void;
+        virtual auto visit_parameter       (metadata::param_row            const& parameter) -> void;
+        virtual auto visit_property        (metadata::property_row         const& property ) -> void;
+        virtual auto visit_event           (metadata::event_row            const& event    ) -> void;
+        virtual auto visit_custom_attribute(metadata::custom_attribute_row const& attribute) -> void;
+
+    protected:
+
+        explicit module_visitor(module_visitor_elements elements = module_visitor_element::all);
+
+    private:
+
+        module_visitor(module_visitor const&);
+        auto operator=(module_visitor const&) -> module_visitor&;
+
+        module_visitor_elements _elements;
+    };
+
+} }
+
+#endif
@@ -24,25 +24,24 @@ namespace cxxreflect { namespace reflection {
                          core::internal_key)
         : _reflected_type(declaring_method.reflected_type().context(core::internal_key())),
           _method(&declaring_method.context(core::internal_key())),
-          _parameter(data.token()),
+          _descriptor(&data.descriptor()),
           _signature(data.signature())
     {
         core::assert_initialized(declaring_method);
-        core::assert_initialized(data.token());
         core::assert_initialized(data.signature());
     }
 
-    parameter::parameter(method                   const& declaring_method,
-                         metadata::param_token    const& token,
-                         metadata::type_signature const& signature,
+    parameter::parameter(method                              const& declaring_method,
+                         detail::method_parameter_descriptor const* const descriptor,
+                         metadata::type_signature            const& signature,
                          core::internal_key)
         : _reflected_type(declaring_method.reflected_type().context(core::internal_key())),
           _method(&declaring_method.context(core::internal_key())),
-          _parameter(token),
+          _descriptor(descriptor),
           _signature(signature)
     {
         core::assert_initialized(declaring_method);
-        core::assert_initialized(token);
+        core::assert_not_null(descriptor);
         core::assert_initialized(signature);
     }
 
@@ -50,14 +49,14 @@ namespace cxxreflect { namespace reflection {
     {
         core::assert_initialized(*this);
 
-        return row().flags();
+        return _descriptor->flags();
     }
 
     auto parameter::is_in() const -> bool
     {
         core::assert_initialized(*this);
 
-        return row().flags().is_set(metadata::parameter_attribute::in);
+        return _descriptor->flags().is_set(metadata::parameter_attribute::in);
     }
 
     auto parameter::is_lcid() const -> bool
@@ -71,14 +70,14 @@ namespace cxxreflect { namespace reflection {
     {
         core::assert_initialized(*this);
 
-        return row().flags().is_set(metadata::parameter_attribute::optional);
+        return _descriptor->flags().is_set(metadata::parameter_attribute::optional);
     }
 
     auto parameter::is_out() const -> bool
     {
         core::assert_initialized(*this);
 
-        return row().flags().is_set(metadata::parameter_attribute::out);
+        return _descriptor->flags().is_set(metadata::parameter_attribute::out);
     }
 
     auto parameter::is_ret_val() const -> bool
@@ -99,13 +98,19 @@ namespace cxxreflect { namespace reflection {
     {
         core::assert_initialized(*this);
 
-        return row().token().value();
+        if (!_descriptor->token().is_initialized())
+            return 0;
+
+        return _descriptor->token().value();
     }
 
     auto parameter::name() const -> core::string_reference
     {
         core::assert_initialized(*this);
 
+        if (!_descriptor->token().is_initialized())
+            return core::string_reference();
+
         return row().name();
     }
 
@@ -121,14 +126,17 @@ namespace cxxreflect { namespace reflection {
         core::assert_initialized(*this);
 
         // The sequence is one-based, but we want to return a zero-based position:
-        return row().sequence() - 1;
+        return _descriptor->sequence() - 1;
     }
 
     auto parameter::default_value() const -> constant
     {
         core::assert_initialized(*this);
 
-        metadata::constant_row const& row(metadata::find_constant(_parameter));
+        if (!_descriptor->has_default())
+            return constant();
+
+        metadata::constant_row const& row(metadata::find_constant(_descriptor->token()));
         if (!row.is_initialized())
             return constant();
 
@@ -139,12 +147,15 @@ namespace cxxreflect { namespace reflection {
     {
         core::assert_initialized(*this);
 
-        return custom_attribute::get_for(_parameter, core::internal_key());
+        if (!_descriptor->token().is_initialized())
+            return detail::custom_attribute_range();
+
+        return custom_attribute::get_for(_descriptor->token(), core::internal_key());
     }
 
     auto parameter::is_initialized() const -> bool
     {
-        return _parameter.is_initialized() && _signature.is_initialized();
+        return _descriptor.is_initialized() && _signature.is_initialized();
     }
 
     auto parameter::operator!() const -> bool
@@ -157,7 +168,7 @@ namespace cxxreflect { namespace reflection {
         core::assert_initialized(lhs);
         core::assert_initialized(rhs);
 
-        return lhs._parameter == rhs._parameter;
+        return lhs._descriptor.get() == rhs._descriptor.get();
     }
 
     auto operator<(parameter const& lhs, parameter const& rhs) -> bool
@@ -165,14 +176,14 @@ namespace cxxreflect { namespace reflection {
         core::assert_initialized(lhs);
         core::assert_initialized(rhs);
 
-        return lhs._parameter < rhs._parameter;
+        return lhs._descriptor.get() < rhs._descriptor.get();
     }
 
     auto parameter::self_reference(core::internal_key) const -> metadata::param_token
     {
         core::assert_initialized(*this);
 
-        return _parameter;
+        return _descriptor->token();
     }
 
     auto parameter::self_signature(core::internal_key) const -> metadata::type_signature
@@ -186,7 +197,7 @@ namespace cxxreflect { namespace reflection {
     {
         core::assert_initialized(*this);
 
-        return row_from(_parameter);
+        return row_from(_descriptor->token());
     }
 
 } }
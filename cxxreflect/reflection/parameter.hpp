@@ -24,9 +24,9 @@ namespace cxxreflect { namespace reflection {
                   detail::parameter_data const& data,
                   core::internal_key);
 
-        parameter(method                   const& declaring_method,
-                  metadata::param_token    const& token,
-                  metadata::type_signature const& signature,
+        parameter(method                              const& declaring_method,
+                  detail::method_parameter_descriptor const* descriptor,
+                  metadata::type_signature            const& signature,
                   core::internal_key);
 
         auto self_reference(core::internal_key) const -> metadata::param_token;
@@ -42,8 +42,10 @@ namespace cxxreflect { namespace reflection {
 
         auto declaring_method() const -> method;
 
+        /// Gets the token of the parameter's Param row, or zero if the parameter has no Param row
         auto metadata_token() const -> core::size_type;
 
+        /// Gets the name of the parameter, or an empty string if the parameter has no Param row
         auto name() const -> core::string_reference;
 
         auto parameter_type() const -> type;
@@ -66,10 +68,10 @@ namespace cxxreflect { namespace reflection {
 
         auto row() const -> metadata::param_row;
 
-        metadata::type_def_or_signature                         _reflected_type;
-        core::checked_pointer<detail::method_table_entry const> _method;
-        metadata::param_token                                   _parameter;
-        metadata::type_signature                                _signature;
+        metadata::type_def_or_signature                                  _reflected_type;
+        core::checked_pointer<detail::method_table_entry          const> _method;
+        core::checked_pointer<detail::method_parameter_descriptor const> _descriptor;
+        metadata::type_signature                                         _signature;
     };
 
 } }
@@ -6,6 +6,7 @@
 #include "cxxreflect/reflection/precompiled_headers.hpp"
 #include "cxxreflect/reflection/detail/loader_context.hpp"
 #include "cxxreflect/reflection/detail/member_iterator.hpp"
+#include "cxxreflect/reflection/detail/module_context.hpp"
 #include "cxxreflect/reflection/constant.hpp"
 #include "cxxreflect/reflection/custom_attribute.hpp"
 #include "cxxreflect/reflection/method.hpp"
@@ -18,13 +19,9 @@ namespace cxxreflect { namespace reflection { namespace {
     auto find_method_token(metadata::property_token const& property, metadata::method_semantics_attribute const desired_semantics)
         -> metadata::method_def_token
     {
-       auto const range(metadata::find_method_semantics(property));
-       auto const result(std::find_if(begin(range), end(range), [&](metadata::method_semantics_row const& s)
-       {
-           return s.semantics() == desired_semantics;
-       }));
-
-       return result != end(range) ? result->method() : metadata::method_def_token();
+        return detail::module_context::from(property.scope())
+            .method_semantics_index()
+            .find_accessor(property, desired_semantics);
     }
 
     auto find_method(property const& property, metadata::method_semantics_attribute const desired_semantics) -> method
@@ -16,15 +16,19 @@
 #include "cxxreflect/reflection/assembly_name.hpp"
 #include "cxxreflect/reflection/constant.hpp"
 #include "cxxreflect/reflection/custom_attribute.hpp"
+#include "cxxreflect/reflection/custom_attribute_argument.hpp"
 #include "cxxreflect/reflection/custom_modifier_iterator.hpp"
+#include "cxxreflect/reflection/enum_value_table.hpp"
 #include "cxxreflect/reflection/field.hpp"
 #include "cxxreflect/reflection/file.hpp"
 #include "cxxreflect/reflection/guid.hpp"
 #include "cxxreflect/reflection/loader.hpp"
 #include "cxxreflect/reflection/loader_configuration.hpp"
+#include "cxxreflect/reflection/manifest_resource.hpp"
 #include "cxxreflect/reflection/method.hpp"
 #include "cxxreflect/reflection/module.hpp"
 #include "cxxreflect/reflection/module_locator.hpp"
+#include "cxxreflect/reflection/module_visitor.hpp"
 #include "cxxreflect/reflection/parameter.hpp"
 #include "cxxreflect/reflection/property.hpp"
 #include "cxxreflect/reflection/type.hpp"
@@ -9,12 +9,15 @@
 #include "cxxreflect/reflection/detail/member_iterator.hpp"
 #include "cxxreflect/reflection/detail/membership.hpp"
 #include "cxxreflect/reflection/detail/module_context.hpp"
+#include "cxxreflect/reflection/detail/type_hierarchy.hpp"
 #include "cxxreflect/reflection/detail/type_name_builder.hpp"
 #include "cxxreflect/reflection/detail/type_policy.hpp"
+#include "cxxreflect/reflection/detail/type_policy_dispatch.hpp"
 #include "cxxreflect/reflection/detail/type_resolution.hpp"
 #include "cxxreflect/reflection/assembly.hpp"
 #include "cxxreflect/reflection/custom_attribute.hpp"
 #include "cxxreflect/reflection/custom_modifier_iterator.hpp"
+#include "cxxreflect/reflection/field.hpp"
 #include "cxxreflect/reflection/loader.hpp"
 #include "cxxreflect/reflection/method.hpp"
 #include "cxxreflect/reflection/module.hpp"
@@ -27,6 +30,23 @@
 
 namespace cxxreflect { namespace reflection { namespace {
 
+    /// Gets the only member in `members`, or an uninitialized member if `members` is empty
+    ///
+    /// Throws a `runtime_error` with the message `error` if `members` has more than one member.
+    template <typename Range>
+    auto find_unique_member(Range const& members, wchar_t const* const error) -> typename Range::value_type
+    {
+        auto const it(begin(members));
+        if (it == end(members))
+            return typename Range::value_type();
+
+        if (std::next(it) != end(members))
+            throw core::runtime_error(error);
+
+        return *it;
+    }
+
+
     template <typename T>
     auto core_filter_member(metadata::binding_flags const filter, bool const is_declaring_type, T const& current) -> bool
     {
@@ -85,6 +105,25 @@ namespace cxxreflect { namespace reflection { namespace {
         return false;
     }
 
+    /// Appends the name of a resolved type to `buffer`; the name is cached by the loader
+    auto format_type_name_into(core::string&                          buffer,
+                               metadata::type_def_or_signature const& t,
+                               type_name_kind                   const kind) -> void
+    {
+        core::string_reference const name(detail::loader_context::from(t.scope()).get_type_name(t, kind));
+        buffer.append(name.begin(), name.end());
+    }
+
+    /// Appends the name of an unresolved type to `buffer`
+    ///
+    /// Unresolved types do not have canonical type ids, so their names are not cached.
+    auto format_type_name_into(core::string&                              buffer,
+                               metadata::type_def_ref_or_signature const& t,
+                               type_name_kind                       const kind) -> void
+    {
+        buffer += detail::type_name_builder::build_type_name(t, kind);
+    }
+
 } } }
 
 namespace cxxreflect { namespace reflection { namespace detail {
@@ -99,43 +138,53 @@ namespace cxxreflect { namespace reflection { namespace detail {
     template <typename T, typename D>
     auto common_type_functionality<T, D>::assembly_qualified_name() const -> core::string
     {
-        core::assert_initialized(*this);
-        return type_name_builder::build_type_name(_token, type_name_builder::mode::assembly_qualified_name);
+        core::string result;
+        format_name_into(result, type_name_kind::assembly_qualified_name);
+        return result;
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::full_name() const -> core::string
+    {
+        core::string result;
+        format_name_into(result, type_name_kind::full_name);
+        return result;
+    }
+
+    template <typename T, typename D>
+    auto common_type_functionality<T, D>::format_name_into(core::string& buffer, type_name_kind const kind) const -> void
     {
         core::assert_initialized(*this);
-        return type_name_builder::build_type_name(_token, type_name_builder::mode::full_name);
+        format_type_name_into(buffer, _token, kind);
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::simple_name() const -> core::string
     {
-        core::assert_initialized(*this);
-        return type_name_builder::build_type_name(_token, type_name_builder::mode::simple_name);
+        core::string result;
+        format_name_into(result, type_name_kind::simple_name);
+        return result;
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::primary_name() const -> core::string_reference
     {
         core::assert_initialized(*this);
-        return _policy->primary_name(_token);
+        return type_policy_dispatch::primary_name(_policy_kind.get(), _token);
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::namespace_name() const -> core::string_reference
     {
         core::assert_initialized(*this);
-        return _policy->namespace_name(_token);
+        return type_policy_dispatch::namespace_name(_policy_kind.get(), _token);
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::declaring_type() const -> derived_type
     {
         core::assert_initialized(*this);
-        return derived_type(_policy->declaring_type(_token), core::internal_key());
+        return derived_type(type_policy_dispatch::declaring_type(_policy_kind.get(), _token), core::internal_key());
     }
 
     template <typename T, typename D>
@@ -161,48 +210,48 @@ namespace cxxreflect { namespace reflection { namespace detail {
     auto common_type_functionality<T, D>::is_array() const -> bool
     {
         core::assert_initialized(*this);
-        return _policy->is_array(_token);
+        return type_policy_dispatch::is_array(_policy_kind.get(), _token);
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::is_by_ref() const -> bool
     {
         core::assert_initialized(*this);
-        return _policy->is_by_ref(_token);
+        return type_policy_dispatch::is_by_ref(_policy_kind.get(), _token);
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::is_generic_type_instantiation() const -> bool
     {
         core::assert_initialized(*this);
-        return _policy->is_generic_type_instantiation(_token);
+        return type_policy_dispatch::is_generic_type_instantiation(_policy_kind.get(), _token);
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::is_nested() const -> bool
     {
         core::assert_initialized(*this);
-        return _policy->is_nested(_token);
+        return type_policy_dispatch::is_nested(_policy_kind.get(), _token);
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::is_pointer() const -> bool
     {
         core::assert_initialized(*this);
-        return _policy->is_pointer(_token);
+        return type_policy_dispatch::is_pointer(_policy_kind.get(), _token);
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::is_primitive() const -> bool
     {
         core::assert_initialized(*this);
-        return _policy->is_primitive(_token);
+        return type_policy_dispatch::is_primitive(_policy_kind.get(), _token);
     }
 
     template <typename T, typename D>
     auto common_type_functionality<T, D>::is_initialized() const -> bool
     {
-        return _token.is_initialized() && _policy.is_initialized();
+        return _token.is_initialized();
     }
 
     template <typename T, typename D>
@@ -221,7 +270,7 @@ namespace cxxreflect { namespace reflection { namespace detail {
         : _token(token)
     {
         if (token.is_initialized())
-            _policy.get() = &type_policy::get_for(token);
+            _policy_kind.get() = type_policy::get_kind_for(token);
     }
 
     template <typename T, typename D>
@@ -238,10 +287,10 @@ namespace cxxreflect { namespace reflection { namespace detail {
     }
 
     template <typename T, typename D>
-    auto common_type_functionality<T, D>::policy() const -> type_policy const&
+    auto common_type_functionality<T, D>::policy_kind() const -> type_policy_kind
     {
         core::assert_initialized(*this);
-        return *_policy;
+        return _policy_kind.get();
     }
 
     template class common_type_functionality<metadata::type_def_ref_or_signature, unresolved_type>;
@@ -399,40 +448,92 @@ namespace cxxreflect { namespace reflection {
 
     auto type::metadata_token() const -> core::size_type
     {
-        return policy().metadata_token(token());
+        return detail::type_policy_dispatch::metadata_token(policy_kind(), token());
     }
 
     auto type::attributes() const -> metadata::type_flags
     {
-        return policy().attributes(token());
+        return detail::type_policy_dispatch::attributes(policy_kind(), token());
     }
 
     auto type::base_type() const -> unresolved_type
     {
-        metadata::type_def_ref_or_signature const base(policy().base_type(token()));
+        metadata::type_def_ref_or_signature const base(detail::type_policy_dispatch::base_type(policy_kind(), token()));
         return base.is_initialized()
             ? unresolved_type(base, core::internal_key())
             : unresolved_type();
     }
 
+    auto type::assembly_qualified_name() const -> core::string_reference
+    {
+        core::assert_initialized(*this);
+
+        return detail::loader_context::from(token().scope()).get_type_name(token(), type_name_kind::assembly_qualified_name);
+    }
+
+    auto type::full_name() const -> core::string_reference
+    {
+        core::assert_initialized(*this);
+
+        return detail::loader_context::from(token().scope()).get_type_name(token(), type_name_kind::full_name);
+    }
+
+    auto type::simple_name() const -> core::string_reference
+    {
+        core::assert_initialized(*this);
+
+        return detail::loader_context::from(token().scope()).get_type_name(token(), type_name_kind::simple_name);
+    }
+
+    auto type::canonical_id() const -> core::size_type
+    {
+        core::assert_initialized(*this);
+
+        return detail::loader_context::from(token().scope()).get_canonical_type_id(token()).value();
+    }
+
+    auto type::is_subclass_of(type const& other) const -> bool
+    {
+        core::assert_initialized(*this);
+        core::assert_initialized(other);
+
+        // If both types are type definitions, we can use their cached ancestries.  The ancestry of
+        // a type records generic type definitions in place of generic type instantiations, so this
+        // is only correct if the other type is not generic (only then can it not be instantiated):
+        if (token().is_token() && other.token().is_token() && !other.is_generic_type_definition())
+            return detail::is_derived_from(token().as_token(), other.token().as_token(), false);
+
+        unresolved_type base(base_type());
+        while (base.is_initialized())
+        {
+            type const current(base.resolve());
+            if (current == other)
+                return true;
+
+            base = current.base_type();
+        }
+
+        return false;
+    }
+
     auto type::layout() const -> type_layout
     {
-        return policy().layout(token());
+        return detail::type_policy_dispatch::layout(policy_kind(), token());
     }
 
     auto type::string_format() const -> type_string_format
     {
-        return policy().string_format(token());
+        return detail::type_policy_dispatch::string_format(policy_kind(), token());
     }
 
     auto type::visibility() const -> type_visibility
     {
-        return policy().visibility(token());
+        return detail::type_policy_dispatch::visibility(policy_kind(), token());
     }
 
     auto type::is_abstract() const -> bool
     {
-        return policy().is_abstract(token());
+        return detail::type_policy_dispatch::is_abstract(policy_kind(), token());
     }
 
     auto type::is_class() const -> bool
@@ -442,72 +543,72 @@ namespace cxxreflect { namespace reflection {
 
     auto type::is_com_object() const -> bool
     {
-        return policy().is_com_object(token());
+        return detail::type_policy_dispatch::is_com_object(policy_kind(), token());
     }
 
     auto type::is_contextful() const -> bool
     {
-        return policy().is_contextful(token());
+        return detail::type_policy_dispatch::is_contextful(policy_kind(), token());
     }
 
     auto type::is_enum() const -> bool
     {
-        return policy().is_enum(token());
+        return detail::type_policy_dispatch::is_enum(policy_kind(), token());
     }
 
     auto type::is_generic_parameter() const -> bool
     {
-        return policy().is_generic_parameter(token());
+        return detail::type_policy_dispatch::is_generic_parameter(policy_kind(), token());
     }
 
     auto type::is_generic_type() const -> bool
     {
-        return policy().is_generic_type(token());
+        return detail::type_policy_dispatch::is_generic_type(policy_kind(), token());
     }
 
     auto type::is_generic_type_definition() const -> bool
     {
-        return policy().is_generic_type_definition(token());
+        return detail::type_policy_dispatch::is_generic_type_definition(policy_kind(), token());
     }
 
     auto type::is_import() const -> bool
     {
-        return policy().is_import(token());
+        return detail::type_policy_dispatch::is_import(policy_kind(), token());
     }
 
     auto type::is_interface() const -> bool
     {
-        return policy().is_interface(token());
+        return detail::type_policy_dispatch::is_interface(policy_kind(), token());
     }
 
     auto type::is_marshal_by_ref() const -> bool
     {
-        return policy().is_marshal_by_ref(token());
+        return detail::type_policy_dispatch::is_marshal_by_ref(policy_kind(), token());
     }
 
     auto type::is_sealed() const -> bool
     {
-        return policy().is_sealed(token());
+        return detail::type_policy_dispatch::is_sealed(policy_kind(), token());
     }
 
     auto type::is_serializable() const -> bool
     {
-        return policy().is_serializable(token());
+        return detail::type_policy_dispatch::is_serializable(policy_kind(), token());
     }
 
     auto type::is_special_name() const -> bool
     {
-        return policy().is_special_name(token());
+        return detail::type_policy_dispatch::is_special_name(policy_kind(), token());
     }
 
     auto type::is_value_type() const -> bool
     {
-        return policy().is_value_type(token());
+        return detail::type_policy_dispatch::is_value_type(policy_kind(), token());
     }
 
     auto type::is_visible() const -> bool
     {
-        return policy().is_visible(token());
+        return detail::type_policy_dispatch::is_visible(policy_kind(), token());
     }
 
     auto type::interfaces() const -> interface_range
@@ -524,6 +625,35 @@ namespace cxxreflect { namespace reflection {
             interface_iterator());
     }
 
+    auto type::implements(type const& interface_type) const -> bool
+    {
+        core::assert_initialized(*this);
+        core::assert_initialized(interface_type);
+
+        if (!interface_type.is_interface())
+            return false;
+
+        token_type const token(token());
+        if (token.is_blob() && token.as_blob().as<metadata::type_signature>().is_by_ref())
+            return false;
+
+        metadata::type_def_token const interface_definition(detail::resolve_primary_type(interface_type.context(core::internal_key())));
+        core::size_type const interface_id(detail::module_context::from(interface_definition.scope()).interface_id(interface_definition));
+
+        detail::interface_closure const& closure(detail::loader_context::from(token.scope()).get_membership(token).get_interface_closure());
+        if (!closure.contains(interface_id))
+            return false;
+
+        // The closure records generic interface definitions in place of their instantiations, so
+        // if the interface is generic, we know only that this type implements some instantiation
+        // of it and we must search the interface table for the instantiation:
+        if (!interface_type.is_generic_type())
+            return true;
+
+        interface_range const implemented_interfaces(interfaces());
+        return std::find(begin(implemented_interfaces), end(implemented_interfaces), interface_type) != end(implemented_interfaces);
+    }
+
     auto type::constructors(metadata::binding_flags flags) const -> method_range
     {
         core::assert_initialized(*this);
@@ -532,12 +662,13 @@ namespace cxxreflect { namespace reflection {
         flags.set(metadata::binding_attribute::declared_only);
         flags.unset(metadata::binding_attribute::flatten_hierarchy);
 
-        auto const& table(detail::loader_context::from(token().scope()).get_membership(token()).get_methods());
-        if (table.empty())
+        auto const view(detail::loader_context::from(token().scope()).get_membership(token())
+            .get_view<detail::member_kind::method>(flags, *this, &type::filter_method));
+        if (view.empty())
             return method_range();
 
         return method_range(
-            method_iterator(*this, begin(table), end(table), flags),
+            method_iterator(*this, begin(view), end(view), flags),
             method_iterator());
     }
 
@@ -548,12 +679,13 @@ namespace cxxreflect { namespace reflection {
         if (is_by_ref())
             return field_range();
 
-        auto const& table(detail::loader_context::from(token().scope()).get_membership(token()).get_fields());
-        if (table.empty())
+        auto const view(detail::loader_context::from(token().scope()).get_membership(token())
+            .get_view<detail::member_kind::field>(flags, *this, &type::filter_field));
+        if (view.empty())
             return field_range();
 
         return field_range(
-            field_iterator(*this, begin(table), end(table), flags),
+            field_iterator(*this, begin(view), end(view), flags),
             field_iterator());
     }
 
@@ -564,12 +696,13 @@ namespace cxxreflect { namespace reflection {
         if (is_by_ref())
             return method_range();
 
-        auto const& table(detail::loader_context::from(token().scope()).get_membership(token()).get_methods());
-        if (table.empty())
+        auto const view(detail::loader_context::from(token().scope()).get_membership(token())
+            .get_view<detail::member_kind::method>(flags, *this, &type::filter_method));
+        if (view.empty())
             return method_range();
 
         return method_range(
-            method_iterator(*this, begin(table), end(table), flags),
+            method_iterator(*this, begin(view), end(view), flags),
             method_iterator());
     }
 
@@ -580,28 +713,67 @@ namespace cxxreflect { namespace reflection {
         if (is_by_ref())
             return property_range();
 
-        auto const& table(detail::loader_context::from(token().scope()).get_membership(token()).get_properties());
-        if (table.empty())
+        auto const view(detail::loader_context::from(token().scope()).get_membership(token())
+            .get_view<detail::member_kind::property>(flags, *this, &type::filter_property));
+        if (view.empty())
             return property_range();
 
         return property_range(
-            property_iterator(*this, begin(table), end(table), flags),
+            property_iterator(*this, begin(view), end(view), flags),
             property_iterator());
     }
 
+    auto type::find_methods(core::string_reference const name, metadata::binding_flags const flags) const -> method_name_range
+    {
+        core::assert_initialized(*this);
+
+        if (is_by_ref())
+            return method_name_range();
+
+        auto const members(detail::loader_context::from(token().scope()).get_membership(token()).find_methods(name));
+        if (members.empty())
+            return method_name_range();
+
+        return method_name_range(
+            method_name_iterator(*this, begin(members), end(members), flags),
+            method_name_iterator());
+    }
+
     auto type::find_method(core::string_reference const name, metadata::binding_flags const flags) const -> method
+    {
+        return find_unique_member(find_methods(name, flags), L"method name is not unique");
+    }
+
+    auto type::find_field(core::string_reference const name, metadata::binding_flags const flags) const -> field
     {
         core::assert_initialized(*this);
 
-        auto const predicate([&](method const& m) { return m.name() == name; });
+        if (is_by_ref())
+            return field();
+
+        auto const members(detail::loader_context::from(token().scope()).get_membership(token()).find_fields(name));
+        if (members.empty())
+            return field();
+
+        return find_unique_member(field_name_range(
+            field_name_iterator(*this, begin(members), end(members), flags),
+            field_name_iterator()), L"field name is not unique");
+    }
 
-        auto const methods(methods(flags));
-        auto const it(std::find_if(begin(methods), end(methods), predicate));
+    auto type::find_property(core::string_reference const name, metadata::binding_flags const flags) const -> property
+    {
+        core::assert_initialized(*this);
+
+        if (is_by_ref())
+            return property();
 
-        if (it != end(methods) && std::find_if(std::next(it), end(methods), predicate) != end(methods))
-            throw core::runtime_error(L"method name is not unique");
+        auto const members(detail::loader_context::from(token().scope()).get_membership(token()).find_properties(name));
+        if (members.empty())
+            return property();
 
-        return it != end(methods) ? *it : method();
+        return find_unique_member(property_name_range(
+            property_name_iterator(*this, begin(members), end(members), flags),
+            property_name_iterator()), L"property name is not unique");
     }
 
     auto type::custom_attributes() const -> detail::custom_attribute_range
@@ -7,6 +7,7 @@
 #define CXXREFLECT_REFLECTION_TYPE_HPP_
 
 #include "cxxreflect/reflection/detail/forward_declarations.hpp"
+#include "cxxreflect/reflection/detail/member_table_cursor.hpp"
 
 
 
@@ -30,6 +31,13 @@ namespace cxxreflect { namespace reflection { namespace detail {
         auto assembly_qualified_name() const -> core::string;
         auto full_name()               const -> core::string;
         auto simple_name()             const -> core::string;
+
+        /// Appends the name of the type, in the form `kind`, to `buffer`
+        ///
+        /// The names of resolved types are built once and cached by their loader, so this does not
+        /// allocate if `buffer` already has sufficient capacity.
+        auto format_name_into(core::string& buffer, type_name_kind kind = type_name_kind::full_name) const -> void;
+
         auto primary_name()            const -> core::string_reference;
         auto namespace_name()          const -> core::string_reference;
 
@@ -56,16 +64,16 @@ namespace cxxreflect { namespace reflection { namespace detail {
         common_type_functionality(token_type const&);
         ~common_type_functionality();
 
-        auto token()  const -> token_type  const&;
-        auto policy() const -> type_policy const&;
+        auto token()       const -> token_type const&;
+        auto policy_kind() const -> type_policy_kind;
 
     private:
 
         friend class type;
         friend class unresolved_type;
 
-        token_type                               _token;
-        core::checked_pointer<type_policy const> _policy;
+        token_type                                _token;
+        core::value_initialized<type_policy_kind> _policy_kind;
     };
 
 } } }
@@ -103,6 +111,13 @@ namespace cxxreflect { namespace reflection {
         static auto filter_method   (metadata::binding_flags, type const&, detail::method_table_entry    const* const&) -> bool;
         static auto filter_property (metadata::binding_flags, type const&, detail::property_table_entry  const* const&) -> bool;
 
+        /// Excludes nothing; used to iterate member views, whose entries have already been filtered
+        template <typename Entry>
+        static auto filter_nothing(metadata::binding_flags, type const&, Entry const&) -> bool
+        {
+            return false;
+        }
+
     public:
 
         typedef detail::member_iterator<
@@ -115,8 +130,8 @@ namespace cxxreflect { namespace reflection {
         typedef detail::member_iterator<
             type,
             field,
-            detail::field_table_iterator,
-            &type::filter_field
+            detail::field_view_iterator,
+            &type::filter_nothing<detail::field_table_entry const*>
         > field_iterator;
 
         typedef detail::member_iterator<
@@ -129,15 +144,15 @@ namespace cxxreflect { namespace reflection {
         typedef detail::member_iterator<
             type,
             method,
-            detail::method_table_iterator,
-            &type::filter_method
+            detail::method_view_iterator,
+            &type::filter_nothing<detail::method_table_entry const*>
         > method_iterator;
 
         typedef detail::member_iterator<
             type,
             property,
-            detail::property_table_iterator,
-            &type::filter_property
+            detail::property_view_iterator,
+            &type::filter_nothing<detail::property_table_entry const*>
         > property_iterator;
 
         typedef core::iterator_range<event_iterator    > event_range;
@@ -146,6 +161,31 @@ namespace cxxreflect { namespace reflection {
         typedef core::iterator_range<method_iterator   > method_range;
         typedef core::iterator_range<property_iterator > property_range;
 
+        typedef detail::member_iterator<
+            type,
+            field,
+            detail::field_name_iterator,
+            &type::filter_field
+        > field_name_iterator;
+
+        typedef detail::member_iterator<
+            type,
+            method,
+            detail::method_name_iterator,
+            &type::filter_method
+        > method_name_iterator;
+
+        typedef detail::member_iterator<
+            type,
+            property,
+            detail::property_name_iterator,
+            &type::filter_property
+        > property_name_iterator;
+
+        typedef core::iterator_range<field_name_iterator   > field_name_range;
+        typedef core::iterator_range<method_name_iterator  > method_name_range;
+        typedef core::iterator_range<property_name_iterator> property_name_range;
+
         type();
         type(metadata::type_def_ref_spec_or_signature const& token, core::internal_key);
         type(unresolved_type const& source);
@@ -158,6 +198,30 @@ namespace cxxreflect { namespace reflection {
 
         auto base_type() const -> unresolved_type;
 
+        /// Gets the name of this type, in the corresponding form
+        ///
+        /// These hide the members of the same names in `common_type_functionality`, which build a
+        /// new string on each call.  The names of resolved types are built once and cached by their
+        /// loader, so these return a reference to the cached, null-terminated name, which is valid
+        /// for the lifetime of the loader, and do not allocate.
+        auto assembly_qualified_name() const -> core::string_reference;
+        auto full_name()               const -> core::string_reference;
+        auto simple_name()             const -> core::string_reference;
+
+        /// Gets an id for this type that is unique within its loader
+        ///
+        /// Type handles are compared by identity, so two handles obtained from different signatures
+        /// for the same type (e.g., the same generic instantiation referenced from two modules) do
+        /// not compare equal.  Their canonical ids are equal, though:  two resolved types are the
+        /// same type if and only if their canonical ids are equal.  See `canonical_type_storage`.
+        ///
+        /// Computing the id of a signature may resolve type references and load assemblies, so it
+        /// is done only when it is requested.  If a type reference cannot be resolved, this throws.
+        auto canonical_id() const -> core::size_type;
+
+        auto is_subclass_of(type const& other) const -> bool;
+        auto implements(type const& interface_type) const -> bool;
+
         auto layout()        const -> type_layout;
         auto string_format() const -> type_string_format;
         auto visibility()    const -> type_visibility;
@@ -186,7 +250,16 @@ namespace cxxreflect { namespace reflection {
         auto methods     (metadata::binding_flags = metadata::binding_attribute::default_) const -> method_range;
         auto properties  (metadata::binding_flags = metadata::binding_attribute::default_) const -> property_range;
 
-        auto find_method(core::string_reference name, metadata::binding_flags = metadata::binding_attribute::default_) const -> method;
+        /// Finds the members with the given name that match the binding flags
+        ///
+        /// `find_methods` returns all of the overloads of the method, in the same order as they are
+        /// returned by `methods()`.  The other functions return the single matching member, or an
+        /// uninitialized member if there is no match; they throw if more than one member matches.
+        /// Lookups use a name index of the type's member table, so they do not scan the table.
+        auto find_methods (core::string_reference name, metadata::binding_flags = metadata::binding_attribute::default_) const -> method_name_range;
+        auto find_method  (core::string_reference name, metadata::binding_flags = metadata::binding_attribute::default_) const -> method;
+        auto find_field   (core::string_reference name, metadata::binding_flags = metadata::binding_attribute::default_) const -> field;
+        auto find_property(core::string_reference name, metadata::binding_flags = metadata::binding_attribute::default_) const -> property;
 
         auto custom_attributes()         const -> detail::custom_attribute_range;
         auto required_custom_modifiers() const -> custom_modifier_range;
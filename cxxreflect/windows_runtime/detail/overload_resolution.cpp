@@ -109,8 +109,7 @@ namespace cxxreflect { namespace windows_runtime { namespace detail {
         // the interface:
         if (parameter_type.is_interface())
         {
-            auto const it(std::find(begin(argument_type.interfaces()), end(argument_type.interfaces()), parameter_type));
-            return it != end(argument_type.interfaces())
+            return argument_type.implements(parameter_type)
                 ? conversion_rank::derived_to_interface_conversion
                 : conversion_rank::no_match;
         }
@@ -253,7 +253,7 @@ namespace cxxreflect { namespace windows_runtime {
             reflection::assembly const a(loader().load_assembly(reflection::module_location(f.second.c_str())));
             core::for_all(a.types(), [&](reflection::type const& t)
             {
-                if (std::find(begin(t.interfaces()), end(t.interfaces()), interface_type) != end(t.interfaces()))
+                if (t.implements(interface_type))
                     implementers.push_back(t);
             });
         });
@@ -268,26 +268,25 @@ namespace cxxreflect { namespace windows_runtime {
         if (!enumeration_type.is_enum())
             return std::vector<enumerator>();
 
-        metadata::binding_flags const flags(
-            metadata::binding_attribute::public_ |
-            metadata::binding_attribute::static_);
-
-        auto const fields(enumeration_type.fields(flags));
+        // The table of named values is cached by the module that defines the enumeration, so we
+        // need only convert the values to the Windows Runtime representation.  Enumerators are
+        // reported in declaration order:
+        reflection::enum_value_table const& values(reflection::enum_values(enumeration_type));
+        reflection::enum_value_table::value_range const declared(values.values_in_declaration_order());
 
         std::vector<enumerator> result;
-        core::transform_all(fields, std::back_inserter(result), [&](reflection::field const& field) -> enumerator
+        result.reserve(core::distance(begin(declared), end(declared)));
+        core::transform_all(declared, std::back_inserter(result), [&](reflection::enum_value const& value) -> enumerator
         {
-            reflection::constant const constant(field.constant_value());
-
-            std::uint32_t value(0);
-            switch (constant.get_kind())
+            std::uint32_t converted(0);
+            switch (values.underlying_kind())
             {
-            case reflection::constant::kind::int32:  value = core::convert_integer(constant.as_int32());  break;
-            case reflection::constant::kind::uint32: value = core::convert_integer(constant.as_uint32()); break;
+            case reflection::constant::kind::int32:  converted = core::convert_integer(value.signed_value());   break;
+            case reflection::constant::kind::uint32: converted = core::convert_integer(value.unsigned_value()); break;
             default: throw core::runtime_error(L"invalid enumerator type encountered");
             }
 
-            return enumerator(field.name(), value);
+            return enumerator(value.name(), converted);
         });
 
         return result;
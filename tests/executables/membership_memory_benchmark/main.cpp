@@ -0,0 +1,170 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+
+
+
+
+// CXXREFLECT TEST SUITE -- MEMBERSHIP MEMORY BENCHMARK
+//
+// This program measures the resident memory used by the member tables of two large type universes:
+// the full mscorlib type universe and the Windows type universe (the Windows platform metadata files
+// that are found via RoResolveNamespace).  For each universe, it creates a new loader, loads all of
+// the assemblies, and reports the working set and private bytes of the process before and after it
+// realizes the member tables of every type, along with the statistics for the tables it built.
+//
+// To use this program, set the framework path in the main() function at the bottom of this file,
+// recompile, and run.  The results are written to the console.  Build the Release configuration;
+// the Debug allocator adds its own overhead to every allocation.
+
+
+
+
+
+#include "cxxreflect/cxxreflect.hpp"
+
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+
+#include <Windows.h>
+#include <Psapi.h>
+
+#include <iostream>
+
+namespace cxr
+{
+    using namespace cxxreflect::core;
+    using namespace cxxreflect::externals;
+    using namespace cxxreflect::metadata;
+    using namespace cxxreflect::reflection;
+    using namespace cxxreflect::windows_runtime;
+}
+
+namespace
+{
+    class memory_snapshot
+    {
+    public:
+
+        memory_snapshot()
+        {
+            PROCESS_MEMORY_COUNTERS_EX counters = { };
+            counters.cb = sizeof(counters);
+
+            if (!::GetProcessMemoryInfo(::GetCurrentProcess(),
+                                        reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters),
+                                        sizeof(counters)))
+                throw cxr::runtime_error(L"failed to query the memory counters of the process");
+
+            _working_set   = counters.WorkingSetSize;
+            _private_bytes = counters.PrivateUsage;
+        }
+
+        auto working_set()   const -> std::size_t { return _working_set;   }
+        auto private_bytes() const -> std::size_t { return _private_bytes; }
+
+    private:
+
+        std::size_t _working_set;
+        std::size_t _private_bytes;
+    };
+
+    auto to_kilobytes(std::size_t const bytes) -> unsigned
+    {
+        return static_cast<unsigned>(bytes / 1024);
+    }
+
+    auto write(std::wostream& os, wchar_t const* const label, memory_snapshot const& snapshot) -> void
+    {
+        os << L"    " << label
+           << L" [Working Set " << to_kilobytes(snapshot.working_set()) << L" KB]"
+           << L" [Private Bytes " << to_kilobytes(snapshot.private_bytes()) << L" KB]\n";
+    }
+
+    /// Loads the assemblies at `paths` into a new loader and reports the memory used to realize them
+    auto measure_universe(std::wostream&                  os,
+                          wchar_t                  const* universe_name,
+                          cxr::module_locator      const& locator,
+                          cxr::loader_configuration const& configuration,
+                          std::vector<cxr::string> const& paths) -> void
+    {
+        os << L"Universe [" << universe_name << L"]\n";
+
+        cxr::loader_root const root(cxr::create_loader_root(locator, configuration));
+
+        std::vector<cxr::assembly> assemblies;
+        std::for_each(begin(paths), end(paths), [&](cxr::string const& path)
+        {
+            assemblies.push_back(root.get().load_assembly(cxr::module_location(path.c_str())));
+        });
+
+        memory_snapshot const before;
+        write(os, L"Before Realization", before);
+
+        cxr::realization_statistics const statistics(root.get().realize_all(assemblies));
+
+        memory_snapshot const after;
+        write(os, L"After Realization ", after);
+
+        os << L"    Growth [Working Set " << to_kilobytes(after.working_set() - before.working_set()) << L" KB]"
+           << L" [Private Bytes " << to_kilobytes(after.private_bytes() - before.private_bytes()) << L" KB]\n";
+
+        os << L"    Assemblies [" << statistics.assembly_count() << L"]"
+           << L" Types [" << statistics.type_count() << L"]"
+           << L" Failed Types [" << statistics.failed_type_count() << L"]\n";
+
+        os << L"    Member Table Layers [" << statistics.layer_count() << L"]"
+           << L" Entries [" << statistics.entry_count() << L"]"
+           << L" Table Bytes [" << statistics.table_bytes() << L"]"
+           << L" Signature Bytes [" << statistics.signature_bytes() << L"]\n";
+
+        os << L"    Realization [" << statistics.build_milliseconds() << L" ms]\n\n";
+    }
+}
+
+auto main() -> int
+{
+    cxr::externals::initialize(cxr::win32_externals());
+
+    cxr::string const framework_path(L"c:\\Windows\\Microsoft.NET\\Framework\\v4.0.30319");
+
+    // The full mscorlib type universe:
+    {
+        cxr::search_path_module_locator::search_path_sequence directories;
+        directories.push_back(framework_path);
+
+        std::vector<cxr::string> const paths(1, framework_path + L"\\mscorlib.dll");
+
+        measure_universe(
+            std::wcout,
+            L"mscorlib",
+            cxr::search_path_module_locator(directories),
+            cxr::default_loader_configuration(),
+            paths);
+    }
+
+    // The Windows type universe.  The package module locator resolves types by namespace and maps
+    // the Platform and System namespaces to the embedded platform types assembly:
+    {
+        cxr::package_module_locator const locator(L"");
+
+        std::vector<cxr::string> paths;
+        cxr::for_all(locator.metadata_files(), [&](std::pair<cxr::string const, cxr::string> const& name_path_pair)
+        {
+            if (cxr::starts_with(name_path_pair.first.c_str(), L"windows"))
+                paths.push_back(name_path_pair.second);
+        });
+
+        measure_universe(
+            std::wcout,
+            L"Windows",
+            locator,
+            cxr::package_loader_configuration(),
+            paths);
+    }
+
+    return 0;
+}
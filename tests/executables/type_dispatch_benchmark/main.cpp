@@ -0,0 +1,211 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+
+
+
+
+// CXXREFLECT TEST SUITE -- TYPE DISPATCH BENCHMARK
+//
+// This program compares the two ways in which a type query can be dispatched to its type policy:
+// through a virtual call on a `type_policy` pointer (which is what type handles used to store) and
+// through `type_policy_dispatch`, which switches on the `type_policy_kind` stored in type handles.
+// It loads mscorlib, collects the type definitions in it and the parameter types of their methods,
+// and then times repeated bulk queries over those types with each kind of dispatch.  Both kinds of
+// dispatch compute the same checksum; if they do not, the program fails.
+//
+// To use this program, set the framework path in the main() function at the bottom of this file,
+// recompile, and run.  The results are written to the console.  Build the Release configuration;
+// the point is to measure what the optimizer can do with each kind of dispatch.
+
+
+
+
+
+#include "cxxreflect/cxxreflect.hpp"
+#include "cxxreflect/reflection/detail/type_policy_dispatch.hpp"
+
+#include <iostream>
+
+namespace cxr
+{
+    using namespace cxxreflect::core;
+    using namespace cxxreflect::externals;
+    using namespace cxxreflect::metadata;
+    using namespace cxxreflect::reflection;
+}
+
+namespace cxd
+{
+    using namespace cxxreflect::reflection::detail;
+}
+
+namespace
+{
+    typedef cxd::type_policy::resolved_type_context resolved_type_context;
+
+    /// A type as the type handles used to store it:  with a pointer to its policy
+    typedef std::pair<resolved_type_context, cxd::type_policy const*> virtual_entry;
+
+    /// A type as the type handles now store it:  with the kind of its policy
+    typedef std::pair<resolved_type_context, cxd::type_policy_kind> switch_entry;
+
+    /// Runs `query` `iterations` times, reports the elapsed time, and returns the checksum
+    template <typename Query>
+    auto measure(std::wostream& os, wchar_t const* const name, unsigned const iterations, Query query) -> unsigned
+    {
+        unsigned checksum(0);
+
+        auto const start(std::chrono::high_resolution_clock::now());
+        for (unsigned i(0); i != iterations; ++i)
+            checksum += query();
+        auto const end(std::chrono::high_resolution_clock::now());
+
+        std::chrono::milliseconds const duration(std::chrono::duration_cast<std::chrono::milliseconds>(end - start));
+        os << L"    " << name << L" [" << (unsigned)duration.count() << L" ms] [checksum " << checksum << L"]\n";
+
+        return checksum;
+    }
+
+    /// Times the queries on type definitions, which require resolved types, with each dispatch
+    auto measure_definitions(std::wostream&                    os,
+                             std::vector<virtual_entry> const& virtual_entries,
+                             std::vector<switch_entry>  const& switch_entries,
+                             unsigned                   const  iterations) -> bool
+    {
+        os << L"Type Definitions [" << (unsigned)switch_entries.size() << L" types x " << iterations << L"]\n";
+
+        unsigned const virtual_checksum(measure(os, L"Virtual Dispatch", iterations, [&]() -> unsigned
+        {
+            unsigned checksum(0);
+            std::for_each(begin(virtual_entries), end(virtual_entries), [&](virtual_entry const& e)
+            {
+                checksum += e.second->is_array(e.first) ? 1 : 0;
+                checksum += e.second->is_by_ref(e.first) ? 1 : 0;
+                checksum += e.second->primary_name(e.first).size();
+                checksum += e.second->attributes(e.first).integer();
+                checksum += e.second->base_type(e.first).is_initialized() ? 1 : 0;
+            });
+            return checksum;
+        }));
+
+        unsigned const switch_checksum(measure(os, L"Switch Dispatch ", iterations, [&]() -> unsigned
+        {
+            unsigned checksum(0);
+            std::for_each(begin(switch_entries), end(switch_entries), [&](switch_entry const& e)
+            {
+                checksum += cxd::type_policy_dispatch::is_array(e.second, e.first) ? 1 : 0;
+                checksum += cxd::type_policy_dispatch::is_by_ref(e.second, e.first) ? 1 : 0;
+                checksum += cxd::type_policy_dispatch::primary_name(e.second, e.first).size();
+                checksum += cxd::type_policy_dispatch::attributes(e.second, e.first).integer();
+                checksum += cxd::type_policy_dispatch::base_type(e.second, e.first).is_initialized() ? 1 : 0;
+            });
+            return checksum;
+        }));
+
+        return virtual_checksum == switch_checksum;
+    }
+
+    /// Times the queries that are defined for every kind of type, over a mix of type definitions,
+    /// references, and signatures, with each dispatch
+    auto measure_signatures(std::wostream&                    os,
+                            std::vector<virtual_entry> const& virtual_entries,
+                            std::vector<switch_entry>  const& switch_entries,
+                            unsigned                   const  iterations) -> bool
+    {
+        os << L"Parameter Types [" << (unsigned)switch_entries.size() << L" types x " << iterations << L"]\n";
+
+        unsigned const virtual_checksum(measure(os, L"Virtual Dispatch", iterations, [&]() -> unsigned
+        {
+            unsigned checksum(0);
+            std::for_each(begin(virtual_entries), end(virtual_entries), [&](virtual_entry const& e)
+            {
+                checksum += e.second->is_array(e.first) ? 1 : 0;
+                checksum += e.second->is_by_ref(e.first) ? 1 : 0;
+                checksum += e.second->is_pointer(e.first) ? 1 : 0;
+                checksum += e.second->is_generic_type_instantiation(e.first) ? 1 : 0;
+            });
+            return checksum;
+        }));
+
+        unsigned const switch_checksum(measure(os, L"Switch Dispatch ", iterations, [&]() -> unsigned
+        {
+            unsigned checksum(0);
+            std::for_each(begin(switch_entries), end(switch_entries), [&](switch_entry const& e)
+            {
+                checksum += cxd::type_policy_dispatch::is_array(e.second, e.first) ? 1 : 0;
+                checksum += cxd::type_policy_dispatch::is_by_ref(e.second, e.first) ? 1 : 0;
+                checksum += cxd::type_policy_dispatch::is_pointer(e.second, e.first) ? 1 : 0;
+                checksum += cxd::type_policy_dispatch::is_generic_type_instantiation(e.second, e.first) ? 1 : 0;
+            });
+            return checksum;
+        }));
+
+        return virtual_checksum == switch_checksum;
+    }
+
+    auto add_entry(std::vector<virtual_entry>& virtual_entries,
+                   std::vector<switch_entry>&  switch_entries,
+                   cxr::type            const& t) -> void
+    {
+        resolved_type_context const& context(t.context(cxr::internal_key()));
+        cxd::type_policy_kind  const kind(cxd::type_policy::get_kind_for(context));
+
+        virtual_entries.push_back(virtual_entry(context, &cxd::type_policy::get_for(kind)));
+        switch_entries.push_back(switch_entry(context, kind));
+    }
+}
+
+auto main() -> int
+{
+    cxr::externals::initialize(cxr::win32_externals());
+
+    cxr::string const framework_path(L"c:\\Windows\\Microsoft.NET\\Framework\\v4.0.30319");
+
+    unsigned const iterations(100);
+
+    cxr::search_path_module_locator::search_path_sequence directories;
+    directories.push_back(framework_path);
+
+    cxr::loader_root const root(cxr::create_loader_root(
+        cxr::search_path_module_locator(directories),
+        cxr::default_loader_configuration()));
+
+    cxr::assembly const a(root.get().load_assembly((framework_path + L"\\mscorlib.dll").c_str()));
+
+    cxr::binding_flags const all_declared_methods(
+        cxr::binding_attribute::all_instance |
+        cxr::binding_attribute::all_static   |
+        cxr::binding_attribute::declared_only);
+
+    std::vector<virtual_entry> virtual_definitions;
+    std::vector<switch_entry>  switch_definitions;
+    std::vector<virtual_entry> virtual_parameters;
+    std::vector<switch_entry>  switch_parameters;
+
+    cxr::for_all(a.types(), [&](cxr::type const& t)
+    {
+        add_entry(virtual_definitions, switch_definitions, t);
+
+        cxr::for_all(t.methods(all_declared_methods), [&](cxr::method const& m)
+        {
+            cxr::for_all(m.parameters(), [&](cxr::parameter const& p)
+            {
+                add_entry(virtual_parameters, switch_parameters, p.parameter_type());
+            });
+        });
+    });
+
+    bool const definitions_match(measure_definitions(std::wcout, virtual_definitions, switch_definitions, iterations));
+    bool const parameters_match (measure_signatures (std::wcout, virtual_parameters,  switch_parameters,  iterations));
+
+    if (!definitions_match || !parameters_match)
+    {
+        std::wcout << L"The checksums of the two kinds of dispatch do not match\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxr
+{
+    using namespace cxxreflect::core;
+    using namespace cxxreflect::metadata;
+}
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_TEST(metadata_method_bodies_instructions_and_clauses)
+    {
+        cxr::database const beta(load_beta_database(c));
+
+        cxr::method_body const body(find_method_def(c, beta, L"ZMethodBodies", L"Select"));
+        c.verify(body.is_initialized());
+        c.verify_equals(body.max_stack(), 2u);
+        c.verify(body.init_locals());
+        c.verify(body.local_signature().is_initialized());
+
+        std::vector<cxr::il_instruction> const instructions(
+            begin(body.instructions()),
+            end(body.instructions()));
+
+        c.verify_equals(instructions.size(), 18u);
+        c.verify(instructions[0].name() == L"ldarg.0");
+        c.verify(instructions.back().name() == L"ret");
+
+        // Each instruction begins where the previous one ended:
+        for (std::size_t i(1); i != instructions.size(); ++i)
+            c.verify_equals(instructions[i].offset(), instructions[i - 1].offset() + instructions[i - 1].size());
+
+        c.verify_equals(instructions.back().offset() + instructions.back().size(), body.code().size());
+
+        cxr::il_instruction const& selector(instructions[1]);
+        c.verify(selector.operand_kind() == cxr::il_operand_kind::switch_table);
+        c.verify_equals(selector.switch_target_count(), 2u);
+        c.verify_equals(selector.switch_target(0), instructions[5].offset());
+        c.verify_equals(selector.switch_target(1), instructions[8].offset());
+
+        c.verify(instructions[5].name() == L"ldc.i4");
+        c.verify_equals(instructions[5].integer_operand(), 100);
+        c.verify(instructions[2].name() == L"ldc.i4.m1");
+
+        c.verify(instructions[8].name() == L"ldstr");
+        c.verify(instructions[8].string_operand() == L"one");
+        c.verify(body.scope().user_strings()[instructions[8].string_operand_index()] == L"one");
+
+        c.verify(instructions[9].name() == L"callvirt");
+        c.verify(instructions[9].token_operand().table() == cxr::table_id::member_ref);
+
+        c.verify(instructions[4].name() == L"leave.s");
+        c.verify_equals(instructions[4].branch_target(), instructions[16].offset());
+
+        c.verify_equals(body.exception_clause_count(), 1u);
+        cxr::exception_clause const clause(body.get_exception_clause(0));
+        c.verify(clause.kind() == cxr::exception_clause_kind::exception);
+        c.verify_equals(clause.try_offset(), 0u);
+        c.verify_equals(clause.handler_offset(), instructions[12].offset());
+        c.verify_equals(clause.handler_offset() + clause.handler_length(), instructions[16].offset());
+        c.verify(clause.catch_type().table() == cxr::table_id::type_ref);
+    }
+
+}
@@ -0,0 +1,81 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxr
+{
+    using namespace cxxreflect::core;
+    using namespace cxxreflect::metadata;
+}
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_TEST(metadata_user_strings_enumeration)
+    {
+        cxr::database const beta(load_beta_database(c));
+
+        cxr::method_body const body(find_method_def(c, beta, L"ZMethodBodies", L"Strings"));
+
+        cxr::database_user_string_collection const& user_strings(beta.user_strings());
+
+        // The iterator visits each string once, and each string can be found again by its index:
+        std::vector<cxr::string> values;
+        for (auto it(user_strings.begin()); it != user_strings.end(); ++it)
+        {
+            values.push_back(cxr::string(it->begin(), it->end()));
+            c.verify(user_strings[it.index()] == *it);
+        }
+
+        c.verify_equals(values.size(), 4u);
+        c.verify(std::find(begin(values), end(values), L"one") != end(values));
+        c.verify(std::find(begin(values), end(values), L"two") != end(values));
+        c.verify(std::find(begin(values), end(values), L"")    != end(values));
+
+        // User strings are not null-terminated, so comparisons must stop at the end of the view:
+        std::vector<cxr::il_instruction> const instructions(begin(body.instructions()), end(body.instructions()));
+        c.verify(instructions[0].string_operand().empty());
+        c.verify(instructions[2].string_operand() == L"two");
+        c.verify(instructions[2].string_operand() != cxr::string_reference::from_literal(L"tw"));
+        c.verify(instructions[2].string_operand() <  cxr::string_reference::from_literal(L"twos"));
+    }
+
+    CXXREFLECTTEST_DEFINE_TEST(metadata_user_strings_misaligned)
+    {
+        cxr::database const beta(load_beta_database(c));
+
+        cxr::method_body const body(find_method_def(c, beta, L"ZMethodBodies", L"Strings"));
+        std::vector<cxr::il_instruction> const instructions(begin(body.instructions()), end(body.instructions()));
+
+        // The characters of this string begin at an odd offset, so they are read from the bytes of
+        // the heap into a copy, which is cached so that every lookup yields the same string:
+        cxr::string const expected(L"Characters of this long literal begin at an odd offset in the user string heap.");
+
+        cxr::string_reference const first(instructions[4].string_operand());
+        c.verify(cxr::string(first.begin(), first.end()) == expected);
+
+        cxr::string_reference const second(beta.user_strings()[instructions[4].string_operand_index()]);
+        c.verify(second.begin() == first.begin());
+        c.verify(reinterpret_cast<std::uintptr_t>(first.begin()) % sizeof(cxr::character) == 0);
+    }
+
+    CXXREFLECTTEST_DEFINE_TEST(metadata_user_strings_embedded_null)
+    {
+        // A string with a known end may contain null characters; it must not compare equal to the
+        // prefix that precedes its first null character:
+        cxr::character const data[] = { L't', L'w', L'o', L'\0', L'x', L'\0' };
+
+        cxr::string_reference const with_null(data, data + 5);
+        cxr::string_reference const prefix(data, data + 3);
+        cxr::string_reference const terminated(static_cast<cxr::character const*>(data));
+
+        c.verify(with_null != prefix);
+        c.verify(prefix    <  with_null);
+        c.verify(with_null != terminated);
+        c.verify(terminated == cxr::string_reference::from_literal(L"two"));
+        c.verify(cxr::string_reference(data, data + 4) < with_null);
+    }
+
+}
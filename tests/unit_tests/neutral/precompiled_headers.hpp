@@ -47,6 +47,27 @@ namespace cxxreflect_test {
         return a;
     }
 
+    inline auto load_beta_database(context const& c) -> cxr::database
+    {
+        cxr::string const path(c.get_property(known_property::test_assemblies_path()) + L"\\beta.dll");
+        return cxr::database::create_from_file(path.c_str());
+    }
+
+    inline auto find_method_def(context               const& c,
+                                cxr::database         const& scope,
+                                cxr::string_reference const  type_name,
+                                cxr::string_reference const  method_name) -> cxr::method_def_token
+    {
+        auto const methods(scope.table<cxr::table_id::method_def>());
+        auto const it(cxr::find_if(methods, [&](cxr::method_def_row const& row)
+        {
+            return row.name() == method_name && cxr::find_owner_of_method_def(row.token()).name() == type_name;
+        }));
+
+        c.verify(it != end(methods));
+        return (*it).token();
+    }
+
 #define CXXREFLECTTEST_DEFINE_BETA_TEST(name)                                                                             \
     auto CXXREFLECTTEST_CONCATENATE(name, _)(context const& c, cxr::loader root, cxr::assembly beta) -> void;             \
     auto name(context const& c) -> void                                                                                   \
@@ -0,0 +1,145 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_custom_attributes_arguments)
+    {
+        cxr::type const attributed(beta.find_type(L"", L"ZAttributed"));
+        c.verify(attributed.is_initialized());
+
+        auto const attributes(attributed.custom_attributes());
+        c.verify_equals(cxr::distance(begin(attributes), end(attributes)), 1u);
+
+        cxr::custom_attribute const attribute(*begin(attributes));
+
+        // ZAttribute(42, "hi", ZColor.Blue, new short[] { 1, 2, 3 }):
+        cxr::custom_attribute::positional_argument_range const positional(attribute.positional_arguments());
+        c.verify_equals(cxr::distance(begin(positional), end(positional)), 4u);
+
+        c.verify(begin(positional)[0].get_kind() == cxr::custom_attribute_argument::kind::int32);
+        c.verify_equals(begin(positional)[0].as_int32(), 42);
+
+        c.verify(begin(positional)[1].as_string() == L"hi");
+
+        c.verify(begin(positional)[2].is_enum());
+        c.verify_equals(begin(positional)[2].as_int32(), 2);
+
+        cxr::custom_attribute_argument const array(begin(positional)[3]);
+        c.verify(array.get_kind() == cxr::custom_attribute_argument::kind::array);
+        c.verify_equals(array.element_count(), 3u);
+
+        std::int16_t expected_element(1);
+        cxr::for_all(array.elements(), [&](cxr::custom_attribute_argument const& element)
+        {
+            c.verify_equals(element.as_int16(), expected_element++);
+        });
+
+        // Label = "x", Flag = true, Boxed = ZColor.Green:
+        cxr::custom_attribute::named_argument_range const named(attribute.named_arguments());
+        c.verify_equals(cxr::distance(begin(named), end(named)), 3u);
+
+        c.verify(begin(named)[0].name() == L"Label" && begin(named)[0].is_field());
+        c.verify(begin(named)[0].value().as_string() == L"x");
+
+        c.verify(begin(named)[1].name() == L"Flag" && begin(named)[1].is_property());
+        c.verify(begin(named)[1].value().as_boolean());
+
+        cxr::custom_attribute_argument const boxed(begin(named)[2].value());
+        c.verify(boxed.is_boxed() && boxed.is_enum());
+        c.verify_equals(boxed.as_int32(), 1);
+
+        // The layout is decoded once per attribute row and shared by all handles:
+        c.verify(begin(attribute.positional_arguments()) == begin(positional));
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_custom_attributes_unreferenced_enum_assembly)
+    {
+        cxr::type const attributed(beta.find_type(L"", L"ZMisattributed"));
+        c.verify(attributed.is_initialized());
+
+        // The enumeration type of the boxed argument names an assembly that is not referenced by
+        // beta; it must not be resolved to the ZColor type defined in beta:
+        cxr::custom_attribute const attribute(*begin(attributed.custom_attributes()));
+        c.verify_exception<cxr::runtime_error>([&]{ attribute.named_arguments(); });
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_custom_attributes_constructor)
+    {
+        cxr::type const attributed(beta.find_type(L"", L"ZAttributed"));
+        c.verify(attributed.is_initialized());
+
+        cxr::method const first(begin(attributed.custom_attributes())->constructor());
+        c.verify(first.declaring_type().name() == L"ZAttribute");
+        c.verify(first.name() == L".ctor");
+
+        // The constructor is resolved once per attribute row, so every handle yields the same one:
+        cxr::method const second(begin(attributed.custom_attributes())->constructor());
+        c.verify(first == second);
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_custom_attributes_member_ref_constructor)
+    {
+        cxr::type const attributed(beta.find_type(L"", L"ZExternallyAttributed"));
+        c.verify(attributed.is_initialized());
+
+        auto const attributes(attributed.custom_attributes());
+        c.verify_equals(cxr::distance(begin(attributes), end(attributes)), 1u);
+
+        // The constructor is declared in mscorlib and referenced through a MemberRef:
+        cxr::method const constructor(begin(attributes)->constructor());
+        c.verify(constructor.is_initialized());
+        c.verify(constructor.name() == L".ctor");
+        c.verify(constructor.declaring_type().full_name() == L"System.ObsoleteAttribute");
+        c.verify(constructor.declaring_type().defining_assembly() != beta);
+        c.verify_equals(constructor.parameter_count(), 1u);
+        c.verify(constructor.get_parameter(0).parameter_type().simple_name() == L"String");
+
+        cxr::custom_attribute::positional_argument_range const positional(begin(attributes)->positional_arguments());
+        c.verify_equals(cxr::distance(begin(positional), end(positional)), 1u);
+        c.verify(begin(positional)[0].as_string() == L"old");
+
+        // Both attributes use the same MemberRef, so they resolve to the same constructor:
+        cxr::method const old(attributed.find_method(L"Old", cxr::binding_attribute::all_static));
+        c.verify(begin(old.custom_attributes())->constructor() == constructor);
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_custom_attributes_nested_enum_and_generic_type)
+    {
+        cxr::type const attributed(beta.find_type(L"", L"ZUnusuallyAttributed"));
+        c.verify(attributed.is_initialized());
+
+        auto const attributes(attributed.custom_attributes());
+        c.verify_equals(cxr::distance(begin(attributes), end(attributes)), 2u);
+
+        cxr::for_all(attributes, [&](cxr::custom_attribute const& attribute)
+        {
+            cxr::method const constructor(attribute.constructor());
+            if (constructor.declaring_type().is_generic_type())
+            {
+                // ZGenericAttribute<int>(5):  the constructor parameter is instantiated:
+                c.verify(!constructor.declaring_type().is_generic_type_definition());
+                c.verify(constructor.get_parameter(0).parameter_type().simple_name() == L"Int32");
+
+                cxr::custom_attribute::positional_argument_range const positional(attribute.positional_arguments());
+                c.verify_equals(cxr::distance(begin(positional), end(positional)), 1u);
+                c.verify_equals(begin(positional)[0].as_int32(), 5);
+            }
+            else
+            {
+                // Boxed = ZOuter.ZInnerColor.Cyan:
+                cxr::custom_attribute::named_argument_range const named(attribute.named_arguments());
+                c.verify_equals(cxr::distance(begin(named), end(named)), 1u);
+
+                cxr::custom_attribute_argument const boxed(begin(named)[0].value());
+                c.verify(boxed.is_boxed() && boxed.is_enum());
+                c.verify_equals(boxed.as_int32(), 7);
+            }
+        });
+    }
+
+}
@@ -0,0 +1,55 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_embedded_data_manifest_resources)
+    {
+        std::vector<cxr::manifest_resource> const resources(begin(beta.manifest_resources()), end(beta.manifest_resources()));
+        c.verify_equals(resources.size(), 1u);
+
+        cxr::manifest_resource const resource(beta.find_manifest_resource(L"beta_resource.txt"));
+        c.verify(resource == resources[0]);
+        c.verify(resource.is_public());
+        c.verify(resource.is_embedded());
+        c.verify(!resource.containing_file().is_initialized());
+        c.verify(!beta.find_manifest_resource(L"beta_missing.txt").is_initialized());
+
+        // The data is a view of the PE file, and the cursor reads the same bytes:
+        char const expected[] = "Hello, resources!";
+        cxr::const_byte_range const data(resource.data());
+        c.verify_equals(data.size(), sizeof expected - 1);
+        c.verify(std::equal(data.begin(), data.end(), reinterpret_cast<cxr::byte const*>(expected)));
+
+        cxr::const_byte_cursor cursor(resource.open());
+        cxr::byte prefix[5] = { 0 };
+        cursor.read(prefix, 5);
+        c.verify(std::equal(prefix, prefix + 5, reinterpret_cast<cxr::byte const*>(expected)));
+        c.verify_equals(cursor.get_position(), 5u);
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_embedded_data_field_initial_value)
+    {
+        cxr::type const initial_data(beta.find_type(L"", L"ZInitialData"));
+
+        cxr::const_byte_range const answer(initial_data.find_field(L"Answer", cxr::binding_attribute::all_static).initial_value());
+        c.verify_equals(answer.size(), 4u);
+
+        std::int32_t answer_value(0);
+        std::copy(answer.begin(), answer.end(), reinterpret_cast<cxr::byte*>(&answer_value));
+        c.verify_equals(answer_value, 42);
+
+        // The size of a value type field is the class size of the value type:
+        cxr::const_byte_range const bytes(initial_data.find_field(L"Bytes", cxr::binding_attribute::all_static).initial_value());
+        c.verify_equals(bytes.size(), 8u);
+        for (cxr::size_type i(0); i != bytes.size(); ++i)
+            c.verify_equals(bytes.begin()[i], static_cast<cxr::byte>(i + 1));
+
+        c.verify(!initial_data.find_field(L"Uninitialized", cxr::binding_attribute::all_static).initial_value().is_initialized());
+    }
+
+}
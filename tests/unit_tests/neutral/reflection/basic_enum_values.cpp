@@ -0,0 +1,59 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_enum_values_table)
+    {
+        cxr::type const flags_type(beta.find_type(L"", L"ZFlags"));
+        c.verify(flags_type.is_initialized());
+
+        cxr::enum_value_table const& table(cxr::enum_values(flags_type));
+        c.verify(table.underlying_kind() == cxr::constant::kind::int16);
+        c.verify(table.is_signed());
+
+        // The table is built once per type:
+        c.verify(&cxr::enum_values(flags_type) == &table);
+
+        // Values are sorted by unsigned value, as by System.Enum, so the negative value is last:
+        c.verify_equals(table.values().size(), 6u);
+        c.verify(begin(table.values())[0].name() == L"None");
+        c.verify(begin(table.values())[4].name() == L"C");
+        c.verify(begin(table.values())[5].name() == L"Minus");
+        c.verify_equals(begin(table.values())[5].signed_value(), -1);
+
+        // The declaration order is kept too:
+        c.verify_equals(table.values_in_declaration_order().size(), 6u);
+        c.verify(begin(table.values_in_declaration_order())[1].name() == L"C");
+        c.verify(begin(table.values_in_declaration_order())[2].name() == L"A");
+
+        c.verify(begin(table.values_by_name())[0].name() == L"A");
+
+        c.verify(table.find(2).name() == L"B");
+        c.verify(!table.find(8).is_initialized());
+        c.verify_equals(table.find(L"AB").unsigned_value(), 3u);
+        c.verify(!table.find(L"D").is_initialized());
+
+        // 7 is AB | C; the largest values are selected first:
+        cxr::enum_value_table::value_sequence const seven(table.decompose(7));
+        c.verify_equals(seven.size(), 2u);
+        c.verify(seven[0].name() == L"AB");
+        c.verify(seven[1].name() == L"C");
+
+        c.verify(table.decompose(8).empty());
+        c.verify(table.decompose(0).size() == 1 && table.decompose(0)[0].name() == L"None");
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_enum_values_string_constant)
+    {
+        cxr::type const constants(beta.find_type(L"", L"ZConstants"));
+        cxr::field const greeting(constants.find_field(L"Greeting", cxr::binding_attribute::all_static));
+        c.verify(greeting.constant_value().get_kind() == cxr::constant::kind::string);
+        c.verify(greeting.constant_value().as_string() == L"hello");
+    }
+
+}
@@ -97,6 +97,85 @@ namespace cxxreflect_test {
         });
     }
 
+    // Verify that module::preresolve visits every reference, that it counts exactly the references
+    // that cannot be resolved, and that the parallel and sequential modes agree.
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_loader_module_preresolve)
+    {
+        cxr::module const m(beta.manifest_module());
+        c.verify(m.is_initialized());
+
+        cxr::database const& scope(m.context(cxr::internal_key()).database());
+
+        cxr::module_preresolution_result const parallel_result(m.preresolve(true));
+        c.verify_equals(parallel_result.type_ref_count(),   scope.tables()[cxr::table_id::type_ref  ].row_count());
+        c.verify_equals(parallel_result.member_ref_count(), scope.tables()[cxr::table_id::member_ref].row_count());
+
+        // The only TypeRef that cannot be resolved is NMissing.QMissing, which names a type in an
+        // assembly that does not exist.  The only MemberRef that cannot be resolved is Missing,
+        // which names a global function in a module that does not exist.  The nested TypeRef and
+        // the vararg call site MemberRef in ZUnusualReferences are resolved.
+        c.verify_equals(parallel_result.unresolved_type_ref_count(),   1u);
+        c.verify_equals(parallel_result.unresolved_member_ref_count(), 1u);
+
+        cxr::module_preresolution_result const sequential_result(m.preresolve(false));
+        c.verify_equals(sequential_result.unresolved_type_ref_count(),   parallel_result.unresolved_type_ref_count());
+        c.verify_equals(sequential_result.unresolved_member_ref_count(), parallel_result.unresolved_member_ref_count());
+    }
+
+    // Verify that a nested TypeRef resolves to the nested type in the scope of its enclosing type,
+    // and that a MemberRef whose parent is a MethodDef resolves to that MethodDef.
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_loader_unusual_references)
+    {
+        cxr::database const& scope(beta.manifest_module().context(cxr::internal_key()).database());
+        cxxreflect::reflection::detail::loader_context const& loader(cxxreflect::reflection::detail::loader_context::from(scope));
+
+        auto const folder_ref(std::find_if(scope.begin<cxr::table_id::type_ref>(), scope.end<cxr::table_id::type_ref>(),
+            [](cxr::type_ref_row const& r) { return r.name() == L"SpecialFolder"; }));
+        c.verify(folder_ref != scope.end<cxr::table_id::type_ref>());
+
+        cxr::type_def_token const folder(loader.resolve_type_ref(folder_ref->token()));
+        c.verify(row_from(folder).name() == L"SpecialFolder");
+        c.verify(&folder.scope() != &scope);
+
+        auto const varargs_ref(std::find_if(scope.begin<cxr::table_id::member_ref>(), scope.end<cxr::table_id::member_ref>(),
+            [](cxr::member_ref_row const& r) { return r.name() == L"VarArgs"; }));
+        c.verify(varargs_ref != scope.end<cxr::table_id::member_ref>());
+
+        cxr::field_or_method_def_token const varargs(loader.resolve_member_ref(varargs_ref->token()));
+        c.verify(varargs.is<cxr::method_def_token>());
+        c.verify(&varargs.scope() == &scope);
+        c.verify(row_from(varargs.as<cxr::method_def_token>()).name() == L"VarArgs");
+    }
+
+    // Verify that the search path locator finds assemblies through its directory index regardless
+    // of case, and that cached results (including failed lookups) survive refreshing and copying.
+    CXXREFLECTTEST_DEFINE_TEST(reflection_basic_loader_search_path_locator)
+    {
+        cxr::search_path_module_locator::search_path_sequence paths;
+        paths.push_back(c.get_property(known_property::test_assemblies_path()));
+
+        cxr::search_path_module_locator const locator(paths);
+
+        cxr::assembly_name const alpha(L"alpha", cxr::version());
+        cxr::assembly_name const upper_alpha(L"ALPHA", cxr::version());
+        cxr::assembly_name const missing(L"nonexistent", cxr::version());
+
+        c.verify(locator.locate_assembly(alpha).is_file());
+        c.verify(locator.locate_assembly(upper_alpha).is_file());
+
+        // A failed lookup is cached, so the second lookup does not search the index:
+        c.verify(!locator.locate_assembly(missing).is_initialized());
+        c.verify(!locator.locate_assembly(missing).is_initialized());
+
+        // The index is rebuilt after a refresh:
+        locator.refresh();
+        c.verify(locator.locate_assembly(alpha).is_file());
+        c.verify(!locator.locate_assembly(missing).is_initialized());
+
+        cxr::search_path_module_locator const copy(locator);
+        c.verify(copy.locate_assembly(alpha).is_file());
+    }
+
     CXXREFLECTTEST_DEFINE_TEST(reflection_basic_loader_methods)
     {
         cxr::loader_root const root(create_test_loader(c));
@@ -0,0 +1,87 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_membership_by_name_find_members)
+    {
+        cxr::type const base(beta.find_type(L"", L"ZBase"));
+        cxr::type const properties(beta.find_type(L"", L"MPropertySimple"));
+        c.verify(base.is_initialized() && properties.is_initialized());
+
+        cxr::type::method_name_range const g_methods(base.find_methods(L"G", cxr::binding_attribute::all_instance));
+        c.verify_equals(cxr::distance(begin(g_methods), end(g_methods)), 1u);
+        c.verify((*begin(g_methods)).name() == L"G");
+
+        // Inherited methods are found too, and the index is shared by queries with other flags:
+        cxr::type::method_name_range const to_string(base.find_methods(L"ToString", cxr::binding_attribute::all_instance));
+        c.verify_equals(cxr::distance(begin(to_string), end(to_string)), 1u);
+        c.verify(base.find_methods(L"ToString", cxr::binding_attribute::all_static).empty());
+
+        c.verify(base.find_methods(L"Q", cxr::binding_attribute::all_instance).empty());
+        c.verify(base.find_method(L"F", cxr::binding_attribute::all_instance).is_initialized());
+        c.verify(!base.find_method(L"Q", cxr::binding_attribute::all_instance).is_initialized());
+
+        c.verify(properties.find_property(L"R", cxr::binding_attribute::all_instance).is_initialized());
+        c.verify(!properties.find_property(L"X", cxr::binding_attribute::all_instance).is_initialized());
+        c.verify(!properties.find_field(L"R", cxr::binding_attribute::all_instance).is_initialized());
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_membership_by_name_resolve_member_ref)
+    {
+        cxr::type const bodies(beta.find_type(L"", L"ZMethodBodies"));
+        cxr::method_body const body(bodies.find_method(L"References", cxr::binding_attribute::all_static).get_method_body());
+
+        std::vector<cxr::il_instruction> const instructions(begin(body.instructions()), end(body.instructions()));
+        c.verify_equals(instructions.size(), 6u);
+
+        cxr::type const string_type(bodies.base_type().resolve().defining_assembly().find_type(L"System", L"String"));
+        c.verify(string_type.is_initialized());
+
+        cxxreflect::reflection::detail::loader_context const& context(root.context(cxr::internal_key()));
+
+        // MemberRefs are resolved by looking up their names in the member name index of the parent
+        // type, then matching signatures among the members with that name:
+        auto const resolve([&](cxr::il_instruction const& instruction) -> cxr::field_or_method_def_token
+        {
+            c.verify(instruction.token_operand().table() == cxr::table_id::member_ref);
+            return context.resolve_member(instruction.token_operand().as<cxr::member_ref_token>());
+        });
+
+        cxr::field_or_method_def_token const empty(resolve(instructions[0]));
+        c.verify(empty.is<cxr::field_token>());
+        c.verify_equals(empty.value(), string_type.find_field(L"Empty", cxr::binding_attribute::all_static).metadata_token());
+
+        // Each overload of Concat is found by its parameter types:
+        auto const find_concat([&](cxr::string_reference const parameter_type) -> cxr::method
+        {
+            cxr::method result;
+            cxr::for_all(string_type.find_methods(L"Concat", cxr::binding_attribute::all_static), [&](cxr::method const& m)
+            {
+                if (m.parameter_count() == 2 &&
+                    m.get_parameter(0).parameter_type().simple_name() == parameter_type &&
+                    m.get_parameter(1).parameter_type().simple_name() == parameter_type)
+                    result = m;
+            });
+
+            c.verify(result.is_initialized());
+            return result;
+        });
+
+        cxr::field_or_method_def_token const concat_strings(resolve(instructions[2]));
+        c.verify(concat_strings.is<cxr::method_def_token>());
+        c.verify_equals(concat_strings.value(), find_concat(L"String").metadata_token());
+
+        cxr::field_or_method_def_token const concat_objects(resolve(instructions[4]));
+        c.verify(concat_objects.is<cxr::method_def_token>());
+        c.verify_equals(concat_objects.value(), find_concat(L"Object").metadata_token());
+
+        // Resolution results are cached, so resolving again yields the same token:
+        c.verify(resolve(instructions[2]) == concat_strings);
+    }
+
+}
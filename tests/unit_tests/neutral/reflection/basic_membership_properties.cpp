@@ -113,6 +113,23 @@ namespace cxxreflect_test {
         c.verify(saw_RW && saw_R && saw_W);
     }
 
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_membership_properties_associated_property)
+    {
+        cxr::type const t(beta.find_type(L"", L"MPropertySimple"));
+        c.verify(t.is_initialized());
+
+        cxr::binding_flags const flags(cxr::binding_attribute::all_instance);
+
+        cxr::property const rw(t.find_property(L"RW", flags));
+        c.verify_equals(t.find_method(L"get_RW", flags).associated_property().metadata_token(), rw.metadata_token());
+        c.verify_equals(t.find_method(L"set_RW", flags).associated_property().metadata_token(), rw.metadata_token());
+
+        c.verify(t.find_method(L"get_R", flags).associated_property().name() == L"R");
+        c.verify(t.find_method(L"set_W", flags).associated_property().name() == L"W");
+
+        c.verify(!t.find_method(L"ToString", flags).associated_property().is_initialized());
+    }
+
     CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_membership_properties_derived)
     {
         // Simple derived (hidden) property check
@@ -0,0 +1,54 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_membership_views_cached)
+    {
+        cxr::type const base(beta.find_type(L"", L"ZBase"));
+        c.verify(base.is_initialized());
+
+        cxr::binding_flags const declared_instance(
+            cxr::binding_attribute::all_instance | cxr::binding_attribute::declared_only);
+
+        // F, G, M, N, O, and P; the second enumeration uses the cached view:
+        cxr::type::method_range const first(base.methods(declared_instance));
+        cxr::type::method_range const second(base.methods(declared_instance));
+        c.verify_equals(cxr::distance(begin(first), end(first)), 6u);
+        c.verify(std::equal(begin(first), end(first), begin(second)));
+
+        // Each set of flags has its own view of the same table:
+        cxr::type::method_range const all_methods(base.methods(cxr::binding_attribute::all_instance));
+        c.verify(cxr::distance(begin(all_methods), end(all_methods)) > 6u);
+        c.verify(base.methods(cxr::binding_attribute::all_static | cxr::binding_attribute::declared_only).empty());
+
+        cxr::type::method_range const constructors(base.constructors(cxr::binding_attribute::all_instance));
+        c.verify_equals(cxr::distance(begin(constructors), end(constructors)), 1u);
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_membership_views_realize_all)
+    {
+        std::vector<cxr::assembly> const assemblies(1, beta);
+
+        cxr::realization_statistics const first(root.realize_all(assemblies));
+        c.verify_equals(first.assembly_count(), 1u);
+        c.verify(first.type_count() >= 4u);
+        c.verify_equals(first.failed_type_count(), 0u);
+        c.verify(first.entry_count() > 0u);
+
+        // Levels are indexed by depth:  MPropertySimpleDerived derives from MPropertySimpleBase,
+        // which derives from System.Object:
+        c.verify(first.level_count() >= 3u);
+
+        // Every table has been built, so a second realization builds nothing:
+        cxr::realization_statistics const second(root.realize_all(assemblies, cxr::realization_option::all_tables));
+        c.verify_equals(second.type_count(), first.type_count());
+        c.verify_equals(second.layer_count(), 0u);
+        c.verify_equals(second.table_bytes(), 0u);
+    }
+
+}
@@ -0,0 +1,64 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxxreflect_test { namespace {
+
+    class counting_visitor : public cxr::module_visitor
+    {
+    public:
+
+        counting_visitor()
+            : type_count(0), method_count(0), parameter_count(0)
+        {
+        }
+
+        virtual auto begin_type(cxr::type_def_row const& type) -> bool
+        {
+            ++type_count;
+            return type.name() == L"ZBase";
+        }
+
+        virtual auto begin_method(cxr::method_def_row const& method) -> bool
+        {
+            ++method_count;
+            return method.name() == L"P";
+        }
+
+        virtual auto visit_parameter(cxr::param_row const&) -> void
+        {
+            ++parameter_count;
+        }
+
+        cxr::size_type type_count;
+        cxr::size_type method_count;
+        cxr::size_type parameter_count;
+    };
+
+} }
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_module_visitor_counts)
+    {
+        counting_visitor visitor;
+        beta.visit(visitor);
+
+        c.verify(visitor.type_count >= 4u);
+
+        // Only the members of ZBase are visited:  its constructor and F, G, M, N, O, and P.  Only
+        // the parameters of P are visited:
+        c.verify_equals(visitor.method_count, 7u);
+        c.verify_equals(visitor.parameter_count, 3u);
+
+        // Visiting the whole type range of the (only) module visits the same elements:
+        counting_visitor range_visitor;
+        beta.manifest_module().visit(range_visitor, 0, beta.manifest_module().type_def_count());
+        c.verify_equals(range_visitor.type_count, visitor.type_count);
+        c.verify_equals(range_visitor.method_count, visitor.method_count);
+    }
+
+}
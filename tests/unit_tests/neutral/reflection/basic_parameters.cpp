@@ -0,0 +1,46 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_parameters_by_position)
+    {
+        cxr::type const attribute(beta.find_type(L"", L"ZAttribute"));
+        c.verify(attribute.is_initialized());
+
+        auto const constructors(attribute.constructors(cxr::binding_attribute::all_instance));
+        c.verify_equals(cxr::distance(begin(constructors), end(constructors)), 1u);
+
+        cxr::method const constructor(*begin(constructors));
+        c.verify_equals(constructor.parameter_count(), 4u);
+
+        // Parameters found by position are the same as the parameters that are enumerated:
+        cxr::size_type position(0);
+        cxr::for_all(constructor.parameters(), [&](cxr::parameter const& p)
+        {
+            c.verify_equals(p.position(), position);
+            c.verify(constructor.get_parameter(position) == p);
+            ++position;
+        });
+
+        c.verify_equals(position, 4u);
+
+        c.verify(constructor.get_parameter(2).name() == L"c");
+        c.verify(constructor.get_parameter(2).parameter_type().simple_name() == L"ZColor");
+        c.verify(constructor.get_parameter(3).parameter_type().is_array());
+
+        // Parameters without Param rows are enumerated in signature order, but have no names:
+        cxr::type const parameters(beta.find_type(L"", L"ZParameters"));
+        cxr::method const unnamed(parameters.find_method(L"Unnamed", cxr::binding_attribute::all_instance));
+        c.verify_equals(cxr::distance(begin(unnamed.parameters()), end(unnamed.parameters())), 2u);
+
+        c.verify(unnamed.get_parameter(0).name().empty());
+        c.verify(unnamed.get_parameter(0).parameter_type().simple_name() == L"Int32");
+        c.verify(unnamed.get_parameter(1).parameter_type().simple_name() == L"String");
+    }
+
+}
@@ -0,0 +1,25 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_type_forwarding_exported_type)
+    {
+        cxr::type const forwarding(beta.find_type(L"", L"ZForwarding"));
+        cxr::type const forwarded(forwarding.find_field(L"Forwarded", cxr::binding_attribute::all_static).field_type());
+
+        // The type is exported by beta but defined in mscorlib:
+        c.verify(forwarded.is_initialized());
+        c.verify(forwarded.defining_assembly() != beta);
+        c.verify_equals(forwarded.defining_assembly().name().simple_name(), L"mscorlib");
+        c.verify_equals(forwarded.full_name(), L"System.Guid");
+
+        // Beta does not define the type, so it cannot be found there by name:
+        c.verify(!beta.find_type(L"System", L"Guid").is_initialized());
+    }
+
+}
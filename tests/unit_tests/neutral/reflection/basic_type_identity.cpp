@@ -0,0 +1,80 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_type_identity_canonical_equality)
+    {
+        cxr::type const base_interface(beta.find_type(L"", L"ZBaseInterface"));
+        cxr::type const base(beta.find_type(L"", L"ZBase"));
+        cxr::type const argument(beta.find_type(L"", L"ZArgument"));
+        c.verify(base_interface.is_initialized() && base.is_initialized() && argument.is_initialized());
+
+        cxr::method const interface_g(base_interface.find_method(L"G", cxr::binding_attribute::all_instance));
+        cxr::method const base_g(base.find_method(L"G", cxr::binding_attribute::all_instance));
+        c.verify(interface_g.is_initialized() && base_g.is_initialized());
+
+        // The parameter types come from two different signatures but name the same type, so they
+        // have the same canonical id as the type definition:
+        cxr::type const interface_argument((*begin(interface_g.parameters())).parameter_type());
+        cxr::type const base_argument((*begin(base_g.parameters())).parameter_type());
+
+        c.verify_equals(interface_argument.canonical_id(), base_argument.canonical_id());
+        c.verify_equals(interface_argument.canonical_id(), argument.canonical_id());
+        c.verify(interface_argument.canonical_id() != base.canonical_id());
+
+        // Ids are stable, and the id of a signature is computed only once:
+        c.verify_equals(interface_argument.canonical_id(), interface_argument.canonical_id());
+        c.verify_equals(base.canonical_id(), beta.find_type(L"", L"ZBase").canonical_id());
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_type_identity_unresolvable_argument)
+    {
+        cxr::type const holder(beta.find_type(L"", L"ZUnresolvableArgument"));
+        c.verify(holder.is_initialized());
+
+        cxr::field const value(holder.find_field(L"Value", cxr::binding_attribute::all_instance));
+        c.verify(value.is_initialized());
+
+        // The type argument cannot be resolved, so the instantiation has no canonical id:
+        cxr::type const instantiation(value.field_type());
+        c.verify_exception<cxr::runtime_error>([&]{ instantiation.canonical_id(); });
+
+        // Its members are still available, and a second lookup finds the same membership:
+        cxr::binding_flags const flags(cxr::binding_attribute::all_instance | cxr::binding_attribute::declared_only);
+        std::vector<cxr::method> const methods(begin(instantiation.methods(flags)), end(instantiation.methods(flags)));
+        c.verify_equals(methods.size(), 2u);
+
+        c.verify(instantiation.find_method(L"Get", flags).is_initialized());
+        c.verify(instantiation.find_method(L"Set", flags) == value.field_type().find_method(L"Set", flags));
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_type_identity_many_signatures)
+    {
+        // Every parameter and return type of every method in beta and in the system assembly is
+        // canonicalized, which grows the identity index well beyond its initial size.  Each type
+        // keeps its id as the index grows:
+        cxr::assembly const system(beta.find_type(L"", L"ZBase").base_type().resolve().defining_assembly());
+
+        std::vector<std::pair<cxr::type, cxr::size_type>> ids;
+        cxr::for_all(system.types(), [&](cxr::type const& t)
+        {
+            cxr::for_all(t.methods(cxr::binding_attribute::all_instance | cxr::binding_attribute::declared_only), [&](cxr::method const& m)
+            {
+                if (m.return_type().is_initialized())
+                    ids.push_back(std::make_pair(m.return_type(), m.return_type().canonical_id()));
+            });
+        });
+
+        c.verify(ids.size() > 256u);
+        cxr::for_all(ids, [&](std::pair<cxr::type, cxr::size_type> const& entry)
+        {
+            c.verify_equals(entry.first.canonical_id(), entry.second);
+        });
+    }
+
+}
@@ -0,0 +1,55 @@
+
+//                            Copyright James P. McNellis 2011 - 2013.                            //
+//                   Distributed under the Boost Software License, Version 1.0.                   //
+//     (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)    //
+
+#include "tests/unit_tests/neutral/precompiled_headers.hpp"
+
+namespace cxxreflect_test {
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_type_names_format_name_into)
+    {
+        cxr::type const base(beta.find_type(L"", L"ZBase"));
+        c.verify(base.is_initialized());
+
+        cxr::string const full_name(base.full_name().c_str());
+        c.verify(full_name == L"ZBase");
+
+        // The names are cached, so repeated queries must return the same cached names:
+        c.verify(base.full_name() == full_name);
+        c.verify(base.full_name().data()               == base.full_name().data());
+        c.verify(base.simple_name().data()             == base.simple_name().data());
+        c.verify(base.assembly_qualified_name().data() == base.assembly_qualified_name().data());
+
+        cxr::string buffer(L"prefix:");
+        base.format_name_into(buffer);
+        c.verify(buffer == L"prefix:" + full_name);
+
+        buffer.clear();
+        base.format_name_into(buffer, cxr::type_name_kind::assembly_qualified_name);
+        c.verify(buffer == base.assembly_qualified_name());
+
+        buffer.clear();
+        base.format_name_into(buffer, cxr::type_name_kind::simple_name);
+        c.verify(buffer == base.simple_name());
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_type_names_unresolvable_argument)
+    {
+        cxr::type const holder(beta.find_type(L"", L"ZUnresolvableArgument"));
+        cxr::field const value(holder.find_field(L"Value", cxr::binding_attribute::all_instance));
+        c.verify(value.is_initialized());
+
+        // The type argument of the field type cannot be resolved, but formatting the name of the
+        // type does not require resolution:
+        cxr::type const instantiation(value.field_type());
+        c.verify(instantiation.simple_name() == L"ZUnresolvableGeneric`1");
+
+        cxr::string const full_name(instantiation.full_name().c_str());
+        c.verify(full_name.find(L"ZUnresolvableGeneric`1[[NMissing.QMissing") == 0);
+
+        // The name is cached by the identity of the signature:
+        c.verify(instantiation.full_name().data() == value.field_type().full_name().data());
+    }
+
+}
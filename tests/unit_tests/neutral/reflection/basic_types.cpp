@@ -15,4 +15,55 @@ namespace cxxreflect_test {
         c.verify(beta.find_type(L"", L"ZBase").is_initialized());
     }
 
-}
\ No newline at end of file
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_types_is_subclass_of)
+    {
+        cxr::type const base(beta.find_type(L"", L"MPropertySimpleBase"));
+        cxr::type const derived(beta.find_type(L"", L"MPropertySimpleDerived"));
+        cxr::type const unrelated(beta.find_type(L"", L"ZBase"));
+        c.verify(base.is_initialized() && derived.is_initialized() && unrelated.is_initialized());
+
+        cxr::type const object(base.base_type().resolve());
+        c.verify(object.is_initialized());
+
+        c.verify( derived.is_subclass_of(base));
+        c.verify( derived.is_subclass_of(object));
+        c.verify( base.is_subclass_of(object));
+
+        c.verify(!derived.is_subclass_of(derived));
+        c.verify(!derived.is_subclass_of(unrelated));
+        c.verify(!base.is_subclass_of(derived));
+        c.verify(!object.is_subclass_of(object));
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_types_generic_instance_base)
+    {
+        cxr::type const base(beta.find_type(L"", L"ZGenericMarshalByRefBase`1"));
+        cxr::type const derived(beta.find_type(L"", L"ZGenericMarshalByRefDerived"));
+        c.verify(base.is_initialized() && derived.is_initialized());
+
+        c.verify(base.is_marshal_by_ref());
+
+        // The base type chain is followed through the generic type definition of an instantiated
+        // base type, so a type is classified by the system types from which that definition derives:
+        c.verify(derived.base_type().resolve().is_generic_type_instantiation());
+        c.verify(derived.is_marshal_by_ref());
+        c.verify(!derived.is_value_type());
+    }
+
+    CXXREFLECTTEST_DEFINE_BETA_TEST(reflection_basic_beta_types_implements)
+    {
+        cxr::type const base_interface(beta.find_type(L"", L"ZBaseInterface"));
+        cxr::type const base(beta.find_type(L"", L"ZBase"));
+        cxr::type const unrelated(beta.find_type(L"", L"ZArgument"));
+        c.verify(base_interface.is_initialized() && base.is_initialized() && unrelated.is_initialized());
+
+        c.verify( base.implements(base_interface));
+        c.verify(!unrelated.implements(base_interface));
+        c.verify(!base_interface.implements(base_interface));
+
+        // The closure is cached after the first query; verify that later queries agree:
+        c.verify( base.implements(base_interface));
+        c.verify(!unrelated.implements(base_interface));
+    }
+
+}
@@ -110,10 +110,10 @@ namespace {
 
     auto visit(visited_types_set& v, cxr::type const& t) -> void
     {
-        if (!t.is_initialized() || v.count(t.assembly_qualified_name()) != 0)
+        if (!t.is_initialized() || v.count(t.assembly_qualified_name().c_str()) != 0)
             return;
 
-        v.insert(t.assembly_qualified_name());
+        v.insert(t.assembly_qualified_name().c_str());
 
         t.attributes();
         visit(v, t.base_type());